@@ -35,6 +35,7 @@
 
 namespace Rml {
 
+class CompiledDocument;
 class Stream;
 class URL;
 using XMLAttributes = Dictionary;
@@ -85,6 +86,8 @@ class RMLUICORE_API BaseXMLParser
 		const URL* GetSourceURLPtr() const;
 
 	private:
+		friend class Rml::CompiledDocument;
+
 		const URL* source_url = nullptr;
 		String xml_source;
 		size_t xml_index = 0;
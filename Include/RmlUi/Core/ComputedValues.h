@@ -126,6 +126,7 @@ enum class Drag : uint8_t { None, Drag, DragDrop, Block, Clone };
 enum class TabIndex : uint8_t { None, Auto };
 enum class Focus : uint8_t { None, Auto };
 enum class PointerEvents : uint8_t { None, Auto };
+enum class RenderCache : uint8_t { None, Layer };
 
 using PerspectiveOrigin = LengthPercentage;
 using TransformOrigin = LengthPercentage;
@@ -214,6 +215,7 @@ struct ComputedValues
 	Focus focus = Focus::Auto;
 	float scrollbar_margin = 0;
 	PointerEvents pointer_events = PointerEvents::Auto;
+	RenderCache render_cache = RenderCache::None;
 
 	float perspective = 0;
 	PerspectiveOrigin perspective_origin_x = { PerspectiveOrigin::Percentage, 50.f };
@@ -38,13 +38,18 @@
 namespace Rml {
 
 class Stream;
+class CompiledDocument;
 class ContextInstancer;
 class ElementDocument;
 class EventListener;
+class Geometry;
+class GeometryArena;
 class RenderInterface;
 class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
+class HitTestGrid;
+struct EventInputParameters;
 enum class EventId : uint16_t;
 
 /**
@@ -94,6 +99,8 @@ public:
 	/// Load a document into the context.
 	/// @param[in] document_path The path to the document to load.
 	/// @return The loaded document, or nullptr if no document was loaded.
+	/// @note When enabled by Rml::SetCompiledFileLoading(), a compiled document at '<document_path>.bin' is loaded instead of the RML source, as long as it was compiled from the same source.
+	/// @note Documents started by Rml::PreloadDocuments() are taken from the preloader, instead of being loaded from their files.
 	ElementDocument* LoadDocument(const String& document_path);
 	/// Load a document into the context.
 	/// @param[in] document_stream The opened stream, ready to read.
@@ -104,6 +111,12 @@ public:
 	/// @param[in] source_url Optional string used to set the document's source URL, or naming the document for log messages.
 	/// @return The loaded document, or nullptr if no document was loaded.
 	ElementDocument* LoadDocumentFromMemory(const String& document_rml, const String& source_url = "[document from memory]");
+	/// Load a document into the context from its compiled form, see Factory::CompileDocument().
+	/// @param[in] data The compiled document.
+	/// @param[in] source_url The source URL of the document, used for resolving relative paths and for log messages.
+	/// @param[in] document_rml The current RML source of the document if available, the compiled document is rejected if it was compiled from a different source.
+	/// @return The loaded document, or nullptr if the compiled document is invalid or stale.
+	ElementDocument* LoadCompiledDocument(const String& data, const String& source_url, const String* document_rml = nullptr);
 	/// Unload the given document.
 	/// @param[in] document The document to unload.
 	/// @note The destruction of the document is deferred until the next call to Context::Update().
@@ -219,6 +232,16 @@ public:
 	/// @return True if the event was not consumed (ie, was prevented from propagating by an element), false if it was.
 	bool ProcessMouseWheel(float wheel_delta, int key_modifier_state);
 
+	/// Enables or disables queued input processing. When enabled, the 'Process...()' functions only record the input, which is
+	/// then processed in order during the next call to 'Update()'. Consecutive mouse movements are coalesced into a single movement,
+	/// and consecutive mouse wheel movements are summed, so that the hover state is only updated once for each such group.
+	/// Key and text input retain their exact order relative to all other input.
+	/// @note While enabled, the 'Process...()' functions always return true as the input has not been processed yet.
+	/// @param[in] queue_input True to enable queued input processing. When disabled, any pending input is processed immediately.
+	void SetQueueInput(bool queue_input);
+	/// Returns true if queued input processing is enabled.
+	bool GetQueueInput() const;
+
 	/// Returns a hint on whether the mouse is currently interacting with any elements in this context, based on previously submitted 'ProcessMouse...()' commands.
 	/// @note Interaction is determined irrespective of background and opacity. See the RCSS property 'pointer-events' to disable interaction for specific elements.
 	/// @return True if the mouse hovers over or has activated an element in this context, otherwise false.
@@ -333,6 +356,24 @@ private:
 	// Input state; stored from the most recent input events we receive from the application.
 	Vector2i mouse_position;
 
+	struct QueuedInput {
+		enum class Type { KeyDown, KeyUp, TextInput, MouseMove, MouseButtonDown, MouseButtonUp, MouseWheel };
+		Type type;
+		int key_modifier_state;
+		int index; // Key identifier or button index.
+		Vector2i mouse_position;
+		float wheel_delta;
+		String text;
+	};
+
+	// Input recorded while queued input processing is enabled, to be processed during the next update.
+	Vector<QueuedInput> input_queue;
+	bool queue_input = false;
+	bool processing_input_queue = false;
+
+	// The texture load generation last seen during update, used to refresh elements when textures finish loading in the background.
+	int texture_load_generation = 0;
+
 	// The render interface this context renders through.
 	RenderInterface* render_interface;
 	Vector2i clip_origin;
@@ -343,6 +384,18 @@ private:
 
 	UniquePtr<DataTypeRegister> data_type_register;
 
+	// Spatial index over the elements of the context for fast hit testing.
+	UniquePtr<HitTestGrid> hit_test_grid;
+
+	// Shared vertex and index pages for the geometry of elements in this context.
+	UniquePtr<GeometryArena> geometry_arena;
+
+	// Records the input if queued input processing is enabled, coalescing it with the previous input when possible.
+	// @return True if the input was queued, false if it should be processed immediately.
+	bool QueueInput(QueuedInput::Type type, int key_modifier_state, int index = 0, Vector2i mouse_position = Vector2i(0), float wheel_delta = 0.f, const String& text = String());
+	// Processes and clears all queued input.
+	void ProcessInputQueue();
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
 	// Internal callback for when a new element gains focus.
@@ -352,7 +405,7 @@ private:
 	void GenerateClickEvent(Element* element);
 
 	// Updates the current hover elements, sending required events.
-	void UpdateHoverChain(const Dictionary& parameters, const Dictionary& drag_parameters, Vector2i old_mouse_position);
+	void UpdateHoverChain(const EventInputParameters& parameters, const EventInputParameters& drag_parameters, Vector2i old_mouse_position);
 
 	// Creates the drag clone from the given element. The old drag clone will be released if necessary.
 	void CreateDragClone(Element* element);
@@ -363,21 +416,27 @@ private:
 	DataModel* GetDataModelPtr(const String& name) const;
 
 	// Builds the parameters for a generic key event.
-	void GenerateKeyEventParameters(Dictionary& parameters, Input::KeyIdentifier key_identifier);
+	void GenerateKeyEventParameters(EventInputParameters& parameters, Input::KeyIdentifier key_identifier);
 	// Builds the parameters for a generic mouse event.
-	void GenerateMouseEventParameters(Dictionary& parameters, int button_index = -1);
+	void GenerateMouseEventParameters(EventInputParameters& parameters, int button_index = -1);
 	// Builds the parameters for the key modifier state.
-	void GenerateKeyModifierEventParameters(Dictionary& parameters, int key_modifier_state);
+	void GenerateKeyModifierEventParameters(EventInputParameters& parameters, int key_modifier_state);
 	// Builds the parameters for a drag event.
-	void GenerateDragEventParameters(Dictionary& parameters);
+	void GenerateDragEventParameters(EventInputParameters& parameters);
 
+	// Instances a compiled document and places it into the context.
+	ElementDocument* InstanceCompiledDocument(const CompiledDocument& compiled_document);
+	// Places a newly instanced document into the context, and sends its load notifications.
+	ElementDocument* AppendDocument(ElementPtr element);
 	// Releases all unloaded documents pending destruction.
 	void ReleaseUnloadedDocuments();
 
 	// Sends the specified event to all elements in new_items that don't appear in old_items.
-	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
+	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const EventInputParameters& parameters);
 
 	friend class Rml::Element;
+	friend class Rml::Geometry;
+	friend RMLUICORE_API void ReleaseCompiledGeometry();
 	friend RMLUICORE_API Context* CreateContext(const String&, Vector2i, RenderInterface*);
 };
 
@@ -151,12 +151,111 @@ RMLUICORE_API StringList GetTextureSourceList();
 /// Forces all texture handles loaded and generated by RmlUi to be released.
 /// @param[in] render_interface Release all textures belonging to the given interface, or nullptr to release all textures in all interfaces.
 RMLUICORE_API void ReleaseTextures(RenderInterface* render_interface = nullptr);
-/// Forces all compiled geometry handles generated by RmlUi to be released.
+
+/// Statistics of the texture atlas, see Rml::SetTextureAtlas().
+struct TextureAtlasStatistics {
+	int num_pages = 0;
+	int num_textures = 0;
+	// Area covered by packed textures including their padding, and the total area of all pages, in pixels.
+	size_t used_area = 0;
+	size_t total_area = 0;
+};
+
+/// Enables packing of small textures loaded from files into shared atlas pages, so that elements using different images
+/// can be rendered from the same texture. Requires the render interface to support RenderInterface::LoadTextureData() and
+/// RenderInterface::UpdateTexture(). Only affects textures loaded after the call, disabled by default.
+/// @param[in] max_texture_size Textures with a width and height of at most this size are packed, or zero to disable the atlas.
+/// @param[in] page_size The width and height of each atlas page, in pixels.
+RMLUICORE_API void SetTextureAtlas(int max_texture_size, int page_size = 1024);
+/// Returns statistics about the texture atlas, useful for tuning its settings.
+RMLUICORE_API TextureAtlasStatistics GetTextureAtlasStatistics();
+
+/// Enables decoding of textures loaded from files on background threads, so that documents with many images can be shown
+/// without stalling. Elements are rendered without their images until loaded, the textures are then generated during
+/// Context::Update(). Requires the render interface to implement RenderInterface::LoadTextureData(), which is then called
+/// from the worker threads, and thus it must be thread-safe along with the file interface. Disabled by default.
+/// @param[in] num_threads The number of worker threads to decode textures on, or zero to disable background loading.
+/// @param[in] upload_budget The maximum number of bytes of texture data to generate during each context update, or zero for no limit. At least one texture is generated per update.
+RMLUICORE_API void SetAsyncTextureLoading(int num_threads, int upload_budget = 0);
+/// Starts loading the given file textures, so that they are ready by the time a document using them is shown.
+/// @param[in] sources The texture sources, as returned by GetTextureSourceList().
+/// @param[in] render_interface The render interface to load the textures for, or nullptr to use the global render interface.
+RMLUICORE_API void PrefetchTextures(const StringList& sources, RenderInterface* render_interface = nullptr);
+/// Returns the number of textures currently being loaded in the background.
+RMLUICORE_API int GetNumTexturesLoading();
+
+/// Starts loading the given documents on background threads. Their RML is tokenized, and the templates and style sheets
+/// linked from their heads are loaded into the caches. A subsequent call to Context::LoadDocument() with the same path
+/// then only instances the elements of the document, waiting for the document first if it is still being loaded. Each
+/// preloaded document is used by a single load, and is not reloaded if its file changes in the meantime. The file
+/// interface, the system interface, and any custom decorator and font effect instancers are called from the worker
+/// threads, and thus they must be thread-safe.
+/// @param[in] document_paths The paths of the documents to load, as later passed to Context::LoadDocument().
+/// @param[in] num_threads The number of worker threads to load the documents on, or zero to load them immediately on the calling thread.
+RMLUICORE_API void PreloadDocuments(const StringList& document_paths, int num_threads = 2);
+/// Returns the number of documents currently being preloaded in the background.
+RMLUICORE_API int GetNumDocumentsPreloading();
+
+/// Enables loading of compiled documents and style sheets made by the rmlcompiler and rcsscompiler tools. Documents and
+/// style sheets loaded from files then look for a compiled file at '<path>.bin', and use it instead of parsing the source
+/// as long as it was compiled from the same source and library version. This reads the source as well to check the
+/// compiled file against it. Disabled by default.
+/// @param[in] enable True to look for compiled files, false to always load the source files.
+RMLUICORE_API void SetCompiledFileLoading(bool enable);
+/// Returns true if compiled files are loaded, see Rml::SetCompiledFileLoading().
+RMLUICORE_API bool GetCompiledFileLoading();
+
+/// Reloads the style sheet files which have been modified since they were loaded, and applies the changes to every
+/// document linking them. Only the elements affected by changed rules are restyled, while documents and elements keep
+/// all their state. Intended for iterating on styles while the application is running, such as by calling this
+/// periodically or when a file watcher reports a change. Inline styles and templates are not reloaded, see
+/// ElementDocument::ReloadStyleSheet() for that.
+/// @return The number of style sheet files reloaded.
+/// @note Modifications are detected through FileInterface::GetModificationTime(), which must be supported by the file interface.
+RMLUICORE_API int ReloadModifiedStyleSheets();
+
+/// Statistics of the textures loaded by RmlUi, see Rml::SetTextureMemoryBudget().
+struct TextureMemoryStatistics {
+	// Estimated memory of all loaded textures, in bytes, and the current budget.
+	size_t resident_bytes = 0;
+	size_t budget = 0;
+	int num_resident_textures = 0;
+	// Total number of textures evicted to satisfy the budget, and of evicted textures loaded again.
+	int num_evictions = 0;
+	int num_reloads = 0;
+};
+
+/// Limits the memory used by loaded textures. When exceeded after rendering a context, the least recently rendered
+/// textures which are not currently visible are released, and loaded again on their next use. File textures no longer
+/// used by any element are evicted first, and then removed from the texture cache entirely.
+/// @param[in] budget The maximum number of bytes of texture data to keep loaded, or zero for no limit.
+RMLUICORE_API void SetTextureMemoryBudget(size_t budget);
+/// Returns statistics about the memory used by loaded textures, and the evictions caused by the budget.
+RMLUICORE_API TextureMemoryStatistics GetTextureMemoryStatistics();
+/// Forces all compiled geometry handles and geometry buffers generated by RmlUi to be released.
 RMLUICORE_API void ReleaseCompiledGeometry();
 
 /// Forces all memory pools used by RmlUi to be released.
 RMLUICORE_API void ReleaseMemoryPools();
 
+/// Output formats of the profile recording, see Rml::GetProfileRecording().
+enum class ProfileRecordingFormat {
+	Json,        // The total and self time of each zone, with the calls to a zone from the same parent merged.
+	ChromeTrace, // Every recorded zone in the trace event format, for viewing in chrome://tracing or Perfetto.
+};
+
+/// Starts or stops recording the time spent in the loading stages of RmlUi. This includes initialisation, font loading,
+/// style sheet and XML parsing, element instancing, data view creation, and the first update and layout of documents.
+/// Unlike the Tracy zones enabled by RMLUI_ENABLE_PROFILING, no external profiler is needed, and recording can be
+/// enabled before calling Initialise(). Zones are recorded from all threads, including document preloading threads.
+/// @param[in] enable True to start recording, false to stop. Recorded zones are kept until cleared.
+RMLUICORE_API void SetProfileRecording(bool enable);
+/// Returns the zones recorded so far, nested by the thread they were recorded on.
+/// @param[in] format The format of the returned string.
+RMLUICORE_API String GetProfileRecording(ProfileRecordingFormat format = ProfileRecordingFormat::Json);
+/// Discards all recorded zones.
+RMLUICORE_API void ClearProfileRecording();
+
 } // namespace Rml
 
 #endif
@@ -55,8 +55,6 @@ template<typename T> using DataTypeSetFunc = void(*)(T&, const Variant&);
 template<typename Object, typename ReturnType> using MemberGetterFunc = ReturnType(Object::*)();
 template<typename Object, typename AssignType> using MemberSetterFunc = void(Object::*)(AssignType);
 
-using DirtyVariables = SmallUnorderedSet<String>;
-
 struct DataAddressEntry {
 	DataAddressEntry(String name) : name(name), index(-1) { }
 	DataAddressEntry(int index) : index(index) { }
@@ -46,6 +46,7 @@ class Context;
 class DataModel;
 class Decorator;
 class ElementInstancer;
+class ElementLayer;
 class EventDispatcher;
 class EventListener;
 class ElementDecoration;
@@ -53,6 +54,8 @@ class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class ElementUtilities;
+class HitTestGrid;
 class LayoutEngine;
 class LayoutInlineBox;
 class LayoutBlockBox;
@@ -198,6 +201,18 @@ public:
 	/// @param[in] property The parsed property to set.
 	/// @return True if the property was set successfully, false otherwise.
 	bool SetProperty(PropertyId id, const Property& property);
+	/// Sets a local numeric property override on the element, such as a length or an angle, without any string parsing.
+	/// Prefer this over the string version when setting properties repeatedly, e.g. every frame from scripts.
+	/// @param[in] id The id of the property to set.
+	/// @param[in] value The numeric value.
+	/// @param[in] unit The unit of the value, must be a number, length, percentage, or angle unit.
+	/// @return True if the property was set successfully, false otherwise.
+	bool SetProperty(PropertyId id, float value, Property::Unit unit);
+	/// Sets a local colour property override on the element, without any string parsing.
+	/// @param[in] id The id of the property to set.
+	/// @param[in] colour The colour value.
+	/// @return True if the property was set successfully, false otherwise.
+	bool SetProperty(PropertyId id, Colourb colour);
 	/// Removes a local property override on the element; its value will revert to that defined in the style sheet.
 	/// @param[in] name The name of the local property definition to remove.
 	void RemoveProperty(const String& name);
@@ -453,6 +468,10 @@ public:
 	/// Sets the markup and content of the element. All existing children will be replaced.
 	/// @param[in] rml The new content of the element.
 	void SetInnerRML(const String& rml);
+	/// Returns true if the inner RML of the element is given by its child elements. Clone() then copies the element tree
+	/// directly, instead of generating and parsing the inner RML.
+	/// @note Elements overriding GetInnerRML() to produce other content must override this to return false.
+	virtual bool IsRMLDefinedByChildren() const;
 
 	//@}
 
@@ -582,6 +601,11 @@ public:
 	/// Return the computed values of the element's properties. These values are updated as appropriate on every Context::Update.
 	const ComputedValues& GetComputedValues() const;
 
+	/// Marks the cached layers of this element and its ancestors for re-rendering, see the 'render-cache' property. Property,
+	/// layout, and hierarchy changes do this automatically, custom elements must call this whenever their rendered output
+	/// otherwise changes.
+	void DirtyRenderCache();
+
 protected:
 	void Update(float dp_ratio, Vector2f vp_dimensions);
 	void Render();
@@ -596,6 +620,23 @@ protected:
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
+	/// Finds the bounds of everything the element renders itself, used to size the cached layers of the 'render-cache'
+	/// property, and to skip rendering elements outside the visible area, see IsCullable(). By default, these are given by
+	/// the element's border boxes. Elements rendering outside them from OnRender() must override this.
+	/// @param[out] bounds_min The top-left corner of the bounds, in context coordinates.
+	/// @param[out] bounds_max The bottom-right corner of the bounds, in context coordinates.
+	/// @return False if the bounds are not known, in which case the element is always rendered directly.
+	virtual bool GetRenderBounds(Vector2f& bounds_min, Vector2f& bounds_max);
+	/// Returns true if GetRenderBounds() covers everything rendered by OnRender(), so that the call to OnRender() can be
+	/// skipped while the bounds are outside the visible area. False by default, in which case only the background, border
+	/// and decorators are culled. Custom elements may override this to opt in to culling, after making sure that
+	/// GetRenderBounds() covers all their geometry.
+	virtual bool IsCullable() const;
+	/// Finds the visible area of the context, limited by the element's clipping region.
+	/// @param[out] visible_min The top-left corner of the visible area, in context coordinates.
+	/// @param[out] visible_max The bottom-right corner of the visible area, in context coordinates.
+	/// @return False if the area cannot be determined, such as for transformed elements.
+	bool GetVisibleArea(Vector2f& visible_min, Vector2f& visible_max);
 	/// Called during update if the element size has been changed.
 	virtual void OnResize();
 	/// Called during a layout operation, when the element is being positioned and sized.
@@ -604,6 +645,8 @@ protected:
 	virtual void OnDpRatioChange();
 	/// Called when the current document's compiled style sheet has been changed. This may result in changed sprites.
 	virtual void OnStyleSheetChange();
+	/// Called when textures have finished loading in the background, elements should regenerate any geometry using textures.
+	virtual void OnTexturesLoaded();
 
 	/// Called when attributes on the element are changed.
 	/// @param[in] changed_attributes Dictionary of attributes changed on the element. Attribute value will be empty if it was unset.
@@ -652,6 +695,17 @@ private:
 
 	void DirtyAbsoluteOffset();
 	void DirtyAbsoluteOffsetRecursive();
+	void DirtyClippingRegion();
+	// Notifies the hit test grid of our context that our geometry or hit testing properties changed, or if 'stacking_order'
+	// is set, that elements may have been added, removed, or re-ordered.
+	void DirtyHitTestGrid(bool stacking_order = false);
+	// Finds the union of the element's border boxes, in context coordinates.
+	void GetBorderBounds(Vector2f& bounds_min, Vector2f& bounds_max);
+	// Clears the flags of the parts of the element which are entirely outside the context and its clipping region, and thus
+	// can be skipped during rendering. The box covers the background, border and decorators, and the contents OnRender().
+	void UpdateCulling(bool& render_box, bool& render_contents);
+	// Renders the element itself and its local stacking context, either directly or into a cached layer.
+	void RenderContents();
 	void UpdateOffset();
 	void SetBaseline(float baseline);
 
@@ -663,10 +717,11 @@ private:
 	void DirtyStructure();
 	void UpdateStructure();
 
-	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
+	void DirtyTransformState(bool perspective_dirty, bool transform_dirty, bool local_transform_dirty = false);
 	void UpdateTransformState();
 
 	void OnDpRatioChangeRecursive();
+	void OnTexturesLoadedRecursive();
 
 	/// Start an animation, replacing any existing animations of the same property name. If start_value is null, the element's current value is used.
 	ElementAnimationList::iterator StartAnimation(PropertyId property_id, const Property * start_value, int num_iterations, bool alternate_direction, float delay, bool initiated_by_animation_property);
@@ -718,6 +773,16 @@ private:
 	Vector2f absolute_offset;
 	bool absolute_offset_dirty;
 
+	// The clipping regions applied to this element and to its children, cached by ElementUtilities::GetClippingRegion().
+	// When dirty, the clipping regions of all descendants are also dirty.
+	bool clip_dirty;
+	bool clip_enabled;
+	Vector2i clip_origin;
+	Vector2i clip_dimensions;
+	bool children_clip_enabled;
+	Vector2i children_clip_origin;
+	Vector2i children_clip_dimensions;
+
 	// The offset this element adds to its logical children due to scrolling content.
 	Vector2f scroll_offset;
 
@@ -759,6 +824,7 @@ private:
 	// Transform state
 	UniquePtr< TransformState > transform_state;
 	bool dirty_transform;
+	bool dirty_local_transform;
 	bool dirty_perspective;
 
 	ElementAnimationList animations;
@@ -773,6 +839,9 @@ private:
 	friend class Rml::LayoutBlockBox;
 	friend class Rml::LayoutInlineBox;
 	friend class Rml::ElementScroll;
+	friend class Rml::ElementLayer;
+	friend class Rml::ElementUtilities;
+	friend class Rml::HitTestGrid;
 };
 
 } // namespace Rml
@@ -88,13 +88,15 @@ public:
 	/// @note The style sheet may be regenerated when media query parameters change, invalidating the pointer.
 	const StyleSheet* GetStyleSheet() const override;
 	/// Reload the document's style sheet from source files.
-	/// Styles will be reloaded from <style> tags and external style sheets, but not inline 'style' attributes.
+	/// Styles will be reloaded from <style> tags and external style sheets, but not inline 'style' attributes. Only the
+	/// head of the document is read again, the elements keep their state and only those affected by changes are restyled.
 	/// @note The source url originally used to load the document must still be a valid RML document.
 	void ReloadStyleSheet();
 
 	/// Returns the document's style sheet container.
 	const StyleSheetContainer* GetStyleSheetContainer() const;
 	/// Sets the style sheet this document, and all of its children, uses.
+	/// When replacing a previous style sheet, only the elements affected by rules that differ between the sheets are restyled.
 	void SetStyleSheetContainer(SharedPtr<StyleSheetContainer> style_sheet);
 
 	/// Brings the document to the front of the document stack.
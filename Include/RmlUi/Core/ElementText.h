@@ -81,6 +81,8 @@ public:
 
 protected:
 	void OnRender() override;
+	bool GetRenderBounds(Vector2f& bounds_min, Vector2f& bounds_max) override;
+	bool IsCullable() const override;
 
 	void OnPropertyChange(const PropertyIdSet& properties) override;
 
@@ -116,6 +118,9 @@ private:
 	GeometryList geometry;
 	bool geometry_dirty;
 
+	// The bounds of the text and decoration geometry, relative to the element's offset. Includes any font effects.
+	Vector2f geometry_min, geometry_max;
+
 	Colourb colour;
 	float opacity;
 
@@ -138,6 +138,10 @@ public:
 	/// Right now, this only applies to the 'data-for' view.
 	/// @return True if a data view was constructed.
 	static bool ApplyStructuralDataViews(Element* element, const String& inner_rml);
+
+private:
+	// Updates the cached clipping regions applied to the given element and to its children, if dirty.
+	static void UpdateClippingRegion(Element* element);
 };
 
 } // namespace Rml
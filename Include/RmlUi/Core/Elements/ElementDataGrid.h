@@ -127,6 +127,8 @@ protected:
 	/// Gets the markup and content of the element.
 	/// @param content[out] The content of the element.
 	void GetInnerRML(String& content) const override;
+	/// Returns false, as the inner RML is generated from the state of the element.
+	bool IsRMLDefinedByChildren() const override;
 
 private:
 	typedef Vector< Column > ColumnList;
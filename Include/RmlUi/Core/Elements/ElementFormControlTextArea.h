@@ -114,6 +114,8 @@ protected:
 	/// Returns the text content of the element.
 	/// @param[out] content The content of the element.
 	void GetInnerRML(String& content) const override;
+	/// Returns false, as the inner RML is generated from the state of the element.
+	bool IsRMLDefinedByChildren() const override;
 
 private:
 	WidgetTextInput* widget;		
@@ -89,6 +89,8 @@ protected:
 
 	void OnPropertyChange(const PropertyIdSet& changed_properties) override;
 
+	void OnTexturesLoaded() override;
+
 private:
 	enum class Direction { Top, Right, Bottom, Left, Clockwise, CounterClockwise, Count };
 	enum class StartEdge { Top, Right, Bottom, Left, Count };
@@ -44,6 +44,24 @@ struct EventSpecification;
 enum class EventPhase { None, Capture = 1, Target = 2, Bubble = 4 };
 enum class DefaultActionPhase { None, Target = (int)EventPhase::Target, TargetAndBubble = ((int)Target | (int)EventPhase::Bubble) };
 
+/**
+	Typed parameters for the built-in input events. Events dispatched with these parameters only generate their
+	parameter dictionary when it is requested, thereby avoiding string operations for events nobody inspects.
+ */
+struct EventInputParameters {
+	enum Flags { MousePosition = 1 << 0, Button = 1 << 1, KeyModifiers = 1 << 2, KeyIdentifier = 1 << 3, DragElement = 1 << 4, WheelDelta = 1 << 5 };
+
+	// Combination of the above flags, specifying which of the following parameters are set.
+	int flags = 0;
+
+	Vector2i mouse_position = Vector2i(0, 0);
+	int button = 0;
+	int key_modifier_state = 0;
+	int key_identifier = 0;
+	Element* drag_element = nullptr;
+	float wheel_delta = 0.f;
+};
+
 /**
 	An event that propogates through the element hierarchy. Events follow the DOM3 event specification. See
 	http://www.w3.org/TR/DOM-Level-3-Events/events.html.
@@ -107,7 +125,7 @@ public:
 	template < typename T >
 	T GetParameter(const String& key, const T& default_value) const
 	{
-		return Get(parameters, key, default_value);
+		return Get(GetParameters(), key, default_value);
 	}
 	/// Access the dictionary of parameters
 	/// @return The dictionary of parameters
@@ -118,7 +136,9 @@ public:
 	Vector2f GetUnprojectedMouseScreenPos() const;
 
 protected:
-	Dictionary parameters;
+	// Generated on demand from the input parameters for events instanced by the default event instancer, see
+	// GetParameters(). For other instancers, the dictionary is already generated when the event is instanced.
+	mutable Dictionary parameters;
 
 	Element* target_element = nullptr;
 	Element* current_element = nullptr;
@@ -131,6 +151,13 @@ private:
 	/// Release this event through its instancer.
 	void Release() override;
 
+	/// Set the typed input parameters, they are converted to the parameter dictionary once it is requested.
+	void SetInputParameters(const EventInputParameters& input_parameters);
+	/// Write any pending input parameters to the parameter dictionary.
+	void GenerateInputParameters() const;
+	/// Write the given input parameters to a parameter dictionary.
+	static void GenerateInputParameters(const EventInputParameters& input_parameters, Dictionary& parameters);
+
 	String type;
 	EventId id = EventId::Invalid;
 	bool interruptible = false;
@@ -141,6 +168,9 @@ private:
 	bool has_mouse_position = false;
 	Vector2f mouse_screen_position = Vector2f(0, 0);
 
+	EventInputParameters input_parameters;
+	mutable bool input_parameters_pending = false;
+
 	EventPhase phase = EventPhase::None;
 
 	EventInstancer* instancer = nullptr;
@@ -53,7 +53,7 @@ public:
 	/// @param[in] target Target element of this event.
 	/// @param[in] id EventId of this event.
 	/// @param[in] name Name of this event.
-	/// @param[in] parameters Additional parameters for this event.
+	/// @param[in] parameters Additional parameters for this event. For custom instancers, this includes the parameters of input events.
 	/// @param[in] interruptible If the event propagation can be stopped.
 	virtual EventPtr InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible) = 0;
 
@@ -34,6 +34,7 @@
 
 namespace Rml {
 
+class CompiledDocument;
 class Context;
 class ContextInstancer;
 class DataControllerInstancer;
@@ -49,6 +50,7 @@ class EventListener;
 class EventListenerInstancer;
 class FontEffect;
 class FontEffectInstancer;
+struct EventInputParameters;
 class StyleSheetContainer;
 class PropertyDictionary;
 class PropertySpecification;
@@ -115,6 +117,26 @@ public:
 	/// @param[in] document_base_tag The tag used to wrap the document, eg. 'rml'.
 	/// @return The instanced document, or nullptr if an error occurred.
 	static ElementPtr InstanceDocumentStream(Context* context, Stream* stream, const String& document_base_tag);
+	/// Compiles a document into a binary form, which can later be instanced without parsing its RML.
+	/// @param[out] data The compiled document, appended to.
+	/// @param[in] document_rml The RML source of the document.
+	/// @param[in] source_url The source URL of the document.
+	static void CompileDocument(String& data, const String& document_rml, const String& source_url);
+	/// Instances a document from its compiled form, see CompileDocument().
+	/// @param[in] context The context that is creating the document.
+	/// @param[in] data The compiled document.
+	/// @param[in] source_url The source URL of the document, used for resolving relative paths and for log messages.
+	/// @param[in] document_rml The current RML source of the document if available, the compiled document is rejected if it was compiled from a different source.
+	/// @param[in] document_base_tag The tag used to wrap the document, eg. 'rml'.
+	/// @return The instanced document, or nullptr if the compiled document is invalid or stale.
+	static ElementPtr InstanceDocumentCompiled(Context* context, const String& data, const String& source_url, const String* document_rml,
+		const String& document_base_tag);
+	/// Instances a document from a compiled document which has already been read or preloaded.
+	/// @param[in] context The context that is creating the document.
+	/// @param[in] compiled_document The compiled document.
+	/// @param[in] document_base_tag The tag used to wrap the document, eg. 'rml'.
+	/// @return The instanced document, or nullptr if an error occurred.
+	static ElementPtr InstanceDocumentCompiled(Context* context, const CompiledDocument& compiled_document, const String& document_base_tag);
 
 	/// Registers a non-owning pointer to an instancer that will be used to instance decorators.
 	/// @param[in] name The name of the decorator the instancer will be called for.
@@ -166,6 +188,13 @@ public:
 	/// @param[in] interruptible If the event propagation can be stopped.
 	/// @return The instanced event.
 	static EventPtr InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible);
+	/// Instance an event object with typed input parameters, these are converted to the event's parameter dictionary only when requested.
+	/// @param[in] target Target element of this event.
+	/// @param[in] name Name of this event.
+	/// @param[in] input_parameters The input parameters for this event.
+	/// @param[in] interruptible If the event propagation can be stopped.
+	/// @return The instanced event.
+	static EventPtr InstanceEvent(Element* target, EventId id, const String& type, const EventInputParameters& input_parameters, bool interruptible);
 
 	/// Register the instancer to be used for all event listeners, or nullptr to clear an existing instancer.
 	/// @lifetime The instancer must be kept alive until after the call to Rml::Shutdown, or until a new instancer is set.
@@ -205,6 +234,8 @@ public:
 private:
 	Factory();
 	~Factory();
+
+	static ElementPtr InstanceDocumentElement(Context* context, const String& document_base_tag);
 };
 
 } // namespace Rml
@@ -87,6 +87,13 @@ public:
 	/// @param out_data The string contents of the file.
 	/// @return True on success.
 	virtual bool LoadFile(const String& path, String& out_data);
+
+	/// Retrieves the time a file was last modified, used for detecting changed style sheets, see Rml::ReloadModifiedStyleSheets().
+	/// The default implementation does not support modification times.
+	/// @param path The path to the file.
+	/// @param out_time A value which changes whenever the file is modified, only compared for equality.
+	/// @return True on success, false if the file does not exist or modification times are not supported.
+	virtual bool GetModificationTime(const String& path, uint64_t& out_time);
 };
 
 } // namespace Rml
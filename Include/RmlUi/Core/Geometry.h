@@ -37,9 +37,11 @@ namespace Rml {
 
 class Context;
 class Element;
+class GeometryArena;
 class RenderInterface;
 struct Texture;
 using GeometryDatabaseHandle = uint32_t;
+using GeometryArenaHandle = uint32_t;
 
 /**
 	A helper object for holding an array of vertices and indices, and compiling it as necessary when rendered.
@@ -82,6 +84,11 @@ public:
 	/// Sets the geometry's texture.
 	void SetTexture(const Texture* texture);
 
+	/// Replaces the geometry's vertices while keeping its indices. Prefer this over writing to the vertices and calling
+	/// Release() when only the vertex data changes, as the geometry can then be updated in place where supported.
+	/// @param[in] new_vertices The new vertices, must contain the same number of vertices as the geometry.
+	void UpdateVertices(const Vector< Vertex >& new_vertices);
+
 	/// Releases any previously-compiled geometry, and forces any new geometry to have a compile attempted.
 	/// @param[in] clear_buffers True to also clear the vertex and index buffers, false to leave intact.
 	void Release(bool clear_buffers = false);
@@ -96,6 +103,12 @@ private:
 	// Returns the host context's render interface.
 	RenderInterface* GetRenderInterface();
 
+	// Generates the compact form of our vertices and indices, see RenderInterface::SupportsCompactGeometry().
+	void GenerateCompactGeometry();
+
+	// Moves the geometry out of the arena and back into our own buffers, if it was placed there.
+	void ReleaseArena(bool read_back);
+
 	Context* host_context = nullptr;
 	Element* host_element = nullptr;
 
@@ -104,8 +117,19 @@ private:
 	const Texture* texture = nullptr;
 
 	CompiledGeometryHandle compiled_geometry = 0;
+	// The texture handle the geometry was compiled with, textures may be reloaded with a new handle.
+	TextureHandle compiled_texture = 0;
 	bool compile_attempted = false;
 
+	// Compact copies of the vertices and indices, only generated when supported by the render interface.
+	Vector< CompactVertex > compact_vertices;
+	Vector< UntexturedVertex > untextured_vertices;
+	Vector< uint16_t > compact_indices;
+
+	// When placed in the geometry arena of our host context, our own buffers are emptied and the data is only stored in the arena.
+	GeometryArena* arena = nullptr;
+	GeometryArenaHandle arena_handle = 0;
+
 	GeometryDatabaseHandle database_handle;
 };
 
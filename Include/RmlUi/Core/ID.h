@@ -155,6 +155,7 @@ enum class PropertyId : uint8_t
 	Opacity,
 	PointerEvents,
 	Focus,
+	RenderCache,
 
 	Decorator,
 	FontEffect,
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_MATH_H
 
 #include "Header.h"
+#include <stdint.h>
 #include <type_traits>
 
 namespace Rml {
@@ -213,6 +214,15 @@ RMLUICORE_API int ToPowerOfTwo(int value);
 /// @return The digit in decimal.
 RMLUICORE_API int HexToDecimal(char hex_digit);
 
+/// Converts a floating-point value to IEEE 754 half-precision, rounding to the nearest representable value.
+/// @param[in] value The value to convert.
+/// @return The bits of the half-precision value.
+RMLUICORE_API uint16_t FloatToHalf(float value);
+/// Converts an IEEE 754 half-precision value to a floating-point value.
+/// @param[in] value The bits of the half-precision value.
+/// @return The floating-point value.
+RMLUICORE_API float HalfToFloat(uint16_t value);
+
 /// Generates a random floating-point value between 0 and a user-specified value.
 /// @param[in] max_value The limit to random value. The generated value will be guaranteed to be below this limit.
 /// @return The random value.
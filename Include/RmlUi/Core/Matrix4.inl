@@ -26,8 +26,142 @@
  *
  */
 
+#ifdef RMLUI_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#include <type_traits>
+
 namespace Rml {
 
+namespace Detail {
+
+// Vectorized kernels for float matrices. The generic overloads return false to indicate that the scalar implementation should be used instead.
+
+template< typename Component >
+inline bool Matrix4Multiply(Component* /*out*/, const Component* /*vectors*/, const Component* /*weights*/) noexcept
+{
+	return false;
+}
+
+template< typename Component >
+inline bool Matrix4Invert(Component* /*data*/, bool& /*success*/) noexcept
+{
+	return false;
+}
+
+#ifdef RMLUI_SIMD_SSE2
+
+template< int x, int y, int z, int w >
+inline __m128 Matrix4Shuffle(__m128 a, __m128 b) noexcept
+{
+	return _mm_shuffle_ps(a, b, x | (y << 2) | (z << 4) | (w << 6));
+}
+
+template< int x, int y, int z, int w >
+inline __m128 Matrix4Swizzle(__m128 v) noexcept
+{
+	return Matrix4Shuffle< x, y, z, w >(v, v);
+}
+
+// Operations on 2x2 row-major matrices, where '#' denotes the adjugate: A*B, A#*B, and A*B#.
+inline __m128 Matrix2Mul(__m128 a, __m128 b) noexcept
+{
+	return _mm_add_ps(_mm_mul_ps(a, Matrix4Swizzle< 0, 3, 0, 3 >(b)), _mm_mul_ps(Matrix4Swizzle< 1, 0, 3, 2 >(a), Matrix4Swizzle< 2, 1, 2, 1 >(b)));
+}
+inline __m128 Matrix2AdjMul(__m128 a, __m128 b) noexcept
+{
+	return _mm_sub_ps(_mm_mul_ps(Matrix4Swizzle< 3, 3, 0, 0 >(a), b), _mm_mul_ps(Matrix4Swizzle< 1, 1, 2, 2 >(a), Matrix4Swizzle< 2, 3, 0, 1 >(b)));
+}
+inline __m128 Matrix2MulAdj(__m128 a, __m128 b) noexcept
+{
+	return _mm_sub_ps(_mm_mul_ps(a, Matrix4Swizzle< 3, 0, 3, 0 >(b)), _mm_mul_ps(Matrix4Swizzle< 1, 0, 3, 2 >(a), Matrix4Swizzle< 2, 1, 2, 1 >(b)));
+}
+
+// Writes each of the four output vectors as the sum of the input vectors, weighted by the corresponding four weights.
+// With column-major storage this computes lhs * rhs as (out, lhs, rhs), and with row-major storage as (out, rhs, lhs).
+inline bool Matrix4Multiply(float* out, const float* vectors, const float* weights) noexcept
+{
+	const __m128 v0 = _mm_loadu_ps(vectors);
+	const __m128 v1 = _mm_loadu_ps(vectors + 4);
+	const __m128 v2 = _mm_loadu_ps(vectors + 8);
+	const __m128 v3 = _mm_loadu_ps(vectors + 12);
+
+	for (int i = 0; i < 4; i++)
+	{
+		const float* w = weights + 4 * i;
+		__m128 result = _mm_mul_ps(v0, _mm_set1_ps(w[0]));
+		result = _mm_add_ps(result, _mm_mul_ps(v1, _mm_set1_ps(w[1])));
+		result = _mm_add_ps(result, _mm_mul_ps(v2, _mm_set1_ps(w[2])));
+		result = _mm_add_ps(result, _mm_mul_ps(v3, _mm_set1_ps(w[3])));
+		_mm_storeu_ps(out + 4 * i, result);
+	}
+
+	return true;
+}
+
+// Inverts the matrix by splitting it into 2x2 blocks. The data is treated as row-major, which also works for column-major storage
+// since the inverse of the transpose is the transpose of the inverse.
+inline bool Matrix4Invert(float* data, bool& success) noexcept
+{
+	const __m128 r0 = _mm_loadu_ps(data);
+	const __m128 r1 = _mm_loadu_ps(data + 4);
+	const __m128 r2 = _mm_loadu_ps(data + 8);
+	const __m128 r3 = _mm_loadu_ps(data + 12);
+
+	// The sub-matrices | A B |
+	//                  | C D |
+	const __m128 A = _mm_movelh_ps(r0, r1);
+	const __m128 B = _mm_movehl_ps(r1, r0);
+	const __m128 C = _mm_movelh_ps(r2, r3);
+	const __m128 D = _mm_movehl_ps(r3, r2);
+
+	// Determinants of the sub-matrices as (|A|, |B|, |C|, |D|).
+	const __m128 det_sub = _mm_sub_ps(_mm_mul_ps(Matrix4Shuffle< 0, 2, 0, 2 >(r0, r2), Matrix4Shuffle< 1, 3, 1, 3 >(r1, r3)),
+		_mm_mul_ps(Matrix4Shuffle< 1, 3, 1, 3 >(r0, r2), Matrix4Shuffle< 0, 2, 0, 2 >(r1, r3)));
+	const __m128 det_A = Matrix4Swizzle< 0, 0, 0, 0 >(det_sub);
+	const __m128 det_B = Matrix4Swizzle< 1, 1, 1, 1 >(det_sub);
+	const __m128 det_C = Matrix4Swizzle< 2, 2, 2, 2 >(det_sub);
+	const __m128 det_D = Matrix4Swizzle< 3, 3, 3, 3 >(det_sub);
+
+	const __m128 D_C = Matrix2AdjMul(D, C);
+	const __m128 A_B = Matrix2AdjMul(A, B);
+
+	// The adjugates of the blocks of the inverse, before scaling by the determinant.
+	__m128 X = _mm_sub_ps(_mm_mul_ps(det_D, A), Matrix2Mul(B, D_C));
+	__m128 W = _mm_sub_ps(_mm_mul_ps(det_A, D), Matrix2Mul(C, A_B));
+	__m128 Y = _mm_sub_ps(_mm_mul_ps(det_B, C), Matrix2MulAdj(D, A_B));
+	__m128 Z = _mm_sub_ps(_mm_mul_ps(det_C, B), Matrix2MulAdj(A, D_C));
+
+	// |M| = |A|*|D| + |B|*|C| - tr((A#B)(D#C))
+	__m128 trace = _mm_mul_ps(A_B, Matrix4Swizzle< 0, 2, 1, 3 >(D_C));
+	trace = _mm_add_ps(trace, Matrix4Swizzle< 1, 0, 3, 2 >(trace));
+	trace = _mm_add_ps(trace, Matrix4Swizzle< 2, 3, 0, 1 >(trace));
+
+	const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(det_A, det_D), _mm_mul_ps(det_B, det_C)), trace);
+
+	success = (_mm_cvtss_f32(det) != 0.f);
+	if (!success)
+		return true;
+
+	const __m128 det_inverse = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), det);
+	X = _mm_mul_ps(X, det_inverse);
+	Y = _mm_mul_ps(Y, det_inverse);
+	Z = _mm_mul_ps(Z, det_inverse);
+	W = _mm_mul_ps(W, det_inverse);
+
+	// Apply the final adjugate while storing the blocks.
+	_mm_storeu_ps(data, Matrix4Shuffle< 3, 1, 3, 1 >(X, Y));
+	_mm_storeu_ps(data + 4, Matrix4Shuffle< 2, 0, 2, 0 >(X, Y));
+	_mm_storeu_ps(data + 8, Matrix4Shuffle< 3, 1, 3, 1 >(Z, W));
+	_mm_storeu_ps(data + 12, Matrix4Shuffle< 2, 0, 2, 0 >(Z, W));
+
+	return true;
+}
+
+#endif
+
+} // namespace Detail
+
 // Initialising constructor.
 template< typename Component, class Storage >
 Matrix4< Component, Storage >::Matrix4(
@@ -179,6 +313,10 @@ void Matrix4< Component, Storage >::SetColumns(const VectorType& vec0, const Vec
 template< typename Component, class Storage >
 bool Matrix4< Component, Storage >::Invert() noexcept
 {
+	bool success = false;
+	if (Detail::Matrix4Invert(data(), success))
+		return success;
+
 	Matrix4< Component, Storage >::ThisType result;
 	Component *dst = result.data();
 	const Component *src = data();
@@ -795,6 +933,9 @@ struct Matrix4< Component, Storage >::MatrixMultiplier< _Component, RowMajorStor
 	static const MatrixAType Multiply(const MatrixAType& lhs, const MatrixBType& rhs) noexcept
 	{
 		typename MatrixAType::ThisType result;
+		if (std::is_same< StorageAType, StorageBType >::value && Detail::Matrix4Multiply(result.data(), rhs.data(), lhs.data()))
+			return result;
+
 		typename MatrixAType::Rows result_rows(result.vectors);
 		typename MatrixAType::ConstRows lhs_rows(lhs.vectors);
 		typename MatrixBType::ConstColumns rhs_columns(rhs.vectors);
@@ -822,6 +963,9 @@ struct Matrix4< Component, Storage >::MatrixMultiplier< _Component, ColumnMajorS
 	static const MatrixAType Multiply(const MatrixAType& lhs, const MatrixBType& rhs) noexcept
 	{
 		typename MatrixAType::ThisType result;
+		if (Detail::Matrix4Multiply(result.data(), lhs.data(), rhs.data()))
+			return result;
+
 		typename MatrixAType::Rows result_rows(result.vectors);
 		typename MatrixAType::ConstRows lhs_rows(lhs.vectors);
 		typename MatrixBType::ConstColumns rhs_columns(rhs.vectors);
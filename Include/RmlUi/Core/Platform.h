@@ -52,6 +52,13 @@
     #define RMLUI_ARCH_32
 #endif
 
+// SIMD instructions are used for some math and parsing routines when available, define RMLUI_NO_SIMD to disable.
+#if !defined RMLUI_NO_SIMD && (defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2))
+    #define RMLUI_SIMD_SSE2
+#elif !defined RMLUI_NO_SIMD && (defined __ARM_NEON || defined _M_ARM64)
+    #define RMLUI_SIMD_NEON
+#endif
+
 
 #if defined(RMLUI_PLATFORM_WIN32) && !defined(__MINGW32__)
 	// declaration of 'identifier' hides class member
@@ -37,6 +37,7 @@
 namespace Rml {
 
 class StyleSheetSpecification;
+class PropertyDeclarationCache;
 class PropertyDefinition;
 class PropertyDictionary;
 class PropertyIdNameMap;
@@ -136,6 +137,10 @@ private:
 	PropertyIdSet property_ids_inherited;
 	PropertyIdSet property_ids_forcing_layout;
 
+	// Optional cache of parsed declarations by name and value, only enabled for the main style sheet specification.
+	UniquePtr<PropertyDeclarationCache> declaration_cache;
+
+	bool ParseDeclaration(PropertyDictionary& dictionary, const String& property_name, const String& property_value) const;
 	bool ParsePropertyValues(StringList& values_list, const String& values, bool split_values) const;
 
 	friend class Rml::StyleSheetSpecification;
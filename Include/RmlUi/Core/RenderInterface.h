@@ -62,6 +62,34 @@ public:
 	/// @param[in] translation The translation to apply to the geometry.
 	virtual void RenderGeometry(Vertex* vertices, int num_vertices, int* indices, int num_indices, TextureHandle texture, const Vector2f& translation) = 0;
 
+	/// Called by RmlUi to determine whether uncompiled geometry should be rendered in compact form through
+	/// RenderCompactGeometry() and RenderUntexturedGeometry(), rather than through RenderGeometry(). Compact geometry uses
+	/// 16-bit indices, half-precision texture coordinates, and leaves out texture coordinates for untextured geometry. Only
+	/// geometry with at most 65536 vertices is rendered in compact form. Textured geometry with any texture coordinate
+	/// outside [0, 1], such as repeated images, is always rendered through RenderGeometry() to keep their full precision.
+	/// Queried for each geometry when first rendered.
+	/// @return True to enable compact geometry.
+	virtual bool SupportsCompactGeometry();
+	/// Called by RmlUi when it wants to render textured geometry in compact form, see SupportsCompactGeometry().
+	/// The default implementation expands the geometry and renders it through RenderGeometry().
+	/// @param[in] vertices The geometry's vertex data.
+	/// @param[in] num_vertices The number of vertices passed to the function.
+	/// @param[in] indices The geometry's index data.
+	/// @param[in] num_indices The number of indices passed to the function. This will always be a multiple of three.
+	/// @param[in] texture The texture to be applied to the geometry. This may be nullptr if the texture failed to load.
+	/// @param[in] translation The translation to apply to the geometry.
+	virtual void RenderCompactGeometry(const CompactVertex* vertices, int num_vertices, const uint16_t* indices, int num_indices, TextureHandle texture,
+		const Vector2f& translation);
+	/// Called by RmlUi when it wants to render untextured geometry in compact form, see SupportsCompactGeometry().
+	/// The default implementation expands the geometry and renders it through RenderGeometry().
+	/// @param[in] vertices The geometry's vertex data.
+	/// @param[in] num_vertices The number of vertices passed to the function.
+	/// @param[in] indices The geometry's index data.
+	/// @param[in] num_indices The number of indices passed to the function. This will always be a multiple of three.
+	/// @param[in] translation The translation to apply to the geometry.
+	virtual void RenderUntexturedGeometry(const UntexturedVertex* vertices, int num_vertices, const uint16_t* indices, int num_indices,
+		const Vector2f& translation);
+
 	/// Called by RmlUi when it wants to compile geometry it believes will be static for the forseeable future.
 	/// If supported, this should return a handle to an optimised, application-specific version of the data. If
 	/// not, do not override the function or return zero; the simpler RenderGeometry() will be called instead.
@@ -80,6 +108,38 @@ public:
 	/// @param[in] geometry The application-specific compiled geometry to release.
 	virtual void ReleaseCompiledGeometry(CompiledGeometryHandle geometry);
 
+	/// Called by RmlUi when it wants to create a persistent buffer for storing geometry. If supported, geometry is packed
+	/// into a small number of large buffers and rendered by offsets into them, taking precedence over CompileGeometry().
+	/// If not, do not override the function or return false.
+	/// @param[out] buffer The handle to write the application-specific buffer handle to.
+	/// @param[in] vertex_capacity The number of vertices the buffer must be able to hold.
+	/// @param[in] index_capacity The number of indices the buffer must be able to hold.
+	/// @return True if the buffer was created, false if not.
+	virtual bool CreateGeometryBuffer(GeometryBufferHandle& buffer, int vertex_capacity, int index_capacity);
+	/// Called by RmlUi when it wants to write to a range of vertices and indices in a geometry buffer. All changes made
+	/// since the previous render from the buffer are written in a single call, right before rendering from it again.
+	/// @param[in] buffer The buffer to update.
+	/// @param[in] vertex_offset The index of the first vertex to write.
+	/// @param[in] vertices The vertex data to write.
+	/// @param[in] num_vertices The number of vertices to write, may be zero.
+	/// @param[in] index_offset The position of the first index to write.
+	/// @param[in] indices The index data to write.
+	/// @param[in] num_indices The number of indices to write, may be zero.
+	virtual void UpdateGeometryBuffer(GeometryBufferHandle buffer, int vertex_offset, const Vertex* vertices, int num_vertices, int index_offset,
+		const int* indices, int num_indices);
+	/// Called by RmlUi when it wants to render a range of geometry from a geometry buffer.
+	/// @param[in] buffer The buffer to render from.
+	/// @param[in] base_vertex The offset to add to each index to find the vertex it refers to.
+	/// @param[in] index_offset The position of the first index to render.
+	/// @param[in] num_indices The number of indices to render. This will always be a multiple of three.
+	/// @param[in] texture The texture to be applied to the geometry. This may be nullptr, in which case the geometry is untextured.
+	/// @param[in] translation The translation to apply to the geometry.
+	virtual void RenderGeometryBuffer(GeometryBufferHandle buffer, int base_vertex, int index_offset, int num_indices, TextureHandle texture,
+		const Vector2f& translation);
+	/// Called by RmlUi when it wants to release a geometry buffer.
+	/// @param[in] buffer The buffer to release.
+	virtual void ReleaseGeometryBuffer(GeometryBufferHandle buffer);
+
 	/// Called by RmlUi when it wants to enable or disable scissoring to clip content.
 	/// @param[in] enable True if scissoring is to enabled, false if it is to be disabled.
 	virtual void EnableScissorRegion(bool enable) = 0;
@@ -102,10 +162,43 @@ public:
 	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
 	/// @return True if the texture generation succeeded and the handle is valid, false if not.
 	virtual bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
+	/// Called by RmlUi when it wants to replace a region of a texture created through GenerateTexture(), used to pack
+	/// small textures into a texture atlas, see Rml::SetTextureAtlas().
+	/// If not supported, do not override the function or return false; the textures will then be generated separately.
+	/// @param[in] texture_handle The texture to update.
+	/// @param[in] source The raw 8-bit texture data to write into the region, in the same format as for GenerateTexture().
+	/// @param[in] origin The top-left corner of the region to replace, in pixels.
+	/// @param[in] dimensions The dimensions of the region, and of the source data, in pixels.
+	/// @return True if the region was updated, false if not.
+	virtual bool UpdateTexture(TextureHandle texture_handle, const byte* source, Vector2i origin, Vector2i dimensions);
+	/// Called by RmlUi when it wants the pixel data of a texture source, instead of a handle, used to pack small textures
+	/// into a texture atlas. Only called when the texture atlas is enabled.
+	/// If not supported, do not override the function or return false; the texture will then be loaded through LoadTexture().
+	/// @param[out] data The raw 8-bit texture data, in the same format as for GenerateTexture().
+	/// @param[out] dimensions The dimensions of the loaded texture, in pixels.
+	/// @param[in] source The application-defined image source, joined with the path of the referencing document.
+	/// @return True if the data was loaded, false if not.
+	virtual bool LoadTextureData(UniquePtr<const byte[]>& data, Vector2i& dimensions, const String& source);
 	/// Called by RmlUi when a loaded texture is no longer required.
 	/// @param texture The texture handle to release.
 	virtual void ReleaseTexture(TextureHandle texture);
 
+	/// Called by RmlUi when it wants to redirect rendering into a new texture, used to cache the rendering of elements with
+	/// the 'render-cache: layer' property. All subsequent rendering should be placed into the texture until the matching
+	/// call to EndRenderToTexture(). Geometry is still submitted in context coordinates, and the texture should capture
+	/// the given region of the context. The texture coordinates (0, 0) and (1, 1) refer to the top-left and bottom-right
+	/// corners of the region, respectively. The texture is released through ReleaseTexture() when no longer needed. Calls
+	/// may be nested when layers are placed within other layers.
+	/// If not supported, do not override the function or return false; the elements will then be rendered directly.
+	/// @param[out] texture_handle The handle to write the texture handle for the new render target to.
+	/// @param[in] origin The top-left corner of the region to capture, in context coordinates.
+	/// @param[in] dimensions The dimensions of the region to capture, and thus of the texture, in pixels.
+	/// @return True if rendering was redirected to the texture, false if not.
+	virtual bool BeginRenderToTexture(TextureHandle& texture_handle, Vector2i origin, Vector2i dimensions);
+	/// Called by RmlUi when rendering into the texture started by BeginRenderToTexture() is complete, subsequent rendering
+	/// should be directed back to the previous render target.
+	virtual void EndRenderToTexture();
+
 	/// Called by RmlUi when it wants the renderer to use a new transform matrix.
 	/// This will only be called if 'transform' properties are encountered. If no transform applies to the current element, nullptr
 	/// is submitted. Then it expects the renderer to use an identity matrix or otherwise omit the multiplication with the transform.
@@ -119,6 +212,10 @@ public:
 private:
 	Context* context;
 
+	// Scratch buffers for expanding compact geometry in the default implementations, reused between calls.
+	Vector<Vertex> expanded_vertices;
+	Vector<int> expanded_indices;
+
 	friend class Rml::Context;
 };
 
@@ -34,6 +34,8 @@
 namespace Rml {
 
 struct Spritesheet;
+class StyleSheet;
+class StyleSheetBinary;
 
 
 struct Rectangle {
@@ -91,6 +93,9 @@ private:
 
 	Spritesheets spritesheets;
 	SpriteMap sprite_map;
+
+	friend class Rml::StyleSheet;
+	friend class Rml::StyleSheetBinary;
 };
 
 
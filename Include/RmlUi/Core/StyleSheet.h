@@ -45,6 +45,7 @@ class SpritesheetList;
 class Stream;
 class StyleSheetContainer;
 class StyleSheetParser;
+class StyleSheetBinary;
 struct PropertySource;
 struct Sprite;
 struct Spritesheet;
@@ -72,6 +73,15 @@ public:
 	/// Builds the node index for a combined style sheet.
 	void BuildNodeIndex();
 
+	/// Finds the nodes whose properties differ between this and a previous version of the style sheet, such as after
+	/// reloading it. Nodes present in only one of the sheets are included.
+	/// @param[in] previous The previous style sheet, its nodes may be referenced by the index.
+	/// @param[out] changed_node_index The index of changed nodes, for use with IsAnyNodeApplicable().
+	/// @return False if the sheets also differ in their keyframes, decorators, or sprites, which may affect any element.
+	bool GetChangedNodes(const StyleSheet& previous, NodeIndex& changed_node_index) const;
+	/// Returns true if any of the nodes in the index apply to the given element.
+	static bool IsAnyNodeApplicable(const NodeIndex& node_index, const Element* element);
+
 	/// Returns the Keyframes of the given name, or null if it does not exist.
 	/// @lifetime The returned pointer becomes invalidated whenever the style sheet is re-generated. Do not store this pointer or references to subobjects around.
 	const Keyframes* GetKeyframes(const String& name) const;
@@ -123,6 +133,7 @@ private:
 	mutable DecoratorCache decorator_cache;
 
 	friend Rml::StyleSheetParser;
+	friend Rml::StyleSheetBinary;
 	friend Rml::StyleSheetContainer;
 };
 
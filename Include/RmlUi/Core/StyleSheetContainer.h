@@ -53,9 +53,23 @@ public:
 	/// Loads a style from a CSS definition.
 	bool LoadStyleSheetContainer(Stream* stream, int begin_line_number = 1);
 
+	/// Loads a style from its precompiled binary form, as produced by SaveCompiledStyleSheetContainer().
+	/// @param[in] data The precompiled binary data.
+	/// @param[in] source_path The path of the original style sheet, used for resolving relative paths.
+	/// @param[in] source The original style sheet source if available, the data is rejected if it was compiled from a different source.
+	/// @return True on success, false if the data is invalid or stale.
+	bool LoadCompiledStyleSheetContainer(const String& data, const String& source_path, const String* source = nullptr);
+
+	/// Writes the style in a precompiled binary form, which can later be loaded without parsing.
+	/// @param[out] data The binary data.
+	/// @param[in] source The style sheet source this container was loaded from, used for detecting stale data.
+	/// @return True on success, false if the style contains values that cannot be precompiled.
+	bool SaveCompiledStyleSheetContainer(String& data, const String& source) const;
+
 	/// Compiles a single style sheet by combining all contained style sheets whose media queries match the current state of the context.
 	/// @param[in] context The current context used for evaluating media query parameters against.
 	/// @returns True when the compiled style sheet was changed, otherwise false.
+	/// @note Compiled style sheets are shared between all containers with the same set of active style sheets, and must not be modified.
 	/// @warning This operation invalidates all references to the previously compiled style sheet.
 	bool UpdateCompiledStyleSheet(const Context* context);
 
@@ -68,11 +82,20 @@ public:
 	/// Merge another style sheet container into this.
 	void MergeStyleSheetContainer(const StyleSheetContainer& container);
 
+	/// Produces a new container where the style sheets merged from one container are replaced by those of another, such
+	/// as when a linked style sheet file has been reloaded.
+	/// @param[in] previous The container whose style sheets should be replaced.
+	/// @param[in] replacement The container providing the new style sheets.
+	/// @return The new container, or nullptr if the style sheets of the previous container are not part of this one.
+	SharedPtr<StyleSheetContainer> ReplaceStyleSheetContainer(const StyleSheetContainer& previous, const StyleSheetContainer& replacement) const;
+
 private:
+	// Makes sure the container has at least one media block, so that its style sheets can be located even when empty.
+	void AddEmptyMediaBlockIfEmpty();
+
 	MediaBlockList media_blocks;
 
-	StyleSheet* compiled_style_sheet = nullptr;
-	UniquePtr<StyleSheet> combined_compiled_style_sheet;
+	SharedPtr<StyleSheet> compiled_style_sheet;
 	Vector<int> active_media_block_indices;
 };
 
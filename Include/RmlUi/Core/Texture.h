@@ -77,6 +77,16 @@ public:
 	/// @param[in] The render interface that is requesting the dimensions.
 	/// @return The texture's dimensions. This will be (0, 0) if the texture isn't loaded.
 	Vector2i GetDimensions(RenderInterface* render_interface) const;
+	/// Returns the region of the texture handle occupied by this texture, in normalized texture coordinates. This is the
+	/// whole texture unless it has been packed into a texture atlas, then any texture coordinates must be mapped into it.
+	/// @param[in] The render interface that is requesting the region.
+	/// @param[out] top_left The texture coordinates of the top-left corner of the texture.
+	/// @param[out] bottom_right The texture coordinates of the bottom-right corner of the texture.
+	void GetTexCoords(RenderInterface* render_interface, Vector2f& top_left, Vector2f& bottom_right) const;
+	/// Returns true while the texture is being loaded in the background, see Rml::SetAsyncTextureLoading(). Its handle
+	/// and dimensions are then empty, and geometry using the texture is not rendered.
+	/// @param[in] The render interface that is loading the texture.
+	bool IsLoading(RenderInterface* render_interface) const;
 
 	/// Returns true if the texture points to the same underlying resource.
 	bool operator==(const Texture&) const;
@@ -50,5 +50,31 @@ struct RMLUICORE_API Vertex
 	Vector2f tex_coord;
 };
 
+/**
+	Compact vertex for textured geometry, see RenderInterface::RenderCompactGeometry().
+ */
+
+struct RMLUICORE_API CompactVertex
+{
+	/// Two-dimensional position of the vertex (usually in pixels).
+	Vector2f position;
+	/// RGBA-ordered 8-bit / channel colour.
+	Colourb colour;
+	/// Texture coordinate as IEEE 754 half-precision values, see Math::HalfToFloat().
+	uint16_t tex_coord[2];
+};
+
+/**
+	Compact vertex for untextured geometry, see RenderInterface::RenderUntexturedGeometry().
+ */
+
+struct RMLUICORE_API UntexturedVertex
+{
+	/// Two-dimensional position of the vertex (usually in pixels).
+	Vector2f position;
+	/// RGBA-ordered 8-bit / channel colour.
+	Colourb colour;
+};
+
 } // namespace Rml
 #endif
@@ -58,6 +58,9 @@ public:
 	/// Returns the current position of the file pointer.		
 	size_t Tell(Rml::FileHandle file) override;
 
+	/// Retrieves the time a file was last modified.
+	bool GetModificationTime(const Rml::String& path, uint64_t& out_time) override;
+
 private:
 	Rml::String root;
 };
@@ -62,6 +62,10 @@ public:
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	/// Called by RmlUi when it wants to replace a region of a generated texture.
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, Rml::Vector2i origin, Rml::Vector2i dimensions) override;
+	/// Called by RmlUi when it wants the pixel data of a texture source.
+	bool LoadTextureData(Rml::UniquePtr<const Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source) override;
 	/// Called by RmlUi when a loaded texture is no longer required.
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
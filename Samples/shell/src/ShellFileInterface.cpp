@@ -28,6 +28,7 @@
 
 #include <ShellFileInterface.h>
 #include <stdio.h>
+#include <sys/stat.h>
 
 ShellFileInterface::ShellFileInterface(const Rml::String& root) : root(root)
 {
@@ -73,3 +74,25 @@ size_t ShellFileInterface::Tell(Rml::FileHandle file)
 {
 	return ftell((FILE*) file);
 }
+
+// Retrieves the time a file was last modified.
+bool ShellFileInterface::GetModificationTime(const Rml::String& path, uint64_t& out_time)
+{
+#if defined(RMLUI_PLATFORM_WIN32)
+	struct _stat64 info;
+	if (_stat64((root + path).c_str(), &info) != 0 && _stat64(path.c_str(), &info) != 0)
+		return false;
+	out_time = (uint64_t)info.st_mtime;
+#elif defined(RMLUI_PLATFORM_MACOSX)
+	struct stat info;
+	if (stat((root + path).c_str(), &info) != 0 && stat(path.c_str(), &info) != 0)
+		return false;
+	out_time = (uint64_t)info.st_mtimespec.tv_sec * 1000000000ull + (uint64_t)info.st_mtimespec.tv_nsec;
+#else
+	struct stat info;
+	if (stat((root + path).c_str(), &info) != 0 && stat(path.c_str(), &info) != 0)
+		return false;
+	out_time = (uint64_t)info.st_mtim.tv_sec * 1000000000ull + (uint64_t)info.st_mtim.tv_nsec;
+#endif
+	return true;
+}
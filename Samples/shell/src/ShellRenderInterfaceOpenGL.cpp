@@ -176,6 +176,16 @@ struct TGAHeader
 
 // Called by RmlUi when a texture is required by the library.		
 bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source)
+{
+	Rml::UniquePtr<const Rml::byte[]> data;
+	if (!LoadTextureData(data, texture_dimensions, source))
+		return false;
+
+	return GenerateTexture(texture_handle, data.get(), texture_dimensions);
+}
+
+// Called by RmlUi when it wants the pixel data of a texture source.
+bool ShellRenderInterfaceOpenGL::LoadTextureData(Rml::UniquePtr<const Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source)
 {
 	Rml::FileInterface* file_interface = Rml::GetFileInterface();
 	Rml::FileHandle file_handle = file_interface->Open(source);
@@ -195,12 +205,12 @@ bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::TextureHandle& texture_handle,
 		return false;
 	}
 
-	char* buffer = new char[buffer_size];
-	file_interface->Read(buffer, buffer_size, file_handle);
+	Rml::UniquePtr<char[]> buffer(new char[buffer_size]);
+	file_interface->Read(buffer.get(), buffer_size, file_handle);
 	file_interface->Close(file_handle);
 
 	TGAHeader header;
-	memcpy(&header, buffer, sizeof(TGAHeader));
+	memcpy(&header, buffer.get(), sizeof(TGAHeader));
 	
 	int color_mode = header.bitsPerPixel / 8;
 	int image_size = header.width * header.height * 4; // We always make 32bit textures 
@@ -218,7 +228,7 @@ bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::TextureHandle& texture_handle,
 		return false;
 	}
 	
-	const char* image_src = buffer + sizeof(TGAHeader);
+	const char* image_src = buffer.get() + sizeof(TGAHeader);
 	unsigned char* image_dest = new unsigned char[image_size];
 	
 	// Targa is BGR, swap to RGB and flip Y axis
@@ -241,15 +251,11 @@ bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::TextureHandle& texture_handle,
 		}
 	}
 
-	texture_dimensions.x = header.width;
-	texture_dimensions.y = header.height;
-	
-	bool success = GenerateTexture(texture_handle, image_dest, texture_dimensions);
-	
-	delete [] image_dest;
-	delete [] buffer;
-	
-	return success;
+	dimensions.x = header.width;
+	dimensions.y = header.height;
+	data.reset(image_dest);
+
+	return true;
 }
 
 // Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
@@ -277,6 +283,15 @@ bool ShellRenderInterfaceOpenGL::GenerateTexture(Rml::TextureHandle& texture_han
 	return true;
 }
 
+// Called by RmlUi when it wants to replace a region of a generated texture.
+bool ShellRenderInterfaceOpenGL::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, Rml::Vector2i origin, Rml::Vector2i dimensions)
+{
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, origin.x, origin.y, dimensions.x, dimensions.y, GL_RGBA, GL_UNSIGNED_BYTE, source);
+
+	return true;
+}
+
 // Called by RmlUi when a loaded texture is no longer required.		
 void ShellRenderInterfaceOpenGL::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
@@ -29,11 +29,95 @@
 #include "../../Include/RmlUi/Core/BaseXMLParser.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/Stream.h"
+#include "ProfileRecorder.h"
 #include "XMLParseTools.h"
+#include <algorithm>
 #include <string.h>
 
+#if defined RMLUI_SIMD_SSE2
+	#include <emmintrin.h>
+#elif defined RMLUI_SIMD_NEON
+	#include <arm_neon.h>
+#endif
+#if defined _MSC_VER && (defined RMLUI_SIMD_SSE2 || defined RMLUI_SIMD_NEON)
+	#include <intrin.h>
+#endif
+
 namespace Rml {
 
+static inline bool IsTerminator(char c, const char* terminators)
+{
+	if (terminators)
+	{
+		for (; *terminators; terminators++)
+		{
+			if (c == *terminators)
+				return true;
+		}
+	}
+	return false;
+}
+
+// Returns the first character in [begin, end) equal to any of the three given characters, or end if there are none.
+static const char* FindFirstOf(const char* begin, const char* end, char c0, char c1, char c2)
+{
+	const char* ptr = begin;
+
+#if defined RMLUI_SIMD_SSE2
+	const __m128i v0 = _mm_set1_epi8(c0);
+	const __m128i v1 = _mm_set1_epi8(c1);
+	const __m128i v2 = _mm_set1_epi8(c2);
+
+	for (; end - ptr >= 16; ptr += 16)
+	{
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+		const __m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, v0), _mm_cmpeq_epi8(chunk, v1)), _mm_cmpeq_epi8(chunk, v2));
+		const int mask = _mm_movemask_epi8(matches);
+		if (mask != 0)
+		{
+	#if defined _MSC_VER
+			unsigned long index;
+			_BitScanForward(&index, (unsigned long)mask);
+			return ptr + index;
+	#else
+			return ptr + __builtin_ctz((unsigned int)mask);
+	#endif
+		}
+	}
+#elif defined RMLUI_SIMD_NEON
+	const uint8x16_t v0 = vdupq_n_u8((uint8_t)c0);
+	const uint8x16_t v1 = vdupq_n_u8((uint8_t)c1);
+	const uint8x16_t v2 = vdupq_n_u8((uint8_t)c2);
+
+	for (; end - ptr >= 16; ptr += 16)
+	{
+		const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(ptr));
+		const uint8x16_t matches = vorrq_u8(vorrq_u8(vceqq_u8(chunk, v0), vceqq_u8(chunk, v1)), vceqq_u8(chunk, v2));
+		// Narrow each byte of the comparison to four bits, resulting in a 64-bit mask.
+		const uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+		if (mask != 0)
+		{
+	#if defined _MSC_VER
+			unsigned long index;
+			_BitScanForward64(&index, mask);
+			return ptr + (index >> 2);
+	#else
+			return ptr + (__builtin_ctzll(mask) >> 2);
+	#endif
+		}
+	}
+#endif
+
+	for (; ptr < end; ptr++)
+	{
+		const char c = *ptr;
+		if (c == c0 || c == c1 || c == c2)
+			return ptr;
+	}
+
+	return end;
+}
+
 BaseXMLParser::BaseXMLParser()
 {}
 
@@ -56,6 +140,9 @@ void BaseXMLParser::RegisterInnerXMLAttribute(const String& attribute_name)
 // interesting phenomenon are encountered.
 void BaseXMLParser::Parse(Stream* stream)
 {
+	RMLUI_RecordZone("ParseXML");
+	RMLUI_RecordZoneText(stream->GetSourceURL().GetURL());
+
 	source_url = &stream->GetSourceURL();
 
 	xml_source.clear();
@@ -254,7 +341,7 @@ bool BaseXMLParser::ReadOpenTag()
 	{
 		// It appears we have some attributes. Let's parse them.
 		bool parse_inner_xml_as_data = false;
-		XMLAttributes attributes;
+		attributes.clear();
 		if (!ReadAttributes(attributes, parse_inner_xml_as_data))
 			return false;
 
@@ -288,12 +375,12 @@ bool BaseXMLParser::ReadOpenTag()
 	// Check if this tag needs to be processed as CDATA.
 	if (section_opened)
 	{
-		const String lcase_tag_name = StringUtilities::ToLower(tag_name);
-		bool is_cdata_tag = (cdata_tags.find(lcase_tag_name) != cdata_tags.end());
+		auto it_cdata_tag = std::find_if(cdata_tags.begin(), cdata_tags.end(),
+			[&tag_name](const String& cdata_tag) { return StringUtilities::StringCompareCaseInsensitive(tag_name, cdata_tag); });
 
-		if (is_cdata_tag)
+		if (it_cdata_tag != cdata_tags.end())
 		{
-			if (ReadCDATA(lcase_tag_name.c_str()))
+			if (ReadCDATA(it_cdata_tag->c_str()))
 			{
 				open_tag_depth--;
 				if (!data.empty())
@@ -382,7 +469,10 @@ bool BaseXMLParser::ReadAttributes(XMLAttributes& attributes, bool& parse_raw_xm
 		if (attributes_for_inner_xml_data.count(attribute) == 1)
 			parse_raw_xml_content = true;
 
- 		attributes[attribute] = StringUtilities::DecodeRml(value);
+		if (value.find('&') != String::npos)
+			value = StringUtilities::DecodeRml(value);
+
+		attributes[std::move(attribute)] = std::move(value);
 
 		// Check for the end of the tag.
 		if (PeekString("/", false) || PeekString(">", false))
@@ -436,35 +526,27 @@ bool BaseXMLParser::ReadCDATA(const char* tag_terminator)
 // Reads from the stream until a complete word is found.
 bool BaseXMLParser::FindWord(String& word, const char* terminators)
 {
-	while (!AtEnd())
+	// Ignore leading white space
+	while (!AtEnd() && StringUtilities::IsWhitespace(Look()))
 	{
-		char c = Look();
-
-		// Count line numbers
-		if (c == '\n')
-		{
+		if (Look() == '\n')
 			line_number++;
-		}
+		Next();
+	}
 
-		// Ignore white space
-		if (StringUtilities::IsWhitespace(c))
-		{
-			if (word.empty())
-			{
-				Next();
-				continue;
-			}
-			else
-				return true;
-		}
+	const size_t word_begin = xml_index;
 
-		// Check for termination condition
-		if (terminators && strchr(terminators, c))
+	while (!AtEnd())
+	{
+		const char c = Look();
+
+		// Check for termination condition, white space or one of the terminators
+		if (StringUtilities::IsWhitespace(c) || IsTerminator(c, terminators))
 		{
+			word.append(xml_source, word_begin, xml_index - word_begin);
 			return !word.empty();
 		}
 
-		word += c;
 		Next();
 	}
 
@@ -479,12 +561,32 @@ bool BaseXMLParser::FindString(const char* string, String& data, bool escape_bra
 	bool in_string = false;
 	char previous = 0;
 
+	const char* source_begin = xml_source.data();
+	const char* source_end = source_begin + xml_source.size();
+
 	while (string[index])
 	{
 		if (AtEnd())
 			return false;
 
-		const char c = Look();
+		char c = Look();
+
+		// Skip ahead to the next character that may affect the search, unless we are inside a partial match or an expression.
+		if (index == 0 && !in_brackets && c != string[0] && !(escape_brackets && (c == '{' || c == '}')))
+		{
+			const char* begin = source_begin + xml_index;
+			const char* stop = (escape_brackets ? FindFirstOf(begin + 1, source_end, string[0], '{', '}')
+												: FindFirstOf(begin + 1, source_end, string[0], string[0], string[0]));
+
+			line_number += (int)std::count(begin, stop, '\n');
+			data.append(begin, stop);
+			previous = stop[-1];
+			xml_index = size_t(stop - source_begin);
+
+			if (AtEnd())
+				return false;
+			c = Look();
+		}
 
 		// Count line numbers
 		if (c == '\n')
@@ -510,7 +612,7 @@ bool BaseXMLParser::FindString(const char* string, String& data, bool escape_bra
 		{
 			if (index > 0)
 			{
-				data += String(string, index);
+				data.append(string, index);
 				index = 0;
 			}
 
@@ -528,6 +630,10 @@ bool BaseXMLParser::FindString(const char* string, String& data, bool escape_bra
 // given string.
 bool BaseXMLParser::PeekString(const char* string, bool consume)
 {
+	// Early exit on the most common case of a mismatched first character.
+	if (!AtEnd() && Look() != string[0] && !StringUtilities::IsWhitespace(Look()))
+		return false;
+
 	const size_t start_index = xml_index;
 	const int start_line = line_number;
 	bool success = true;
@@ -0,0 +1,337 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "CompiledDocument.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/Stream.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include "Utilities.h"
+#include <algorithm>
+#include <string.h>
+
+namespace Rml {
+
+// Identifies the data as a compiled document, and catches data written with a different byte order.
+static constexpr uint32_t binary_identifier = 0x524D4C42;
+
+// Must be incremented whenever the layout of the binary data changes.
+static constexpr uint32_t binary_format_version = 1;
+
+// Records the events of a regular XML parse, with the same CDATA tags and inner XML attributes as used when instancing.
+class XMLRecorder final : public XMLParser {
+public:
+	XMLRecorder(CompiledDocument::EventList& events) : XMLParser(nullptr), events(events) {}
+
+protected:
+	void HandleElementStart(const String& name, const XMLAttributes& attributes) override
+	{
+		events.push_back(CompiledDocument::Event{CompiledDocument::EventType::ElementStart, XMLDataType::Text, GetLineNumber(),
+			GetLineNumberOpenTag(), name, attributes});
+	}
+	void HandleElementEnd(const String& name) override
+	{
+		events.push_back(CompiledDocument::Event{CompiledDocument::EventType::ElementEnd, XMLDataType::Text, GetLineNumber(),
+			GetLineNumberOpenTag(), name, XMLAttributes()});
+	}
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		events.push_back(
+			CompiledDocument::Event{CompiledDocument::EventType::Data, type, GetLineNumber(), GetLineNumberOpenTag(), data, XMLAttributes()});
+	}
+
+private:
+	CompiledDocument::EventList& events;
+};
+
+template <typename T>
+static void WriteRaw(String& data, const T& value)
+{
+	data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void WriteString(String& data, const String& value)
+{
+	WriteRaw(data, (uint32_t)value.size());
+	data += value;
+}
+
+class BinaryReader {
+public:
+	BinaryReader(const String& data) : position(data.data()), end(data.data() + data.size()) {}
+
+	template <typename T>
+	bool ReadRaw(T& value)
+	{
+		if (size_t(end - position) < sizeof(T))
+			return false;
+		memcpy(&value, position, sizeof(T));
+		position += sizeof(T);
+		return true;
+	}
+
+	bool ReadString(String& value)
+	{
+		uint32_t size = 0;
+		if (!ReadRaw(size) || size_t(end - position) < size)
+			return false;
+		value.assign(position, size);
+		position += size;
+		return true;
+	}
+
+	// Reads a count of items, where each item occupies at least the given number of bytes.
+	bool ReadCount(uint32_t& count, size_t min_item_size)
+	{
+		return ReadRaw(count) && size_t(end - position) / min_item_size >= count;
+	}
+
+	bool AtEnd() const { return position == end; }
+
+private:
+	const char* position;
+	const char* end;
+};
+
+void CompiledDocument::Compile(Stream* stream)
+{
+	RMLUI_ZoneScoped;
+
+	source_url = stream->GetSourceURL();
+	events.clear();
+
+	XMLRecorder recorder(events);
+	recorder.Parse(stream);
+}
+
+// Records an element the same way the tokenizer would see it in the output of Element::GetRML().
+static void RecordElement(Element* element, CompiledDocument::EventList& events)
+{
+	using Event = CompiledDocument::Event;
+	using EventType = CompiledDocument::EventType;
+
+	if (ElementText* text_element = rmlui_dynamic_cast<ElementText*>(element))
+	{
+		events.push_back(Event{EventType::Data, XMLDataType::Text, 0, 0, text_element->GetText(), XMLAttributes()});
+		return;
+	}
+
+	// The attributes are passed on as-is, thus they need no escaping.
+	XMLAttributes attributes;
+	for (const auto& pair : element->GetAttributes())
+	{
+		String value;
+		if (pair.second.GetInto(value))
+			attributes.emplace(pair.first, std::move(value));
+	}
+
+	events.push_back(Event{EventType::ElementStart, XMLDataType::Text, 0, 0, element->GetTagName(), std::move(attributes)});
+
+	if (element->IsRMLDefinedByChildren())
+	{
+		const int num_children = element->GetNumChildren();
+		for (int i = 0; i < num_children; i++)
+			RecordElement(element->GetChild(i), events);
+	}
+	else
+	{
+		// Elements generating their own inner RML, such as data grids, are tokenized from the RML they return.
+		const String rml = element->GetInnerRML();
+		StreamMemory stream((const byte*)rml.data(), rml.size());
+		XMLRecorder recorder(events);
+		recorder.Parse(&stream);
+	}
+
+	events.push_back(Event{EventType::ElementEnd, XMLDataType::Text, 0, 0, element->GetTagName(), XMLAttributes()});
+}
+
+bool CompiledDocument::CompileChildren(const Element* element, const String& base_tag)
+{
+	RMLUI_ZoneScoped;
+
+	source_url = URL();
+	events.clear();
+
+	if (!element->IsRMLDefinedByChildren())
+		return false;
+
+	events.push_back(Event{EventType::ElementStart, XMLDataType::Text, 0, 0, base_tag, XMLAttributes()});
+
+	const int num_children = element->GetNumChildren();
+	for (int i = 0; i < num_children; i++)
+		RecordElement(element->GetChild(i), events);
+
+	events.push_back(Event{EventType::ElementEnd, XMLDataType::Text, 0, 0, base_tag, XMLAttributes()});
+
+	return true;
+}
+
+void CompiledDocument::Instance(XMLParser& parser) const
+{
+	RMLUI_ZoneScoped;
+
+	InstanceEvents(parser, events.begin(), events.end());
+}
+
+void CompiledDocument::InstanceHead(XMLParser& parser) const
+{
+	auto IsHead = [](const Event& event, EventType type) { return event.type == type && StringUtilities::ToLower(event.value) == "head"; };
+
+	auto begin = std::find_if(events.begin(), events.end(), [&](const Event& event) { return IsHead(event, EventType::ElementStart); });
+	auto end = std::find_if(begin, events.end(), [&](const Event& event) { return IsHead(event, EventType::ElementEnd); });
+	if (end != events.end())
+		++end;
+
+	InstanceEvents(parser, begin, end);
+}
+
+void CompiledDocument::InstanceEvents(XMLParser& parser, EventList::const_iterator begin, EventList::const_iterator end) const
+{
+	// Call the handlers through the base class, just as the tokenizer would.
+	BaseXMLParser& base_parser = parser;
+	base_parser.source_url = &source_url;
+
+	for (auto it = begin; it != end; ++it)
+	{
+		const Event& event = *it;
+		base_parser.line_number = event.line_number;
+		base_parser.line_number_open_tag = event.line_number_open_tag;
+
+		switch (event.type)
+		{
+		case EventType::ElementStart: base_parser.HandleElementStart(event.value, event.attributes); break;
+		case EventType::ElementEnd: base_parser.HandleElementEnd(event.value); break;
+		case EventType::Data: base_parser.HandleData(event.value, event.data_type); break;
+		}
+	}
+
+	base_parser.source_url = nullptr;
+}
+
+void CompiledDocument::Write(String& data, const String& source) const
+{
+	RMLUI_ZoneScoped;
+
+	WriteRaw(data, binary_identifier);
+	WriteRaw(data, binary_format_version);
+	WriteString(data, GetVersion());
+	WriteRaw(data, Utilities::HashStable(source));
+
+	WriteRaw(data, (uint32_t)events.size());
+	for (const Event& event : events)
+	{
+		WriteRaw(data, (uint8_t)event.type);
+		WriteRaw(data, (uint8_t)event.data_type);
+		WriteRaw(data, (int32_t)event.line_number);
+		WriteRaw(data, (int32_t)event.line_number_open_tag);
+		WriteString(data, event.value);
+
+		// Attribute values are always strings when produced by the parser.
+		WriteRaw(data, (uint32_t)event.attributes.size());
+		for (const auto& attribute : event.attributes)
+		{
+			WriteString(data, attribute.first);
+			WriteString(data, attribute.second.Get<String>());
+		}
+	}
+}
+
+bool CompiledDocument::Read(const String& data, const URL& new_source_url, const String* source)
+{
+	RMLUI_ZoneScoped;
+
+	BinaryReader reader(data);
+
+	uint32_t identifier = 0, format_version = 0;
+	String version;
+	uint64_t source_hash = 0;
+	if (!reader.ReadRaw(identifier) || identifier != binary_identifier || !reader.ReadRaw(format_version) ||
+		format_version != binary_format_version || !reader.ReadString(version) || version != GetVersion() || !reader.ReadRaw(source_hash))
+		return false;
+
+	if (source && Utilities::HashStable(*source) != source_hash)
+		return false;
+
+	// Type, data type, line numbers, value size, and number of attributes.
+	constexpr size_t min_event_size = 2 * sizeof(uint8_t) + 2 * sizeof(int32_t) + 2 * sizeof(uint32_t);
+	constexpr size_t min_attribute_size = 2 * sizeof(uint32_t);
+
+	uint32_t num_events = 0;
+	if (!reader.ReadCount(num_events, min_event_size))
+		return false;
+
+	EventList new_events(num_events);
+	for (Event& event : new_events)
+	{
+		uint8_t type = 0, data_type = 0;
+		int32_t line_number = 0, line_number_open_tag = 0;
+		uint32_t num_attributes = 0;
+		if (!reader.ReadRaw(type) || type > (uint8_t)EventType::Data || !reader.ReadRaw(data_type) || data_type > (uint8_t)XMLDataType::InnerXML ||
+			!reader.ReadRaw(line_number) || !reader.ReadRaw(line_number_open_tag) || !reader.ReadString(event.value) ||
+			!reader.ReadCount(num_attributes, min_attribute_size))
+			return false;
+
+		event.type = (EventType)type;
+		event.data_type = (XMLDataType)data_type;
+		event.line_number = line_number;
+		event.line_number_open_tag = line_number_open_tag;
+
+		event.attributes.reserve(num_attributes);
+		for (uint32_t i = 0; i < num_attributes; i++)
+		{
+			String name, value;
+			if (!reader.ReadString(name) || !reader.ReadString(value))
+				return false;
+			event.attributes.emplace(std::move(name), Variant(std::move(value)));
+		}
+	}
+
+	if (!reader.AtEnd())
+		return false;
+
+	source_url = new_source_url;
+	events = std::move(new_events);
+	return true;
+}
+
+const URL& CompiledDocument::GetSourceURL() const
+{
+	return source_url;
+}
+
+String CompiledDocument::GetBinaryPath(const String& source_path)
+{
+	return source_path + ".bin";
+}
+
+} // namespace Rml
@@ -0,0 +1,113 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#ifndef RMLUI_CORE_COMPILEDDOCUMENT_H
+#define RMLUI_CORE_COMPILEDDOCUMENT_H
+
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/URL.h"
+
+namespace Rml {
+
+class Element;
+class Stream;
+class XMLParser;
+
+/**
+	A pre-tokenized RML document, stored as the sequence of elements, attributes and data that the XML parser produces from
+	its source.
+
+	Instancing a compiled document drives the regular node handlers exactly like parsing its source would, but skips the
+	tokenizer and all of its string building. The compiled document can be serialized to a binary form, which is tied to
+	the exact library version it was produced with, and to a hash of the source it was compiled from.
+ */
+
+class CompiledDocument {
+public:
+	/// Tokenizes the RML in the given stream.
+	/// @param[in] stream The stream to read from.
+	void Compile(Stream* stream);
+
+	/// Records the DOM children of an element, with the same result as compiling its inner RML wrapped in the given tag.
+	/// Only the contents of elements generating their own inner RML, see Element::IsRMLDefinedByChildren(), are serialized
+	/// and tokenized.
+	/// @param[in] element The element whose children to record.
+	/// @param[in] base_tag The tag to wrap the children in, normally the documents base tag.
+	/// @return False if the element itself generates its inner RML, in which case nothing is recorded.
+	bool CompileChildren(const Element* element, const String& base_tag);
+
+	/// Instances the document by passing the compiled contents to the given parser.
+	/// @param[in] parser The parser to instance the document with.
+	void Instance(XMLParser& parser) const;
+
+	/// Instances only the head of the document, for retrieving its document header without creating any elements.
+	/// @param[in] parser The parser to instance the head with.
+	void InstanceHead(XMLParser& parser) const;
+
+	/// Serializes the compiled document.
+	/// @param[out] data The binary data, appended to.
+	/// @param[in] source The source text the document was compiled from.
+	void Write(String& data, const String& source) const;
+
+	/// Reconstructs the compiled document from its binary representation.
+	/// @param[in] data The binary data.
+	/// @param[in] source_url The source URL of the document, used for resolving relative paths and for log messages.
+	/// @param[in] source The current source text if available, the data is considered stale if it was compiled from a different source.
+	/// @return True on success, false if the data is invalid or stale.
+	bool Read(const String& data, const URL& source_url, const String* source);
+
+	/// Returns the source URL of the document.
+	const URL& GetSourceURL() const;
+
+	/// Returns the path of the compiled binary for the document at the given path.
+	static String GetBinaryPath(const String& source_path);
+
+	enum class EventType : uint8_t { ElementStart, ElementEnd, Data };
+
+	struct Event {
+		EventType type;
+		XMLDataType data_type;
+		int line_number;
+		int line_number_open_tag;
+		// The tag name or data contents.
+		String value;
+		XMLAttributes attributes;
+	};
+	using EventList = Vector<Event>;
+
+private:
+	void InstanceEvents(XMLParser& parser, EventList::const_iterator begin, EventList::const_iterator end) const;
+
+	URL source_url;
+	EventList events;
+};
+
+} // namespace Rml
+#endif
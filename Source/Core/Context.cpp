@@ -33,15 +33,24 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "CompiledDocument.h"
 #include "DataModel.h"
+#include "DocumentPreloader.h"
 #include "EventDispatcher.h"
+#include "EventSpecification.h"
+#include "GeometryArena.h"
+#include "GeometryDatabase.h"
+#include "HitTestGrid.h"
 #include "PluginRegistry.h"
+#include "ProfileRecorder.h"
 #include "StreamFile.h"
+#include "TextureDatabase.h"
 #include <algorithm>
 #include <iterator>
 
@@ -51,6 +60,14 @@ namespace Rml {
 static constexpr float DOUBLE_CLICK_TIME = 0.5f;     // [s]
 static constexpr float DOUBLE_CLICK_MAX_DIST = 3.f;  // [dp]
 
+// Dispatches a built-in input event, its parameters are only converted to a dictionary if requested by a listener.
+static bool DispatchInputEvent(Element* element, EventId id, const EventInputParameters& parameters)
+{
+	const EventSpecification& specification = EventSpecificationInterface::Get(id);
+	return EventDispatcher::DispatchEvent(element, specification.id, specification.type, parameters, specification.interruptible, specification.bubbles,
+		specification.default_action_phase);
+}
+
 Context::Context(const String& name) : name(name), dimensions(0, 0), density_independent_pixel_ratio(1.0f), mouse_position(0, 0), clip_origin(-1, -1), clip_dimensions(-1, -1)
 {
 	instancer = nullptr;
@@ -82,6 +99,9 @@ Context::Context(const String& name) : name(name), dimensions(0, 0), density_ind
 		
 	enable_cursor = true;
 
+	hit_test_grid = MakeUnique<HitTestGrid>();
+	geometry_arena = MakeUnique<GeometryArena>();
+
 	document_focus_history.push_back(root.get());
 	focus = root.get();
 	hover = nullptr;
@@ -110,6 +130,11 @@ Context::~Context()
 
 	cursor_proxy.reset();
 
+	// Any geometry still placed in our arena, such as in elements kept alive by the user, is moved back into its own buffers.
+	if (geometry_arena->GetNumAllocations() > 0)
+		GeometryDatabase::ReleaseAll();
+	geometry_arena.reset();
+
 	instancer = nullptr;
 
 	render_interface = nullptr;
@@ -181,6 +206,17 @@ bool Context::Update()
 {
 	RMLUI_ZoneScoped;
 
+	ProcessInputQueue();
+
+	// Generate any textures decoded in the background, and refresh the elements which may be using them.
+	TextureDatabase::ProcessAsyncLoads();
+	const int new_texture_load_generation = TextureDatabase::GetAsyncLoadGeneration();
+	if (new_texture_load_generation != texture_load_generation)
+	{
+		texture_load_generation = new_texture_load_generation;
+		root->OnTexturesLoadedRecursive();
+	}
+
 	// Update all data models first
 	for (auto& data_model : data_models)
 		data_model.second->Update(true);
@@ -212,6 +248,8 @@ bool Context::Render()
 	render_interface->context = this;
 	ElementUtilities::ApplyActiveClipRegion(this, render_interface);
 
+	TextureDatabase::AdvanceRenderGeneration();
+
 	root->Render();
 
 	ElementUtilities::SetClippingRegion(nullptr, this);
@@ -228,6 +266,9 @@ bool Context::Render()
 
 	render_interface->context = nullptr;
 
+	// Now that we know which textures are visible, release the old ones if we are over the memory budget.
+	TextureDatabase::EvictTextures();
+
 	return true;
 }
 
@@ -259,6 +300,36 @@ ElementDocument* Context::CreateDocument(const String& instancer_name)
 // Load a document into the context.
 ElementDocument* Context::LoadDocument(const String& document_path)
 {	
+	RMLUI_RecordZone("LoadDocument");
+	RMLUI_RecordZoneText(document_path);
+
+	if (UniquePtr<CompiledDocument> preloaded_document = DocumentPreloader::Take(document_path))
+		return InstanceCompiledDocument(*preloaded_document);
+
+	String compiled_data;
+	if (GetCompiledFileLoading() && GetFileInterface()->LoadFile(CompiledDocument::GetBinaryPath(document_path), compiled_data))
+	{
+		// Use the same source URL as when streaming the source file.
+		const String source_url = StringUtilities::Replace(document_path, ':', '|');
+
+		String document_rml;
+		const bool has_source = GetFileInterface()->LoadFile(document_path, document_rml);
+
+		CompiledDocument compiled_document;
+		if (compiled_document.Read(compiled_data, URL(source_url), has_source ? &document_rml : nullptr))
+			return InstanceCompiledDocument(compiled_document);
+
+		Log::Message(Log::LT_INFO, "Compiled document '%s' is stale or invalid, parsing its source instead.", document_path.c_str());
+
+		// The source has already been read, parse it from memory instead of opening its file again.
+		if (has_source)
+		{
+			StreamMemory stream((const byte*)document_rml.data(), document_rml.size());
+			stream.SetSourceURL(source_url);
+			return LoadDocument(&stream);
+		}
+	}
+
 	auto stream = MakeUnique<StreamFile>();
 
 	if (!stream->Open(document_path))
@@ -278,6 +349,32 @@ ElementDocument* Context::LoadDocument(Stream* stream)
 	if (!element)
 		return nullptr;
 
+	return AppendDocument(std::move(element));
+}
+
+ElementDocument* Context::LoadCompiledDocument(const String& data, const String& source_url, const String* document_rml)
+{
+	CompiledDocument compiled_document;
+	if (!compiled_document.Read(data, URL(source_url), document_rml))
+		return nullptr;
+
+	return InstanceCompiledDocument(compiled_document);
+}
+
+ElementDocument* Context::InstanceCompiledDocument(const CompiledDocument& compiled_document)
+{
+	// Notify plugins before instancing, in the same order as when loading from a stream.
+	PluginRegistry::NotifyDocumentOpen(this, compiled_document.GetSourceURL().GetURL());
+
+	ElementPtr element = Factory::InstanceDocumentCompiled(this, compiled_document, GetDocumentsBaseTag());
+	if (!element)
+		return nullptr;
+
+	return AppendDocument(std::move(element));
+}
+
+ElementDocument* Context::AppendDocument(ElementPtr element)
+{
 	ElementDocument* document = static_cast<ElementDocument*>(element.get());
 	
 	root->AppendChild(std::move(element));
@@ -303,6 +400,9 @@ ElementDocument* Context::LoadDocument(Stream* stream)
 // Load a document into the context.
 ElementDocument* Context::LoadDocumentFromMemory(const String& string, const String& source_url)
 {
+	RMLUI_RecordZone("LoadDocument");
+	RMLUI_RecordZoneText(source_url);
+
 	// Open the stream based on the string contents.
 	auto stream = MakeUnique<StreamMemory>((byte*)string.c_str(), string.size());
 
@@ -367,7 +467,7 @@ void Context::UnloadDocument(ElementDocument* _document)
 	}
 
 	// Rebuild the hover state.
-	UpdateHoverChain(Dictionary(), Dictionary(), mouse_position);
+	UpdateHoverChain(EventInputParameters(), EventInputParameters(), mouse_position);
 }
 
 // Unload all the currently loaded documents
@@ -531,29 +631,35 @@ void Context::RemoveEventListener(const String& event, EventListener* listener,
 // Sends a key down event into RmlUi.
 bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
+	if (QueueInput(QueuedInput::Type::KeyDown, key_modifier_state, (int)key_identifier))
+		return true;
+
 	// Generate the parameters for the key event.
-	Dictionary parameters;
+	EventInputParameters parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
 	if (focus)
-		return focus->DispatchEvent(EventId::Keydown, parameters);
+		return DispatchInputEvent(focus, EventId::Keydown, parameters);
 	else
-		return root->DispatchEvent(EventId::Keydown, parameters);
+		return DispatchInputEvent(root.get(), EventId::Keydown, parameters);
 }
 
 // Sends a key up event into RmlUi.
 bool Context::ProcessKeyUp(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
+	if (QueueInput(QueuedInput::Type::KeyUp, key_modifier_state, (int)key_identifier))
+		return true;
+
 	// Generate the parameters for the key event.
-	Dictionary parameters;
+	EventInputParameters parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
 	if (focus)
-		return focus->DispatchEvent(EventId::Keyup, parameters);
+		return DispatchInputEvent(focus, EventId::Keyup, parameters);
 	else
-		return root->DispatchEvent(EventId::Keyup, parameters);
+		return DispatchInputEvent(root.get(), EventId::Keyup, parameters);
 }
 
 bool Context::ProcessTextInput(char character)
@@ -575,6 +681,9 @@ bool Context::ProcessTextInput(Character character)
 // Sends a string of text as text input into RmlUi.
 bool Context::ProcessTextInput(const String& string)
 {
+	if (QueueInput(QueuedInput::Type::TextInput, 0, 0, Vector2i(0), 0.f, string))
+		return true;
+
 	Element* target = (focus ? focus : root.get());
 
 	Dictionary parameters;
@@ -588,6 +697,9 @@ bool Context::ProcessTextInput(const String& string)
 // Sends a mouse movement event into RmlUi.
 bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 {
+	if (QueueInput(QueuedInput::Type::MouseMove, key_modifier_state, 0, Vector2i(x, y)))
+		return true;
+
 	// Check whether the mouse moved since the last event came through.
 	Vector2i old_mouse_position = mouse_position;
 	bool mouse_moved = (x != mouse_position.x) || (y != mouse_position.y);
@@ -598,11 +710,11 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 	}
 
 	// Generate the parameters for the mouse events (there could be a few!).
-	Dictionary parameters;
+	EventInputParameters parameters;
 	GenerateMouseEventParameters(parameters, -1);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
-	Dictionary drag_parameters;
+	EventInputParameters drag_parameters;
 	GenerateMouseEventParameters(drag_parameters);
 	GenerateDragEventParameters(drag_parameters);
 	GenerateKeyModifierEventParameters(drag_parameters, key_modifier_state);
@@ -616,11 +728,11 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 	{
 		if (hover)
 		{
-			hover->DispatchEvent(EventId::Mousemove, parameters);
+			DispatchInputEvent(hover, EventId::Mousemove, parameters);
 
 			if (drag_hover &&
 				drag_verbose)
-				drag_hover->DispatchEvent(EventId::Dragmove, drag_parameters);
+				DispatchInputEvent(drag_hover, EventId::Dragmove, drag_parameters);
 		}
 	}
 
@@ -644,7 +756,10 @@ static Element* FindFocusElement(Element* element)
 // Sends a mouse-button down event into RmlUi.
 bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 {
-	Dictionary parameters;
+	if (QueueInput(QueuedInput::Type::MouseButtonDown, key_modifier_state, button_index))
+		return true;
+
+	EventInputParameters parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
@@ -670,7 +785,7 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 		
 		// Call 'onmousedown' on every item in the hover chain, and copy the hover chain to the active chain.
 		if (hover)
-			propagate = hover->DispatchEvent(EventId::Mousedown, parameters);
+			propagate = DispatchInputEvent(hover, EventId::Mousedown, parameters);
 
 		if (propagate)
 		{
@@ -686,7 +801,7 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 				mouse_distance_squared < max_mouse_distance * max_mouse_distance)
 			{
 				if (hover)
-					propagate = hover->DispatchEvent(EventId::Dblclick, parameters);
+					propagate = DispatchInputEvent(hover, EventId::Dblclick, parameters);
 
 				last_click_element = nullptr;
 				last_click_time = 0;
@@ -725,7 +840,7 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 	{
 		// Not the primary mouse button, so we're not doing any special processing.
 		if (hover)
-			hover->DispatchEvent(EventId::Mousedown, parameters);
+			DispatchInputEvent(hover, EventId::Mousedown, parameters);
 	}
 
 	return !IsMouseInteracting();
@@ -734,7 +849,10 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 // Sends a mouse-button up event into RmlUi.
 bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 {
-	Dictionary parameters;
+	if (QueueInput(QueuedInput::Type::MouseButtonUp, key_modifier_state, button_index))
+		return true;
+
+	EventInputParameters parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
@@ -746,13 +864,13 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 	{
 		// The elements in the new hover chain have the 'onmouseup' event called on them.
 		if (hover)
-			hover->DispatchEvent(EventId::Mouseup, parameters);
+			DispatchInputEvent(hover, EventId::Mouseup, parameters);
 
 		// If the active element (the one that was being hovered over when the mouse button was pressed) is still being
 		// hovered over, we click it.
 		if (hover && active && active == FindFocusElement(hover))
 		{
-			active->DispatchEvent(EventId::Click, parameters);
+			DispatchInputEvent(active, EventId::Click, parameters);
 		}
 
 		// Unset the 'active' pseudo-class on all the elements in the active chain; because they may not necessarily
@@ -767,7 +885,7 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 		{
 			if (drag_started)
 			{
-				Dictionary drag_parameters;
+				EventInputParameters drag_parameters;
 				GenerateMouseEventParameters(drag_parameters);
 				GenerateDragEventParameters(drag_parameters);
 				GenerateKeyModifierEventParameters(drag_parameters, key_modifier_state);
@@ -776,15 +894,15 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 				{
 					if (drag_verbose)
 					{
-						drag_hover->DispatchEvent(EventId::Dragdrop, drag_parameters);
+						DispatchInputEvent(drag_hover, EventId::Dragdrop, drag_parameters);
 						// User may have removed the element, do an extra check.
 						if(drag_hover) 
-							drag_hover->DispatchEvent(EventId::Dragout, drag_parameters);
+							DispatchInputEvent(drag_hover, EventId::Dragout, drag_parameters);
 					}
 				}
 
 				if(drag)
-					drag->DispatchEvent(EventId::Dragend, drag_parameters);
+					DispatchInputEvent(drag, EventId::Dragend, drag_parameters);
 
 				ReleaseDragClone();
 			}
@@ -801,7 +919,7 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 	{
 		// Not the left mouse button, so we're not doing any special processing.
 		if (hover)
-			hover->DispatchEvent(EventId::Mouseup, parameters);
+			DispatchInputEvent(hover, EventId::Mouseup, parameters);
 	}
 
 	return result;
@@ -810,13 +928,17 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 // Sends a mouse-wheel movement event into RmlUi.
 bool Context::ProcessMouseWheel(float wheel_delta, int key_modifier_state)
 {
+	if (QueueInput(QueuedInput::Type::MouseWheel, key_modifier_state, 0, Vector2i(0), wheel_delta))
+		return true;
+
 	if (hover)
 	{
-		Dictionary scroll_parameters;
+		EventInputParameters scroll_parameters;
 		GenerateKeyModifierEventParameters(scroll_parameters, key_modifier_state);
-		scroll_parameters["wheel_delta"] = wheel_delta;
+		scroll_parameters.flags |= EventInputParameters::WheelDelta;
+		scroll_parameters.wheel_delta = wheel_delta;
 
-		return hover->DispatchEvent(EventId::Mousescroll, scroll_parameters);
+		return DispatchInputEvent(hover, EventId::Mousescroll, scroll_parameters);
 	}
 
 	return true;
@@ -827,6 +949,74 @@ bool Context::IsMouseInteracting() const
 	return (hover && hover != root.get()) || (active && active != root.get());
 }
 
+void Context::SetQueueInput(bool in_queue_input)
+{
+	queue_input = in_queue_input;
+
+	if (!queue_input)
+		ProcessInputQueue();
+}
+
+bool Context::GetQueueInput() const
+{
+	return queue_input;
+}
+
+bool Context::QueueInput(QueuedInput::Type type, int key_modifier_state, int index, Vector2i position, float wheel_delta, const String& text)
+{
+	// Input generated while processing the queue, such as from event listeners, is processed immediately.
+	if (!queue_input || processing_input_queue)
+		return false;
+
+	if (!input_queue.empty())
+	{
+		QueuedInput& last = input_queue.back();
+		if (last.type == type && last.key_modifier_state == key_modifier_state)
+		{
+			if (type == QueuedInput::Type::MouseMove)
+			{
+				last.mouse_position = position;
+				return true;
+			}
+			else if (type == QueuedInput::Type::MouseWheel)
+			{
+				last.wheel_delta += wheel_delta;
+				return true;
+			}
+		}
+	}
+
+	input_queue.push_back(QueuedInput{ type, key_modifier_state, index, position, wheel_delta, text });
+	return true;
+}
+
+void Context::ProcessInputQueue()
+{
+	if (input_queue.empty() || processing_input_queue)
+		return;
+
+	RMLUI_ZoneScoped;
+
+	processing_input_queue = true;
+
+	for (const QueuedInput& input : input_queue)
+	{
+		switch (input.type)
+		{
+		case QueuedInput::Type::KeyDown:         ProcessKeyDown((Input::KeyIdentifier)input.index, input.key_modifier_state); break;
+		case QueuedInput::Type::KeyUp:           ProcessKeyUp((Input::KeyIdentifier)input.index, input.key_modifier_state); break;
+		case QueuedInput::Type::TextInput:       ProcessTextInput(input.text); break;
+		case QueuedInput::Type::MouseMove:       ProcessMouseMove(input.mouse_position.x, input.mouse_position.y, input.key_modifier_state); break;
+		case QueuedInput::Type::MouseButtonDown: ProcessMouseButtonDown(input.index, input.key_modifier_state); break;
+		case QueuedInput::Type::MouseButtonUp:   ProcessMouseButtonUp(input.index, input.key_modifier_state); break;
+		case QueuedInput::Type::MouseWheel:      ProcessMouseWheel(input.wheel_delta, input.key_modifier_state); break;
+		}
+	}
+
+	input_queue.clear();
+	processing_input_queue = false;
+}
+
 // Gets the context's render interface.
 RenderInterface* Context::GetRenderInterface() const
 {
@@ -908,9 +1098,9 @@ void Context::OnElementDetach(Element* element)
 	auto it_hover = hover_chain.find(element);
 	if (it_hover != hover_chain.end())
 	{
-		Dictionary parameters;
+		EventInputParameters parameters;
 		GenerateMouseEventParameters(parameters, -1);
-		element->DispatchEvent(EventId::Mouseout, parameters);
+		DispatchInputEvent(element, EventId::Mouseout, parameters);
 
 		hover_chain.erase(it_hover);
 
@@ -997,7 +1187,7 @@ bool Context::OnFocusChange(Element* new_focus)
 		element = element->GetParentNode();
 	}
 
-	Dictionary parameters;
+	EventInputParameters parameters;
 
 	// Send out blur/focus events.
 	SendEvents(old_chain, new_chain, EventId::Blur, parameters);
@@ -1032,14 +1222,14 @@ bool Context::OnFocusChange(Element* new_focus)
 // Generates an event for faking clicks on an element.
 void Context::GenerateClickEvent(Element* element)
 {
-	Dictionary parameters;
+	EventInputParameters parameters;
 	GenerateMouseEventParameters(parameters, 0);
 
-	element->DispatchEvent(EventId::Click, parameters);
+	DispatchInputEvent(element, EventId::Click, parameters);
 }
 
 // Updates the current hover elements, sending required events.
-void Context::UpdateHoverChain(const Dictionary& parameters, const Dictionary& drag_parameters, const Vector2i old_mouse_position)
+void Context::UpdateHoverChain(const EventInputParameters& parameters, const EventInputParameters& drag_parameters, const Vector2i old_mouse_position)
 {
 	const Vector2f position(mouse_position);
 
@@ -1050,10 +1240,10 @@ void Context::UpdateHoverChain(const Dictionary& parameters, const Dictionary& d
 		{
 			if (!drag_started)
 			{
-				Dictionary drag_start_parameters = drag_parameters;
-				drag_start_parameters["mouse_x"] = old_mouse_position.x;
-				drag_start_parameters["mouse_y"] = old_mouse_position.y;
-				drag->DispatchEvent(EventId::Dragstart, drag_start_parameters);
+				EventInputParameters drag_start_parameters = drag_parameters;
+				drag_start_parameters.flags |= EventInputParameters::MousePosition;
+				drag_start_parameters.mouse_position = old_mouse_position;
+				DispatchInputEvent(drag, EventId::Dragstart, drag_start_parameters);
 				drag_started = true;
 
 				if (drag->GetComputedValues().drag == Style::Drag::Clone)
@@ -1063,7 +1253,7 @@ void Context::UpdateHoverChain(const Dictionary& parameters, const Dictionary& d
 				}
 			}
 
-			drag->DispatchEvent(EventId::Drag, drag_parameters);
+			DispatchInputEvent(drag, EventId::Drag, drag_parameters);
 		}
 	}
 
@@ -1149,6 +1339,14 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 				element = focus_document;
 			}
 		}
+
+		// Otherwise, look up the element in the hit test grid if it is available. Fall back to a full search if not.
+		Element* result = nullptr;
+		if (element == root.get() && hit_test_grid->Update(element, dimensions) &&
+			hit_test_grid->GetElementAtPoint(point, ignore_element, result))
+		{
+			return result;
+		}
 	}
 
 
@@ -1272,42 +1470,36 @@ DataModel* Context::GetDataModelPtr(const String& name) const
 }
 
 // Builds the parameters for a generic key event.
-void Context::GenerateKeyEventParameters(Dictionary& parameters, Input::KeyIdentifier key_identifier)
+void Context::GenerateKeyEventParameters(EventInputParameters& parameters, Input::KeyIdentifier key_identifier)
 {
-	parameters["key_identifier"] = (int)key_identifier;
+	parameters.flags |= EventInputParameters::KeyIdentifier;
+	parameters.key_identifier = (int)key_identifier;
 }
 
 // Builds the parameters for a generic mouse event.
-void Context::GenerateMouseEventParameters(Dictionary& parameters, int button_index)
+void Context::GenerateMouseEventParameters(EventInputParameters& parameters, int button_index)
 {
-	parameters.reserve(3);
-	parameters["mouse_x"] = mouse_position.x;
-	parameters["mouse_y"] = mouse_position.y;
+	parameters.flags |= EventInputParameters::MousePosition;
+	parameters.mouse_position = mouse_position;
 	if (button_index >= 0)
-		parameters["button"] = button_index;
+	{
+		parameters.flags |= EventInputParameters::Button;
+		parameters.button = button_index;
+	}
 }
 
 // Builds the parameters for the key modifier state.
-void Context::GenerateKeyModifierEventParameters(Dictionary& parameters, int key_modifier_state)
+void Context::GenerateKeyModifierEventParameters(EventInputParameters& parameters, int key_modifier_state)
 {
-	static const String property_names[] = {
-		"ctrl_key",
-		"shift_key",
-		"alt_key",
-		"meta_key",
-		"caps_lock_key",
-		"num_lock_key",
-		"scroll_lock_key"
-	};
-
-	for (int i = 0; i < 7; i++)
-		parameters[property_names[i]] = (int)((key_modifier_state & (1 << i)) > 0);
+	parameters.flags |= EventInputParameters::KeyModifiers;
+	parameters.key_modifier_state = key_modifier_state;
 }
 
 // Builds the parameters for a drag event.
-void Context::GenerateDragEventParameters(Dictionary& parameters)
-{	
-	parameters["drag_element"] = (void*)drag;
+void Context::GenerateDragEventParameters(EventInputParameters& parameters)
+{
+	parameters.flags |= EventInputParameters::DragElement;
+	parameters.drag_element = drag;
 }
 
 // Releases all unloaded documents pending destruction.
@@ -1350,7 +1542,7 @@ private:
 };
 
 // Sends the specified event to all elements in new_items that don't appear in old_items.
-void Context::SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters)
+void Context::SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const EventInputParameters& parameters)
 {
 	// We put our elements in observer pointers in case some of them are deleted during dispatch.
 	ElementObserverList elements;
@@ -1358,7 +1550,7 @@ void Context::SendEvents(const ElementSet& old_items, const ElementSet& new_item
 	for (auto& element : elements)
 	{
 		if (element)
-			element->DispatchEvent(id, parameters);
+			DispatchInputEvent(element.get(), id, parameters);
 	}
 }
 
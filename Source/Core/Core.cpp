@@ -28,22 +28,29 @@
 
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
+#include "DocumentPreloader.h"
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
+#include "GeometryArena.h"
 #include "GeometryDatabase.h"
 #include "PluginRegistry.h"
+#include "ProfileRecorder.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetParser.h"
 #include "TemplateCache.h"
+#include "TextureAtlas.h"
 #include "TextureDatabase.h"
 #include "EventSpecification.h"
 
@@ -60,6 +67,7 @@
 #endif
 
 #include "Pool.h"
+#include <atomic>
 
 
 namespace Rml {
@@ -79,6 +87,9 @@ static UniquePtr<FontEngineInterface> default_font_interface;
 
 static bool initialised = false;
 
+// Read by document preloading threads as well.
+static std::atomic<bool> compiled_file_loading{false};
+
 using ContextMap = UnorderedMap< String, ContextPtr >;
 static ContextMap contexts;
 
@@ -93,6 +104,7 @@ extern Pool<ObserverPtrBlock>* observerPtrBlockPool;
 bool Initialise()
 {
 	RMLUI_ASSERTMSG(!initialised, "Rml::Initialise() called, but RmlUi is already initialised!");
+	RMLUI_RecordZone("Initialise");
 
 	Log::Initialise();
 
@@ -160,6 +172,9 @@ void Shutdown()
 	// Clear out all contexts, which should also clean up all attached elements.
 	contexts.clear();
 
+	// Stop loading documents in the background before the caches they load into are destroyed.
+	DocumentPreloader::Shutdown();
+
 	// Notify all plugins we're being shutdown.
 	PluginRegistry::NotifyShutdown();
 
@@ -173,6 +188,7 @@ void Shutdown()
 	default_font_interface.reset();
 
 	TextureDatabase::Shutdown();
+	TextureAtlas::Shutdown();
 
 	initialised = false;
 
@@ -333,11 +349,15 @@ int GetNumContexts()
 
 bool LoadFontFace(const String& file_name, bool fallback_face)
 {
+	RMLUI_RecordZone("LoadFontFace");
+	RMLUI_RecordZoneText(file_name);
 	return font_interface->LoadFontFace(file_name, fallback_face);
 }
 
 bool LoadFontFace(const byte* data, int data_size, const String& font_family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face)
 {
+	RMLUI_RecordZone("LoadFontFace");
+	RMLUI_RecordZoneText(font_family);
 	return font_interface->LoadFontFace(data, data_size, font_family, style, weight, fallback_face);
 }
 
@@ -374,9 +394,109 @@ void ReleaseTextures(RenderInterface* in_render_interface)
 	TextureDatabase::ReleaseTextures(in_render_interface);
 }
 
+void SetAsyncTextureLoading(int num_threads, int upload_budget)
+{
+	TextureDatabase::SetAsyncLoading(num_threads, upload_budget);
+}
+
+void PrefetchTextures(const StringList& sources, RenderInterface* in_render_interface)
+{
+	RenderInterface* prefetch_render_interface = (in_render_interface ? in_render_interface : render_interface);
+	if (!prefetch_render_interface)
+		return;
+
+	for (const String& source : sources)
+		TextureDatabase::Prefetch(prefetch_render_interface, source);
+}
+
+int GetNumTexturesLoading()
+{
+	return TextureDatabase::GetNumAsyncLoads();
+}
+
+void PreloadDocuments(const StringList& document_paths, int num_threads)
+{
+	DocumentPreloader::Preload(document_paths, num_threads);
+}
+
+int GetNumDocumentsPreloading()
+{
+	return DocumentPreloader::GetNumPending();
+}
+
+void SetCompiledFileLoading(bool enable)
+{
+	compiled_file_loading = enable;
+}
+
+bool GetCompiledFileLoading()
+{
+	return compiled_file_loading;
+}
+
+int ReloadModifiedStyleSheets()
+{
+	RMLUI_ZoneScoped;
+
+	Vector<StyleSheetFactory::ReloadedStyleSheet> reloaded_sheets;
+	StyleSheetFactory::ReloadModifiedStyleSheets(reloaded_sheets);
+	if (reloaded_sheets.empty())
+		return 0;
+
+	// Replace the reloaded sheets in the combined style sheets of every document linking them.
+	for (const auto& pair : contexts)
+	{
+		Context* context = pair.second.get();
+		for (int i = 0; i < context->GetNumDocuments(); i++)
+		{
+			ElementDocument* document = context->GetDocument(i);
+			const StyleSheetContainer* style_sheet = document->GetStyleSheetContainer();
+			if (!style_sheet)
+				continue;
+
+			SharedPtr<StyleSheetContainer> new_style_sheet;
+			for (const StyleSheetFactory::ReloadedStyleSheet& reloaded_sheet : reloaded_sheets)
+			{
+				const StyleSheetContainer& current_style_sheet = (new_style_sheet ? *new_style_sheet : *style_sheet);
+				if (SharedPtr<StyleSheetContainer> replaced_style_sheet =
+						current_style_sheet.ReplaceStyleSheetContainer(*reloaded_sheet.previous, *reloaded_sheet.current))
+					new_style_sheet = std::move(replaced_style_sheet);
+			}
+
+			if (new_style_sheet)
+				document->SetStyleSheetContainer(std::move(new_style_sheet));
+		}
+	}
+
+	return (int)reloaded_sheets.size();
+}
+
+void SetTextureMemoryBudget(size_t budget)
+{
+	TextureDatabase::SetMemoryBudget(budget);
+}
+
+TextureMemoryStatistics GetTextureMemoryStatistics()
+{
+	return TextureDatabase::GetMemoryStatistics();
+}
+
+void SetTextureAtlas(int max_texture_size, int page_size)
+{
+	TextureAtlas::Configure(max_texture_size, page_size);
+}
+
+TextureAtlasStatistics GetTextureAtlasStatistics()
+{
+	return TextureAtlas::GetStatistics();
+}
+
 void ReleaseCompiledGeometry()
 {
-	return GeometryDatabase::ReleaseAll();
+	GeometryDatabase::ReleaseAll();
+
+	for (const auto& pair : contexts)
+		pair.second->geometry_arena->ReleaseAll();
 }
 
 void ReleaseMemoryPools()
@@ -388,4 +508,19 @@ void ReleaseMemoryPools()
 	}
 }
 
+void SetProfileRecording(bool enable)
+{
+	ProfileRecorder::SetEnabled(enable);
+}
+
+String GetProfileRecording(ProfileRecordingFormat format)
+{
+	return ProfileRecorder::GetRecording(format);
+}
+
+void ClearProfileRecording()
+{
+	ProfileRecorder::Clear();
+}
+
 } // namespace Rml
@@ -54,7 +54,10 @@ bool DataControllerValue::Initialize(DataModel& model, Element* element, const S
 		return false;
 
 	if (model.GetVariable(variable_address))
+	{
+		variable_id = model.GetVariableId(variable_address.front().name);
 		address = std::move(variable_address);
+	}
 	
 	element->AddEventListener(EventId::Change, this);
 
@@ -81,9 +84,16 @@ void DataControllerValue::ProcessEvent(Event& event)
 		if (value_to_set.GetType() == Variant::NONE || !model)
 			return;
 
-		if (DataVariable variable = model->GetVariable(address))
+		if (DataVariable variable = model->GetVariable(variable_id, address))
+		{
 			if (variable.Set(value_to_set))
-				model->DirtyVariable(address.front().name);
+			{
+				if (variable_id >= 0)
+					model->DirtyVariable(variable_id);
+				else
+					model->DirtyVariable(address.front().name);
+			}
+		}
 	}
 }
 
@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/DataVariable.h"
 #include "DataController.h"
+#include "DataModel.h"
 
 namespace Rml {
 
@@ -57,6 +58,7 @@ private:
     void Release() override;
 
     DataAddress address;
+    DataVariableId variable_id = -1;
 };
 
 
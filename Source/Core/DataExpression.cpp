@@ -165,6 +165,7 @@ public:
 	{
 		program.clear();
 		variable_addresses.clear();
+		variable_ids.clear();
 		index = 0;
 		reached_end = false;
 		parse_error = false;
@@ -198,6 +199,10 @@ public:
 		RMLUI_ASSERT(!parse_error);
 		return std::move(variable_addresses);
 	}
+	VariableIdList ReleaseVariableIds() {
+		RMLUI_ASSERT(!parse_error);
+		return std::move(variable_ids);
+	}
 
 	void Emit(Instruction instruction, Variant data = Variant())
 	{
@@ -242,6 +247,7 @@ private:
 			return;
 		}
 		int index = int(variable_addresses.size());
+		variable_ids.push_back(expression_interface.GetVariableId(address));
 		variable_addresses.push_back(std::move(address));
 		program.push_back(InstructionData{ is_assignment ? Instruction::Assign : Instruction::Variable, Variant(int(index)) });
 	}
@@ -257,6 +263,7 @@ private:
 	Program program;
 	
 	AddressList variable_addresses;
+	VariableIdList variable_ids;
 };
 
 
@@ -752,8 +759,11 @@ namespace Parse {
 
 class DataInterpreter {
 public:
-	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface)
-		: program(program), addresses(addresses), expression_interface(expression_interface) {}
+	DataInterpreter(const Program& program, const AddressList& addresses, const VariableIdList& variable_ids, DataExpressionInterface expression_interface)
+		: program(program), addresses(addresses), variable_ids(variable_ids), expression_interface(expression_interface)
+	{
+		RMLUI_ASSERT(addresses.size() == variable_ids.size());
+	}
 
 	bool Error(String message) const
 	{
@@ -811,6 +821,7 @@ private:
 
 	const Program& program;
 	const AddressList& addresses;
+	const VariableIdList& variable_ids;
 	DataExpressionInterface expression_interface;
 
 	bool Execute(const Instruction instruction, const Variant& data)
@@ -851,7 +862,7 @@ private:
 		{
 			size_t variable_index = size_t(data.Get<int>(-1));
 			if (variable_index < addresses.size())
-				R = expression_interface.GetValue(addresses[variable_index]);
+				R = expression_interface.GetValue(variable_ids[variable_index], addresses[variable_index]);
 			else
 				return Error("Variable address not found.");
 		}
@@ -958,7 +969,7 @@ private:
 			size_t variable_index = size_t(data.Get<int>(-1));
 			if (variable_index < addresses.size())
 			{
-				if (!expression_interface.SetValue(addresses[variable_index], R))
+				if (!expression_interface.SetValue(variable_ids[variable_index], addresses[variable_index], R))
 					return Error("Could not assign to variable.");
 			}
 			else
@@ -987,13 +998,14 @@ bool DataExpression::Parse(const DataExpressionInterface& expression_interface,
 
 	program = parser.ReleaseProgram();
 	addresses = parser.ReleaseAddresses();
+	variable_ids = parser.ReleaseVariableIds();
 
 	return true;
 }
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
-	DataInterpreter interpreter(program, addresses, expression_interface);
+	DataInterpreter interpreter(program, addresses, variable_ids, expression_interface);
 	
 	if (!interpreter.Run())
 		return false;
@@ -1024,9 +1036,16 @@ DataAddress DataExpressionInterface::ParseAddress(const String& address_str) con
 
 	return data_model ? data_model->ResolveAddress(address_str, element) : DataAddress();
 }
-Variant DataExpressionInterface::GetValue(const DataAddress& address) const
+DataVariableId DataExpressionInterface::GetVariableId(const DataAddress& address) const
+{
+	if (!data_model || address.empty())
+		return -1;
+	return data_model->GetVariableId(address.front().name);
+}
+Variant DataExpressionInterface::GetValue(DataVariableId variable_id, const DataAddress& address) const
 {
 	Variant result;
+	// Event parameters take precedence, 'ev' is a reserved name and thus never interned as a model variable.
 	if(event && address.size() == 2 && address.front().name == "ev")
 	{
 		auto& parameters = event->GetParameters();
@@ -1036,21 +1055,26 @@ Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 	}
 	else if (data_model)
 	{
-		data_model->GetVariableInto(address, result);
+		data_model->GetVariableInto(variable_id, address, result);
 	}
 	return result;
 }
 
-bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant& value) const
+bool DataExpressionInterface::SetValue(DataVariableId variable_id, const DataAddress& address, const Variant& value) const
 {
 	bool result = false;
 	if (data_model && !address.empty())
 	{
-		if (DataVariable variable = data_model->GetVariable(address))
+		if (DataVariable variable = data_model->GetVariable(variable_id, address))
 			result = variable.Set(value);
 
 		if (result)
-			data_model->DirtyVariable(address.front().name);
+		{
+			if (variable_id >= 0)
+				data_model->DirtyVariable(variable_id);
+			else
+				data_model->DirtyVariable(address.front().name);
+		}
 	}
 	return result;
 }
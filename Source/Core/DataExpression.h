@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "DataModel.h"
 
 namespace Rml {
 
@@ -40,6 +41,7 @@ class DataModel;
 struct InstructionData;
 using Program = Vector<InstructionData>;
 using AddressList = Vector<DataAddress>;
+using VariableIdList = Vector<DataVariableId>;
 
 class DataExpressionInterface {
 public:
@@ -47,8 +49,9 @@ public:
     DataExpressionInterface(DataModel* data_model, Element* element, Event* event = nullptr);
 
     DataAddress ParseAddress(const String& address_str) const;
-    Variant GetValue(const DataAddress& address) const;
-    bool SetValue(const DataAddress& address, const Variant& value) const;
+    DataVariableId GetVariableId(const DataAddress& address) const;
+    Variant GetValue(DataVariableId variable_id, const DataAddress& address) const;
+    bool SetValue(DataVariableId variable_id, const DataAddress& address, const Variant& value) const;
     bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments);
     bool EventCallback(const String& name, const VariantList& arguments);
 
@@ -76,6 +79,8 @@ private:
     
     Program program;
     AddressList addresses;
+    // Interned ids of the top-level variable of each address, resolved once during parsing.
+    VariableIdList variable_ids;
 };
 
 } // namespace Rml
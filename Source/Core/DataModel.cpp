@@ -120,6 +120,19 @@ static String DataAddressToString(const DataAddress& address)
 	return result;
 }
 
+// Follows the address from the given top-level variable to its final child.
+static DataVariable GetChildVariable(DataVariable variable, const DataAddress& address)
+{
+	for (int i = 1; i < (int)address.size() && variable; i++)
+	{
+		variable = variable.Child(address[i]);
+		if (!variable)
+			return DataVariable();
+	}
+
+	return variable;
+}
+
 DataModel::DataModel(const TransformFuncRegister* transform_register) : transform_register(transform_register)
 {
 	views = MakeUnique<DataViews>();
@@ -154,13 +167,15 @@ bool DataModel::BindVariable(const String& name, DataVariable variable)
 		return false;
 	}
 
-	bool inserted = variables.emplace(name, variable).second;
+	bool inserted = variable_ids.emplace(name, DataVariableId(variables.size())).second;
 	if (!inserted)
 	{
 		Log::Message(Log::LT_WARNING, "Data model variable with name '%s' already exists.", name.c_str());
 		return false;
 	}
 
+	variables.push_back(variable);
+
 	return true;
 }
 
@@ -213,7 +228,7 @@ bool DataModel::InsertAlias(Element* element, const String& alias_name, DataAddr
 		return false;
 	}
 
-	if (variables.count(alias_name) == 1)
+	if (variable_ids.count(alias_name) == 1)
 		Log::Message(Log::LT_WARNING, "Alias variable '%s' is shadowed by a global variable.", alias_name.c_str());
 
 	auto& map = aliases.emplace(element, SmallUnorderedMap<String, DataAddress>()).first->second;
@@ -241,8 +256,8 @@ DataAddress DataModel::ResolveAddress(const String& address_str, Element* elemen
 
 	const String& first_name = address.front().name;
 
-	auto it = variables.find(first_name);
-	if (it != variables.end())
+	auto it = variable_ids.find(first_name);
+	if (it != variable_ids.end())
 		return address;
 
 	// Look for a variable alias for the first name.
@@ -279,25 +294,22 @@ DataAddress DataModel::ResolveAddress(const String& address_str, Element* elemen
 	return DataAddress();
 }
 
+DataVariableId DataModel::GetVariableId(const String& variable_name) const
+{
+	auto it = variable_ids.find(variable_name);
+	if (it == variable_ids.end())
+		return -1;
+	return it->second;
+}
+
 DataVariable DataModel::GetVariable(const DataAddress& address) const
 {
 	if (address.empty())
 		return DataVariable();
 
-	auto it = variables.find(address.front().name);
-	if (it != variables.end())
-	{
-		DataVariable variable = it->second;
-
-		for (int i = 1; i < (int)address.size() && variable; i++)
-		{
-			variable = variable.Child(address[i]);
-			if (!variable)
-				return DataVariable();
-		}
-
-		return variable;
-	}
+	const DataVariableId variable_id = GetVariableId(address.front().name);
+	if (variable_id >= 0)
+		return GetChildVariable(variables[variable_id], address);
 
 	if (address[0].name == "literal")
 	{
@@ -308,6 +320,17 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 	return DataVariable();
 }
 
+DataVariable DataModel::GetVariable(DataVariableId variable_id, const DataAddress& address) const
+{
+	if (variable_id < 0)
+		return GetVariable(address);
+
+	RMLUI_ASSERTMSG(variable_id < (int)variables.size() && !address.empty() && GetVariableId(address.front().name) == variable_id,
+		"Variable id does not match the address.");
+
+	return GetChildVariable(variables[variable_id], address);
+}
+
 const DataEventFunc* DataModel::GetEventCallback(const String& name)
 {
 	auto it = event_callbacks.find(name);
@@ -321,7 +344,11 @@ const DataEventFunc* DataModel::GetEventCallback(const String& name)
 }
 
 bool DataModel::GetVariableInto(const DataAddress& address, Variant& out_value) const {
-	DataVariable variable = GetVariable(address);
+	return GetVariableInto(GetVariableId(address.empty() ? String() : address.front().name), address, out_value);
+}
+
+bool DataModel::GetVariableInto(DataVariableId variable_id, const DataAddress& address, Variant& out_value) const {
+	DataVariable variable = GetVariable(variable_id, address);
 	bool result = (variable && variable.Get(out_value));
 	if (!result)
 		Log::Message(Log::LT_WARNING, "Could not get value from data variable '%s'.", DataAddressToString(address).c_str());
@@ -331,14 +358,23 @@ bool DataModel::GetVariableInto(const DataAddress& address, Variant& out_value)
 void DataModel::DirtyVariable(const String& variable_name)
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	RMLUI_ASSERTMSG(variables.count(variable_name) == 1, "In DirtyVariable: Variable name not found among added variables.");
-	dirty_variables.emplace(variable_name);
+	const DataVariableId variable_id = GetVariableId(variable_name);
+	RMLUI_ASSERTMSG(variable_id >= 0, "In DirtyVariable: Variable name not found among added variables.");
+	if (variable_id >= 0)
+		dirty_variables.emplace(variable_id);
+}
+
+void DataModel::DirtyVariable(DataVariableId variable_id)
+{
+	RMLUI_ASSERT(variable_id >= 0 && variable_id < (int)variables.size());
+	dirty_variables.emplace(variable_id);
 }
 
 bool DataModel::IsVariableDirty(const String& variable_name) const
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	return dirty_variables.count(variable_name) == 1;
+	const DataVariableId variable_id = GetVariableId(variable_name);
+	return variable_id >= 0 && dirty_variables.count(variable_id) == 1;
 }
 
 bool DataModel::CallTransform(const String& name, Variant& inout_result, const VariantList& arguments) const
@@ -43,6 +43,10 @@ class DataVariable;
 class Element;
 class FuncDefinition;
 
+// Top-level data variables are interned to integer ids when bound, ids are stable for the lifetime of the model.
+using DataVariableId = int;
+using DirtyVariableIds = SmallUnorderedSet<DataVariableId>;
+
 
 class DataModel : NonCopyMoveable {
 public:
@@ -63,10 +67,19 @@ public:
 	DataAddress ResolveAddress(const String& address_str, Element* element) const;
 	const DataEventFunc* GetEventCallback(const String& name);
 
+	// Returns the interned id of the given top-level variable name, or -1 if no such variable is bound.
+	DataVariableId GetVariableId(const String& variable_name) const;
+
 	DataVariable GetVariable(const DataAddress& address) const;
 	bool GetVariableInto(const DataAddress& address, Variant& out_value) const;
 
+	// Equivalent to the above, but uses the pre-resolved id of the address' top-level variable instead of looking up its name.
+	// The id may be -1, such as for 'literal' addresses, then the name lookup is used instead.
+	DataVariable GetVariable(DataVariableId variable_id, const DataAddress& address) const;
+	bool GetVariableInto(DataVariableId variable_id, const DataAddress& address, Variant& out_value) const;
+
 	void DirtyVariable(const String& variable_name);
+	void DirtyVariable(DataVariableId variable_id);
 	bool IsVariableDirty(const String& variable_name) const;
 
 	bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments) const;
@@ -83,8 +96,9 @@ private:
 	UniquePtr<DataViews> views;
 	UniquePtr<DataControllers> controllers;
 
-	UnorderedMap<String, DataVariable> variables;
-	DirtyVariables dirty_variables;
+	UnorderedMap<String, DataVariableId> variable_ids;
+	Vector<DataVariable> variables;
+	DirtyVariableIds dirty_variables;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
 	UnorderedMap<String, DataEventFunc> event_callbacks;
@@ -87,7 +87,7 @@ void DataViews::OnElementRemove(Element* element)
 	}
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+bool DataViews::Update(DataModel& model, const DirtyVariableIds& dirty_variables)
 {
 	bool result = false;
 	size_t num_dirty_variables_prev = 0;
@@ -108,16 +108,20 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 			{
 				dirty_views.push_back(view.get());
 				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+				{
+					const DataVariableId variable_id = model.GetVariableId(variable_name);
+					if (variable_id >= 0)
+						variable_view_map.emplace(variable_id, view.get());
+				}
 
 				views.push_back(std::move(view));
 			}
 			views_to_add.clear();
 		}
 
-		for (const String& variable_name : dirty_variables)
+		for (const DataVariableId variable_id : dirty_variables)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
+			auto pair = variable_view_map.equal_range(variable_id);
 			for (auto it = pair.first; it != pair.second; ++it)
 				dirty_views.push_back(it->second);
 		}
@@ -147,10 +151,10 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 		{
 			for (const auto& view : views_to_remove)
 			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end(); )
+				for (auto it = variable_view_map.begin(); it != variable_view_map.end(); )
 				{
 					if (it->second == view.get())
-						it = name_view_map.erase(it);
+						it = variable_view_map.erase(it);
 					else
 						++it;
 				}
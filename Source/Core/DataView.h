@@ -33,11 +33,11 @@
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "DataModel.h"
 
 namespace Rml {
 
 class Element;
-class DataModel;
 
 
 class DataViewInstancer : public NonCopyMoveable {
@@ -117,7 +117,7 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	bool Update(DataModel& model, const DirtyVariableIds& dirty_variables);
 
 private:
 	using DataViewList = Vector<DataViewPtr>;
@@ -127,8 +127,9 @@ private:
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
-	NameViewMap name_view_map;
+	// Views are looked up by the interned id of their variables, names are resolved once when the view is added.
+	using VariableViewMap = UnorderedMultimap<DataVariableId, DataView*>;
+	VariableViewMap variable_view_map;
 };
 
 } // namespace Rml
@@ -528,6 +528,8 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 	if (container_address.empty())
 		return false;
 
+	container_variable_id = model.GetVariableId(container_address.front().name);
+
 	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
 
 	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
@@ -547,7 +549,7 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 
 bool DataViewFor::Update(DataModel& model)
 {
-	DataVariable variable = model.GetVariable(container_address);
+	DataVariable variable = model.GetVariable(container_variable_id, container_address);
 	if (!variable)
 		return false;
 
@@ -173,6 +173,7 @@ protected:
 
 private:
 	DataAddress container_address;
+	DataVariableId container_variable_id = -1;
 	String iterator_name;
 	String iterator_index_name;
 	String rml_contents;
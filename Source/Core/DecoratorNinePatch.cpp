@@ -86,8 +86,10 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 
 	// Normalized texture coordinates [0, 1]
 	Vector2f tex_coords[4];
+	Vector2f tex_region[2];
+	texture->GetTexCoords(render_interface, tex_region[0], tex_region[1]);
 	for (int i = 0; i < 4; i++)
-		tex_coords[i] = tex_pos[i] / texture_dimensions;
+		tex_coords[i] = tex_region[0] + tex_pos[i] / texture_dimensions * (tex_region[1] - tex_region[0]);
 
 	// Natural size is determined from the raw pixel size multiplied by the dp-ratio and the sprite's
 	// display scale (determined by eg. the inverse of spritesheet's 'src-scale').
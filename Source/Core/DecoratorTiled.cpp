@@ -69,6 +69,10 @@ void DecoratorTiled::Tile::CalculateDimensions(Element* element, const Texture&
 		TileData new_data;
 		const Vector2f texture_dimensions(texture.GetDimensions(render_interface));
 
+		// Try again once the texture has finished loading in the background.
+		if (texture.IsLoading(render_interface))
+			return;
+
 		if (texture_dimensions.x == 0 || texture_dimensions.y == 0)
 		{
 			new_data.size = Vector2f(0, 0);
@@ -89,6 +93,12 @@ void DecoratorTiled::Tile::CalculateDimensions(Element* element, const Texture&
 
 			new_data.texcoords[0] = position / texture_dimensions;
 			new_data.texcoords[1] = size_relative + new_data.texcoords[0];
+
+			// Map the coordinates into the texture's region of its atlas page, if any.
+			Vector2f region[2];
+			texture.GetTexCoords(render_interface, region[0], region[1]);
+			for (Vector2f& texcoord : new_data.texcoords)
+				texcoord = region[0] + texcoord * (region[1] - region[0]);
 		}
 
 		data.emplace( render_interface, new_data );
@@ -0,0 +1,248 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "DocumentPreloader.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include "CompiledDocument.h"
+#include "DocumentHeader.h"
+#include "ProfileRecorder.h"
+#include "StyleSheetFactory.h"
+#include "Template.h"
+#include "TemplateCache.h"
+
+namespace Rml {
+
+static UniquePtr<DocumentPreloader> instance;
+
+// Loads the templates and external style sheets of the document into their caches, mirroring ElementDocument::ProcessHeader().
+static void PreloadHeadResources(const CompiledDocument& document)
+{
+	XMLParser parser(nullptr);
+	document.InstanceHead(parser);
+	const DocumentHeader* document_header = parser.GetDocumentHeader();
+
+	DocumentHeader header;
+	header.MergePaths(header.template_resources, document_header->template_resources, document_header->source);
+
+	for (size_t i = 0; i < header.template_resources.size(); i++)
+	{
+		if (Template* merge_template = TemplateCache::LoadTemplate(URL(header.template_resources[i]).GetURL()))
+			header.MergeHeader(*merge_template->GetHeader());
+	}
+
+	header.MergeHeader(*document_header);
+
+	// Inline style sheets are parsed along with the document, as they are not cached.
+	for (const DocumentHeader::Resource& rcss : header.rcss)
+	{
+		if (!rcss.is_inline)
+			StyleSheetFactory::GetStyleSheetContainer(rcss.path);
+	}
+}
+
+void DocumentPreloader::Preload(const StringList& document_paths, int num_threads)
+{
+	if (!instance)
+		instance.reset(new DocumentPreloader());
+
+	if (num_threads <= 0)
+	{
+		for (const String& document_path : document_paths)
+		{
+			{
+				std::lock_guard<std::mutex> lock(instance->mutex);
+				if (!instance->entries.emplace(document_path, Entry{State::Loading, nullptr}).second)
+					continue;
+				instance->num_pending += 1;
+			}
+			instance->Finish(document_path, Load(document_path));
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(instance->mutex);
+		for (const String& document_path : document_paths)
+		{
+			// Documents already preloaded are left as is.
+			if (instance->entries.emplace(document_path, Entry{}).second)
+			{
+				instance->jobs.push(document_path);
+				instance->num_pending += 1;
+			}
+		}
+	}
+	instance->job_condition.notify_all();
+
+	while ((int)instance->threads.size() < num_threads)
+		instance->threads.emplace_back(&DocumentPreloader::Run, instance.get());
+}
+
+UniquePtr<CompiledDocument> DocumentPreloader::Take(const String& document_path)
+{
+	if (!instance)
+		return nullptr;
+
+	std::unique_lock<std::mutex> lock(instance->mutex);
+
+	auto it = instance->entries.find(document_path);
+	if (it == instance->entries.end())
+		return nullptr;
+
+	if (it->second.state == State::Queued)
+	{
+		// Not started by any worker yet, load it here rather than waiting for the queue to reach it.
+		it->second.state = State::Loading;
+		lock.unlock();
+		instance->Finish(document_path, Load(document_path));
+		lock.lock();
+	}
+	else
+	{
+		RMLUI_ZoneScopedN("WaitForPreload");
+		instance->done_condition.wait(lock, [&] { return instance->entries[document_path].state == State::Done; });
+	}
+
+	// Look up the entry again, as iterators are invalidated when other documents are added.
+	it = instance->entries.find(document_path);
+	RMLUI_ASSERT(it != instance->entries.end() && it->second.state == State::Done);
+
+	UniquePtr<CompiledDocument> document = std::move(it->second.document);
+	instance->entries.erase(it);
+
+	return document;
+}
+
+int DocumentPreloader::GetNumPending()
+{
+	if (!instance)
+		return 0;
+
+	std::lock_guard<std::mutex> lock(instance->mutex);
+	return instance->num_pending;
+}
+
+void DocumentPreloader::Shutdown()
+{
+	instance.reset();
+}
+
+DocumentPreloader::~DocumentPreloader()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	job_condition.notify_all();
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+void DocumentPreloader::Run()
+{
+	while (true)
+	{
+		String document_path;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			job_condition.wait(lock, [this] { return stop || !jobs.empty(); });
+
+			// Queued documents are discarded when stopping.
+			if (stop)
+				return;
+
+			document_path = std::move(jobs.front());
+			jobs.pop();
+
+			// The document may have been taken and loaded by the main thread in the meantime.
+			auto it = entries.find(document_path);
+			if (it == entries.end() || it->second.state != State::Queued)
+				continue;
+
+			it->second.state = State::Loading;
+		}
+
+		Finish(document_path, Load(document_path));
+	}
+}
+
+void DocumentPreloader::Finish(const String& document_path, UniquePtr<CompiledDocument> document)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		Entry& entry = entries[document_path];
+		entry.state = State::Done;
+		entry.document = std::move(document);
+		num_pending -= 1;
+	}
+	done_condition.notify_all();
+}
+
+UniquePtr<CompiledDocument> DocumentPreloader::Load(const String& document_path)
+{
+	RMLUI_ZoneScopedN("PreloadDocument");
+	RMLUI_RecordZone("PreloadDocument");
+	RMLUI_RecordZoneText(document_path);
+
+	FileInterface* file_interface = GetFileInterface();
+
+	String document_rml;
+	const bool has_source = file_interface->LoadFile(document_path, document_rml);
+
+	// Use the same source URL as when streaming the source file.
+	const String source_url = StringUtilities::Replace(document_path, ':', '|');
+
+	auto document = MakeUnique<CompiledDocument>();
+
+	String compiled_data;
+	if (!GetCompiledFileLoading() || !file_interface->LoadFile(CompiledDocument::GetBinaryPath(document_path), compiled_data) ||
+		!document->Read(compiled_data, URL(source_url), has_source ? &document_rml : nullptr))
+	{
+		if (!has_source)
+			return nullptr;
+
+		StreamMemory stream((const byte*)document_rml.data(), document_rml.size());
+		stream.SetSourceURL(source_url);
+
+		document = MakeUnique<CompiledDocument>();
+		document->Compile(&stream);
+	}
+
+	PreloadHeadResources(*document);
+
+	return document;
+}
+
+} // namespace Rml
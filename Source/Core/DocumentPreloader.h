@@ -0,0 +1,96 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#ifndef RMLUI_CORE_DOCUMENTPRELOADER_H
+#define RMLUI_CORE_DOCUMENTPRELOADER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+
+class CompiledDocument;
+
+/**
+	Loads documents on a pool of worker threads, ahead of them being requested by a context. Each document is tokenized
+	into a compiled document, or read from its compiled binary, and the templates and style sheets linked from its head
+	are loaded into their caches. Loading the document into a context on the main thread then only instances its elements.
+ */
+
+class DocumentPreloader : NonCopyMoveable {
+public:
+	/// Queues the documents for loading on the worker threads, adding threads as necessary.
+	/// @param[in] document_paths The paths of the documents to load.
+	/// @param[in] num_threads The number of worker threads, or zero to load the documents immediately on the calling thread.
+	static void Preload(const StringList& document_paths, int num_threads);
+
+	/// Takes the preloaded document at the given path, waiting for it if it is still being loaded.
+	/// @param[in] document_path The path of the document.
+	/// @return The compiled document, or nullptr if the document was not preloaded or could not be loaded.
+	static UniquePtr<CompiledDocument> Take(const String& document_path);
+
+	/// Returns the number of documents queued or being loaded.
+	static int GetNumPending();
+
+	/// Stops the worker threads after finishing any documents being loaded, and discards all preloaded documents.
+	static void Shutdown();
+
+	~DocumentPreloader();
+
+private:
+	DocumentPreloader() = default;
+
+	enum class State { Queued, Loading, Done };
+	struct Entry {
+		State state = State::Queued;
+		UniquePtr<CompiledDocument> document;
+	};
+
+	void Run();
+	void Finish(const String& document_path, UniquePtr<CompiledDocument> document);
+
+	static UniquePtr<CompiledDocument> Load(const String& document_path);
+
+	Vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable job_condition;
+	std::condition_variable done_condition;
+	bool stop = false;
+
+	// Protected by the mutex.
+	Queue<String> jobs;
+	UnorderedMap<String, Entry> entries;
+	int num_pending = 0;
+};
+
+} // namespace Rml
+#endif
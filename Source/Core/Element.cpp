@@ -42,16 +42,20 @@
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
 #include "Clock.h"
+#include "CompiledDocument.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
 #include "ElementAnimation.h"
 #include "ElementBackgroundBorder.h"
 #include "ElementDefinition.h"
+#include "ElementLayer.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
 #include "ElementDecoration.h"
+#include "HitTestGrid.h"
 #include "LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "PropertiesIterator.h"
@@ -63,6 +67,7 @@
 #include "XMLParseTools.h"
 #include <algorithm>
 #include <cmath>
+#include <float.h>
 
 namespace Rml {
 
@@ -80,6 +85,7 @@ struct ElementMeta
 	ElementDecoration decoration;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+	UniquePtr<ElementLayer> layer;
 };
 
 
@@ -88,7 +94,7 @@ static Pool< ElementMeta > element_meta_chunk_pool(200, true);
 
 /// Constructs a new RmlUi element.
 Element::Element(const String& tag) : tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), content_offset(0, 0), content_box(0, 0), 
-transform_state(), dirty_transform(false), dirty_perspective(false), dirty_animation(false), dirty_transition(false)
+transform_state(), dirty_transform(false), dirty_local_transform(false), dirty_perspective(false), dirty_animation(false), dirty_transition(false)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
 	parent = nullptr;
@@ -100,6 +106,10 @@ transform_state(), dirty_transform(false), dirty_perspective(false), dirty_anima
 	offset_parent = nullptr;
 	absolute_offset_dirty = true;
 
+	clip_dirty = true;
+	clip_enabled = false;
+	children_clip_enabled = false;
+
 	client_area = Box::PADDING;
 
 	baseline = 0.0f;
@@ -218,24 +228,44 @@ void Element::Render()
 
 	UpdateTransformState();
 
+	// Elements with a cached layer render their contents into the layer when needed, and otherwise draw the layer only.
+	if (meta->layer && meta->layer->Render())
+		return;
+
+	RenderContents();
+}
+
+void Element::RenderContents()
+{
 	// Render all elements in our local stacking context that have a z-index beneath our local index of 0.
 	size_t i = 0;
 	for (; i < stacking_context.size() && stacking_context[i]->z_index < 0; ++i)
 		stacking_context[i]->Render();
 
-	// Apply our transform
-	ElementUtilities::ApplyTransform(*this);
+	// Skip rendering what is entirely outside the visible area. Elements in our stacking context are culled separately.
+	bool render_box = true, render_contents = true;
+	UpdateCulling(render_box, render_contents);
 
-	// Set up the clipping region for this element.
-	if (ElementUtilities::SetClippingRegion(this))
+	if (render_box || render_contents)
 	{
-		meta->background_border.Render(this);
-		meta->decoration.RenderDecorators();
+		// Apply our transform
+		ElementUtilities::ApplyTransform(*this);
 
+		// Set up the clipping region for this element.
+		if (ElementUtilities::SetClippingRegion(this))
 		{
-			RMLUI_ZoneScopedNC("OnRender", 0x228B22);
+			if (render_box)
+			{
+				meta->background_border.Render(this);
+				meta->decoration.RenderDecorators();
+			}
 
-			OnRender();
+			if (render_contents)
+			{
+				RMLUI_ZoneScopedNC("OnRender", 0x228B22);
+
+				OnRender();
+			}
 		}
 	}
 
@@ -273,10 +303,22 @@ ElementPtr Element::Clone() const
 
 		clone->GetStyle()->SetClassNames(GetStyle()->GetClassNames());
 
-		String inner_rml;
-		GetInnerRML(inner_rml);
+		// Instance the children from a recording of the tree. This produces the same elements as parsing the inner RML,
+		// but without generating and tokenizing it.
+		Context* context = GetContext();
+		CompiledDocument children_document;
+		if (!children_document.CompileChildren(this, context ? context->GetDocumentsBaseTag() : "body"))
+		{
+			String inner_rml;
+			GetInnerRML(inner_rml);
 
-		clone->SetInnerRML(inner_rml);
+			clone->SetInnerRML(inner_rml);
+		}
+		else if (HasChildNodes())
+		{
+			XMLParser parser(clone.get());
+			children_document.Instance(parser);
+		}
 	}
 
 	return clone;
@@ -463,10 +505,16 @@ void Element::SetBox(const Box& box)
 		additional_boxes.clear();
 
 		OnResize();
+		DirtyClippingRegion();
+		DirtyRenderCache();
+		DirtyHitTestGrid();
 
-		meta->background_border.DirtyBackground();
-		meta->background_border.DirtyBorder();
+		meta->background_border.DirtySize();
 		meta->decoration.DirtyDecoratorsData();
+
+		// Transforms and perspectives may be relative to the size of the element.
+		if (transform_state)
+			DirtyTransformState(true, true, true);
 	}
 }
 
@@ -476,10 +524,15 @@ void Element::AddBox(const Box& box, Vector2f offset)
 	additional_boxes.emplace_back(PositionedBox{ box, offset });
 
 	OnResize();
+	DirtyClippingRegion();
+	DirtyRenderCache();
+	DirtyHitTestGrid();
 
-	meta->background_border.DirtyBackground();
-	meta->background_border.DirtyBorder();
+	meta->background_border.DirtySize();
 	meta->decoration.DirtyDecoratorsData();
+
+	if (transform_state)
+		DirtyTransformState(true, true, true);
 }
 
 // Returns one of the boxes describing the size of the element.
@@ -591,6 +644,23 @@ bool Element::SetProperty(PropertyId id, const Property& property)
 	return meta->style.SetProperty(id, property);
 }
 
+// Sets a local numeric property override on the element.
+bool Element::SetProperty(PropertyId id, float value, Property::Unit unit)
+{
+	if (!(unit & (Property::NUMBER_LENGTH_PERCENT | Property::ANGLE)))
+	{
+		Log::Message(Log::LT_WARNING, "Invalid unit for numeric property '%s'.", StyleSheetSpecification::GetPropertyName(id).c_str());
+		return false;
+	}
+	return meta->style.SetProperty(id, Property(value, unit));
+}
+
+// Sets a local colour property override on the element.
+bool Element::SetProperty(PropertyId id, Colourb colour)
+{
+	return meta->style.SetProperty(id, Property(colour, Property::COLOUR));
+}
+
 // Removes a local property override on the element.
 void Element::RemoveProperty(const String& name)
 {
@@ -1130,6 +1200,11 @@ void Element::GetInnerRML(String& content) const
 	}
 }
 
+bool Element::IsRMLDefinedByChildren() const
+{
+	return true;
+}
+
 // Gets the markup and content of the element.
 String Element::GetInnerRML() const {
 	String result;
@@ -1656,6 +1731,10 @@ void Element::OnStyleSheetChange()
 {
 }
 
+void Element::OnTexturesLoaded()
+{
+}
+
 // Called when attributes on the element are changed.
 void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
@@ -1728,6 +1807,8 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
 
+	DirtyRenderCache();
+
 	if (!IsLayoutDirty())
 	{
 		// Force a relayout if any of the changed properties require it.
@@ -1790,7 +1871,8 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		if (z_index_property.type == Style::ZIndex::Auto)
 		{
 			if (local_stacking_context &&
-				!local_stacking_context_forced)
+				!local_stacking_context_forced &&
+				meta->computed_values.render_cache == Style::RenderCache::None)
 			{
 				// We're no longer acting as a stacking context.
 				local_stacking_context = false;
@@ -1827,27 +1909,30 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	}
 
 	// Dirty the background if it's changed.
-    if (border_radius_changed ||
-		changed_properties.Contains(PropertyId::BackgroundColor) ||
-		changed_properties.Contains(PropertyId::Opacity) ||
-		changed_properties.Contains(PropertyId::ImageColor))
+	if (border_radius_changed)
 	{
 		meta->background_border.DirtyBackground();
-    }
+	}
 
 	// Dirty the border if it's changed.
 	if (border_radius_changed ||
 		changed_properties.Contains(PropertyId::BorderTopWidth) ||
 		changed_properties.Contains(PropertyId::BorderRightWidth) ||
 		changed_properties.Contains(PropertyId::BorderBottomWidth) ||
-		changed_properties.Contains(PropertyId::BorderLeftWidth) ||
+		changed_properties.Contains(PropertyId::BorderLeftWidth))
+	{
+		meta->background_border.DirtyBorder();
+	}
+
+	// Color changes can be applied to the existing background and border geometry.
+	if (changed_properties.Contains(PropertyId::BackgroundColor) ||
 		changed_properties.Contains(PropertyId::BorderTopColor) ||
 		changed_properties.Contains(PropertyId::BorderRightColor) ||
 		changed_properties.Contains(PropertyId::BorderBottomColor) ||
 		changed_properties.Contains(PropertyId::BorderLeftColor) ||
 		changed_properties.Contains(PropertyId::Opacity))
 	{
-		meta->background_border.DirtyBorder();
+		meta->background_border.DirtyColors();
 	}
 	
 	// Dirty the decoration if it's changed.
@@ -1878,9 +1963,60 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::TransformOriginY) ||
 		changed_properties.Contains(PropertyId::TransformOriginZ))
 	{
-		DirtyTransformState(false, true);
+		DirtyTransformState(false, true, true);
+	}
+
+	// Transforms may be specified in em-units, which are resolved against the current font size.
+	if (transform_state && changed_properties.Contains(PropertyId::FontSize))
+	{
+		DirtyTransformState(false, true, true);
 	}
 
+	// Check for changes to the clipping region
+	if (changed_properties.Contains(PropertyId::Clip) ||
+		changed_properties.Contains(PropertyId::OverflowX) ||
+		changed_properties.Contains(PropertyId::OverflowY))
+	{
+		DirtyClippingRegion();
+	}
+
+	// Layers capture the element's entire local stacking context, thus we need to establish one.
+	if (changed_properties.Contains(PropertyId::RenderCache))
+	{
+		if (meta->computed_values.render_cache == Style::RenderCache::Layer)
+		{
+			if (!meta->layer)
+				meta->layer = MakeUnique<ElementLayer>(this);
+
+			if (!local_stacking_context)
+			{
+				local_stacking_context = true;
+				stacking_context_dirty = true;
+				if (parent)
+					parent->DirtyStackingContext();
+			}
+		}
+		else
+		{
+			meta->layer.reset();
+
+			if (local_stacking_context && !local_stacking_context_forced && meta->computed_values.z_index.type == Style::ZIndex::Auto)
+			{
+				local_stacking_context = false;
+				stacking_context_dirty = false;
+				stacking_context.clear();
+				if (parent)
+					parent->DirtyStackingContext();
+			}
+		}
+	}
+
+	// Check for changes affecting hit testing not otherwise accounted for
+	if (changed_properties.Contains(PropertyId::PointerEvents))
+		DirtyHitTestGrid();
+	if (changed_properties.Contains(PropertyId::ZIndex))
+		DirtyHitTestGrid(true);
+
 	// Check for `animation' changes
 	if (changed_properties.Contains(PropertyId::Animation))
 	{
@@ -2074,7 +2210,14 @@ void Element::SetParent(Element* _parent)
 	// Assumes we are already detached from the hierarchy or we are detaching now.
 	RMLUI_ASSERT(!parent || !_parent);
 
+	// Dirty the layers and hit test grids of both the old and new ancestors.
+	DirtyRenderCache();
+	DirtyHitTestGrid(true);
 	parent = _parent;
+	DirtyRenderCache();
+
+	meta->event_dispatcher.OnParentChange();
+	DirtyClippingRegion();
 
 	if (parent)
 	{
@@ -2085,9 +2228,10 @@ void Element::SetParent(Element* _parent)
 
 	// The transform state may require recalculation.
 	if (transform_state || (parent && parent->transform_state))
-		DirtyTransformState(true, true);
+		DirtyTransformState(true, true, true);
 
 	SetOwnerDocument(parent ? parent->GetOwnerDocument() : nullptr);
+	DirtyHitTestGrid(true);
 
 	if (!parent)
 	{
@@ -2122,6 +2266,9 @@ void Element::SetParent(Element* _parent)
 
 void Element::DirtyAbsoluteOffset()
 {
+	DirtyClippingRegion();
+	DirtyRenderCache();
+
 	if (!absolute_offset_dirty)
 		DirtyAbsoluteOffsetRecursive();
 }
@@ -2131,6 +2278,7 @@ void Element::DirtyAbsoluteOffsetRecursive()
 	if (!absolute_offset_dirty)
 	{
 		absolute_offset_dirty = true;
+		DirtyHitTestGrid();
 
 		if (transform_state)
 			DirtyTransformState(true, true);
@@ -2140,6 +2288,116 @@ void Element::DirtyAbsoluteOffsetRecursive()
 		children[i]->DirtyAbsoluteOffsetRecursive();
 }
 
+bool Element::GetVisibleArea(Vector2f& visible_min, Vector2f& visible_max)
+{
+	// We don't attempt to find the screen-space bounds of transformed elements.
+	if (transform_state && transform_state->GetTransform())
+		return false;
+
+	Context* context = GetContext();
+	if (!context)
+		return false;
+
+	// The visible area is given by the context dimensions, limited by our clipping region.
+	visible_min = Vector2f(0.f);
+	visible_max = Vector2f(context->GetDimensions());
+
+	Vector2i clip_origin, clip_dimensions;
+	if (ElementUtilities::GetClippingRegion(clip_origin, clip_dimensions, this))
+	{
+		visible_min = Vector2f(Math::Max(visible_min.x, float(clip_origin.x)), Math::Max(visible_min.y, float(clip_origin.y)));
+		visible_max = Vector2f(Math::Min(visible_max.x, float(clip_origin.x + clip_dimensions.x)), Math::Min(visible_max.y, float(clip_origin.y + clip_dimensions.y)));
+	}
+
+	return true;
+}
+
+bool Element::GetRenderBounds(Vector2f& bounds_min, Vector2f& bounds_max)
+{
+	GetBorderBounds(bounds_min, bounds_max);
+	return true;
+}
+
+bool Element::IsCullable() const
+{
+	return false;
+}
+
+void Element::GetBorderBounds(Vector2f& bounds_min, Vector2f& bounds_max)
+{
+	const Vector2f position = GetAbsoluteOffset(Box::BORDER);
+
+	bounds_min = Vector2f(FLT_MAX);
+	bounds_max = Vector2f(-FLT_MAX);
+
+	for (int i = 0; i < GetNumBoxes(); i++)
+	{
+		Vector2f box_offset;
+		const Box& box = GetBox(i, box_offset);
+		const Vector2f box_min = position + box_offset;
+		const Vector2f box_max = box_min + box.GetSize(Box::BORDER);
+
+		bounds_min = Vector2f(Math::Min(bounds_min.x, box_min.x), Math::Min(bounds_min.y, box_min.y));
+		bounds_max = Vector2f(Math::Max(bounds_max.x, box_max.x), Math::Max(bounds_max.y, box_max.y));
+	}
+}
+
+void Element::UpdateCulling(bool& render_box, bool& render_contents)
+{
+	Vector2f visible_min, visible_max;
+	if (!GetVisibleArea(visible_min, visible_max))
+		return;
+
+	auto IsVisible = [&](Vector2f bounds_min, Vector2f bounds_max) {
+		return bounds_max.x >= visible_min.x && bounds_min.x <= visible_max.x && bounds_max.y >= visible_min.y && bounds_min.y <= visible_max.y;
+	};
+
+	// The background, border, and decorators are always rendered inside the border boxes.
+	Vector2f bounds_min, bounds_max;
+	GetBorderBounds(bounds_min, bounds_max);
+	render_box = IsVisible(bounds_min, bounds_max);
+
+	// OnRender() may render anywhere, unless the element guarantees that its render bounds cover everything it renders.
+	if (IsCullable() && GetRenderBounds(bounds_min, bounds_max))
+		render_contents = IsVisible(bounds_min, bounds_max);
+}
+
+void Element::DirtyRenderCache()
+{
+	if (!ElementLayer::AnyLayers())
+		return;
+
+	for (Element* element = this; element; element = element->parent)
+	{
+		if (element->meta->layer)
+			element->meta->layer->SetDirty();
+	}
+}
+
+void Element::DirtyClippingRegion()
+{
+	if (clip_dirty)
+		return;
+
+	clip_dirty = true;
+	DirtyHitTestGrid();
+
+	for (size_t i = 0; i < children.size(); i++)
+		children[i]->DirtyClippingRegion();
+}
+
+void Element::DirtyHitTestGrid(bool stacking_order)
+{
+	Context* context = GetContext();
+	if (!context || !context->hit_test_grid)
+		return;
+
+	if (stacking_order)
+		context->hit_test_grid->DirtyStructure();
+	else
+		context->hit_test_grid->DirtyElement(this);
+}
+
 void Element::UpdateOffset()
 {
 	using namespace Style;
@@ -2345,6 +2603,9 @@ void Element::DirtyStackingContext()
 
 	if (stacking_context_parent)
 		stacking_context_parent->stacking_context_dirty = true;
+
+	DirtyRenderCache();
+	DirtyHitTestGrid(true);
 }
 
 void Element::DirtyStructure()
@@ -2667,10 +2928,13 @@ void Element::AdvanceAnimations()
 
 
 
-void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
+void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty, bool local_transform_dirty)
 {
 	dirty_perspective |= perspective_dirty;
-	dirty_transform |= transform_dirty;
+	dirty_transform |= (transform_dirty || local_transform_dirty);
+	dirty_local_transform |= local_transform_dirty;
+
+	DirtyHitTestGrid();
 }
 
 
@@ -2679,6 +2943,8 @@ void Element::UpdateTransformState()
 	if (!dirty_perspective && !dirty_transform)
 		return;
 
+	DirtyHitTestGrid();
+
 	const ComputedValues& computed = meta->computed_values;
 
 	const Vector2f pos = GetAbsoluteOffset(Box::BORDER);
@@ -2742,41 +3008,61 @@ void Element::UpdateTransformState()
 		// so that we only need to consider our local transform and combine it with our parent's transform and perspective matrices.
 		bool had_transform = (transform_state && transform_state->GetTransform());
 
-		bool have_transform = false;
-		Matrix4f transform = Matrix4f::Identity();
-
-		if (computed.transform)
+		// The local transform primitives are resolved again only when they or the quantities they are relative to change. Otherwise, such as
+		// when only our offset or an ancestor's transform has changed, the cached result is used.
+		if (dirty_local_transform)
 		{
-			// First find the current element's transform
-			const int n = computed.transform->GetNumPrimitives();
-			for (int i = 0; i < n; ++i)
+			bool have_local_transform = false;
+			Matrix4f local_transform = Matrix4f::Identity();
+
+			if (computed.transform)
 			{
-				const TransformPrimitive& primitive = computed.transform->GetPrimitive(i);
-				Matrix4f matrix = TransformUtilities::ResolveTransform(primitive, *this);
-				transform *= matrix;
-				have_transform = true;
+				const int n = computed.transform->GetNumPrimitives();
+				for (int i = 0; i < n; ++i)
+				{
+					const TransformPrimitive& primitive = computed.transform->GetPrimitive(i);
+					local_transform *= TransformUtilities::ResolveTransform(primitive, *this);
+					have_local_transform = true;
+				}
 			}
 
-			if(have_transform)
+			if (have_local_transform)
 			{
-				// Compute the transform origin
-				Vector3f transform_origin(pos.x + size.x * 0.5f, pos.y + size.y * 0.5f, 0);
+				if (!transform_state)
+					transform_state = MakeUnique<TransformState>();
 
-				if (computed.transform_origin_x.type == Style::TransformOrigin::Percentage)
-					transform_origin.x = pos.x + computed.transform_origin_x.value * size.x * 0.01f;
-				else
-					transform_origin.x = pos.x + computed.transform_origin_x.value;
+				transform_state->SetLocalTransform(&local_transform);
+			}
+			else if (transform_state)
+				transform_state->SetLocalTransform(nullptr);
 
-				if (computed.transform_origin_y.type == Style::TransformOrigin::Percentage)
-					transform_origin.y = pos.y + computed.transform_origin_y.value * size.y * 0.01f;
-				else
-					transform_origin.y = pos.y + computed.transform_origin_y.value;
+			dirty_local_transform = false;
+		}
+
+		bool have_transform = false;
+		Matrix4f transform = Matrix4f::Identity();
 
-				transform_origin.z = computed.transform_origin_z;
+		if (const Matrix4f* local_transform = (transform_state ? transform_state->GetLocalTransform() : nullptr))
+		{
+			have_transform = true;
 
-				// Make the transformation apply relative to the transform origin
-				transform = Matrix4f::Translate(transform_origin) * transform * Matrix4f::Translate(-transform_origin);
-			}
+			// Compute the transform origin
+			Vector3f transform_origin(pos.x + size.x * 0.5f, pos.y + size.y * 0.5f, 0);
+
+			if (computed.transform_origin_x.type == Style::TransformOrigin::Percentage)
+				transform_origin.x = pos.x + computed.transform_origin_x.value * size.x * 0.01f;
+			else
+				transform_origin.x = pos.x + computed.transform_origin_x.value;
+
+			if (computed.transform_origin_y.type == Style::TransformOrigin::Percentage)
+				transform_origin.y = pos.y + computed.transform_origin_y.value * size.y * 0.01f;
+			else
+				transform_origin.y = pos.y + computed.transform_origin_y.value;
+
+			transform_origin.z = computed.transform_origin_z;
+
+			// Make the transformation apply relative to the transform origin
+			transform = Matrix4f::Translate(transform_origin) * *local_transform * Matrix4f::Translate(-transform_origin);
 
 			// We may want to include the local offsets here, as suggested by the CSS specs, so that the local transform is applied after the offset I believe
 			// the motivation is. Then we would need to subtract the absolute zero-offsets during geometry submit whenever we have transforms.
@@ -2812,6 +3098,8 @@ void Element::UpdateTransformState()
 			transform_state->SetTransform(nullptr);
 
 		perspective_or_transform_changed |= (had_transform != have_transform);
+
+		dirty_transform = false;
 	}
 
 	// A change in perspective or transform will require an update to children transforms as well.
@@ -2853,4 +3141,17 @@ void Element::OnDpRatioChangeRecursive()
 		GetChild(i)->OnDpRatioChangeRecursive();
 }
 
+void Element::OnTexturesLoadedRecursive()
+{
+	// Decorators are regenerated to pick up the dimensions of their textures.
+	GetElementDecoration()->DirtyDecorators();
+	DirtyRenderCache();
+
+	OnTexturesLoaded();
+
+	const int num_children = GetNumChildren(true);
+	for (int i = 0; i < num_children; ++i)
+		GetChild(i)->OnTexturesLoadedRecursive();
+}
+
 } // namespace Rml
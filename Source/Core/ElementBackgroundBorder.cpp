@@ -30,10 +30,47 @@
 #include "../../Include/RmlUi/Core/Box.h"
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Element.h"
-#include "../../Include/RmlUi/Core/GeometryUtilities.h"
 
 namespace Rml {
 
+// Scratch buffers for generating geometry, swapped with the buffers of each element so that their memory is reused.
+static Vector<Vertex> scratch_vertices;
+static Vector<int> scratch_indices;
+static Vector<GeometryBackgroundBorder::ColorSegment> scratch_color_segments;
+
+static void GetColors(const ComputedValues& computed, Colourb& background_color, Colourb* border_colors)
+{
+	background_color = computed.background_color;
+	border_colors[0] = computed.border_top_color;
+	border_colors[1] = computed.border_right_color;
+	border_colors[2] = computed.border_bottom_color;
+	border_colors[3] = computed.border_left_color;
+
+	// Apply opacity
+	const float opacity = computed.opacity;
+	background_color.alpha = (byte)(opacity * (float)background_color.alpha);
+
+	if (opacity < 1)
+	{
+		for (int i = 0; i < 4; ++i)
+			border_colors[i].alpha = (byte)(opacity * (float)border_colors[i].alpha);
+	}
+}
+
+static int GetColorLayout(Colourb background_color, const Colourb* border_colors)
+{
+	int layout = (background_color.alpha > 0 ? 1 : 0);
+
+	for (int i = 0; i < 4; i++)
+	{
+		if (border_colors[i].alpha > 0)
+			layout |= (1 << (1 + i));
+		if (border_colors[i] == border_colors[(i + 3) % 4])
+			layout |= (1 << (5 + i));
+	}
+
+	return layout;
+}
 
 ElementBackgroundBorder::ElementBackgroundBorder(Element* element) : geometry(element)
 {}
@@ -41,12 +78,16 @@ ElementBackgroundBorder::ElementBackgroundBorder(Element* element) : geometry(el
 void ElementBackgroundBorder::Render(Element * element)
 {
 	if (background_dirty || border_dirty)
-	{
-		GenerateGeometry(element);
+		GenerateGeometry(element, false);
+	else if (size_dirty)
+		GenerateGeometry(element, true);
+	else if (colors_dirty && !UpdateColors(element))
+		GenerateGeometry(element, false);
 
-		background_dirty = false;
-		border_dirty = false;
-	}
+	background_dirty = false;
+	border_dirty = false;
+	colors_dirty = false;
+	size_dirty = false;
 
 	if (geometry)
 		geometry.Render(element->GetAbsoluteOffset(Box::BORDER));
@@ -62,46 +103,80 @@ void ElementBackgroundBorder::DirtyBorder()
 	border_dirty = true;
 }
 
-void ElementBackgroundBorder::GenerateGeometry(Element* element)
+void ElementBackgroundBorder::DirtyColors()
 {
-	const ComputedValues& computed = element->GetComputedValues();
+	colors_dirty = true;
+}
 
-	Colourb background_color = computed.background_color;
-	Colourb border_colors[4] = {
-		computed.border_top_color,
-		computed.border_right_color,
-		computed.border_bottom_color,
-		computed.border_left_color,
-	};
-	
-	// Apply opacity
-	const float opacity = computed.opacity;
-	background_color.alpha = (byte)(opacity * (float)background_color.alpha);
+void ElementBackgroundBorder::DirtySize()
+{
+	size_dirty = true;
+}
 
-	if (opacity < 1)
-	{
-		for (int i = 0; i < 4; ++i)
-			border_colors[i].alpha = (byte)(opacity * (float)border_colors[i].alpha);
-	}
+void ElementBackgroundBorder::GenerateGeometry(Element* element, bool allow_update)
+{
+	const ComputedValues& computed = element->GetComputedValues();
 
-	geometry.GetVertices().clear();
-	geometry.GetIndices().clear();
+	Colourb background_color;
+	Colourb border_colors[4];
+	GetColors(computed, background_color, border_colors);
 
-	const Vector4f radii(
+	const CornerSizes radii = {
 		computed.border_top_left_radius,
 		computed.border_top_right_radius,
 		computed.border_bottom_right_radius,
 		computed.border_bottom_left_radius
-	);
+	};
+
+	scratch_vertices.clear();
+	scratch_indices.clear();
+	scratch_color_segments.clear();
 
 	for (int i = 0; i < element->GetNumBoxes(); i++)
 	{
 		Vector2f offset;
 		const Box& box = element->GetBox(i, offset);
-		GeometryUtilities::GenerateBackgroundBorder(&geometry, box, offset, radii, background_color, border_colors);
+		GeometryBackgroundBorder::Draw(scratch_vertices, scratch_indices, radii, box, offset, background_color, border_colors, &scratch_color_segments);
+	}
+
+	// When only the size of the boxes has changed, the indices typically stay the same. Then we only need to update the vertex
+	// positions of the existing geometry.
+	const bool update_vertices = (allow_update && scratch_indices == indices);
+
+	vertices.swap(scratch_vertices);
+	indices.swap(scratch_indices);
+	color_segments.swap(scratch_color_segments);
+	color_layout = GetColorLayout(background_color, border_colors);
+
+	if (update_vertices)
+	{
+		if (!vertices.empty())
+			geometry.UpdateVertices(vertices);
+	}
+	else
+	{
+		geometry.Release(true);
+		geometry.GetVertices() = vertices;
+		geometry.GetIndices() = indices;
+	}
+}
+
+bool ElementBackgroundBorder::UpdateColors(Element* element)
+{
+	Colourb background_color;
+	Colourb border_colors[4];
+	GetColors(element->GetComputedValues(), background_color, border_colors);
+
+	if (GetColorLayout(background_color, border_colors) != color_layout)
+		return false;
+
+	if (!vertices.empty())
+	{
+		GeometryBackgroundBorder::UpdateColors(vertices, color_segments, background_color, border_colors);
+		geometry.UpdateVertices(vertices);
 	}
 
-	geometry.Release();
+	return true;
 }
 
 } // namespace Rml
@@ -31,6 +31,7 @@
 
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
+#include "GeometryBackgroundBorder.h"
 
 namespace Rml {
 
@@ -42,12 +43,29 @@ public:
 
 	void DirtyBackground();
 	void DirtyBorder();
+	// Only the background or border colors have changed, they may be applied to the existing geometry.
+	void DirtyColors();
+	// Only the size or position of the element's boxes have changed, the existing geometry may be updated in place.
+	void DirtySize();
 
 private:
-	void GenerateGeometry(Element* element);
+	// Generates the geometry, or updates the vertices of the existing geometry in place if its layout is unchanged and 'allow_update' is set.
+	void GenerateGeometry(Element* element, bool allow_update);
+	// Updates the colors of the existing geometry, returns false if the geometry needs to be regenerated instead.
+	bool UpdateColors(Element* element);
 
 	bool background_dirty = false;
 	bool border_dirty = false;
+	bool colors_dirty = false;
+	bool size_dirty = false;
+
+	// Describes which colors are visible and which adjacent borders have equal colors, as these affect the geometry layout.
+	int color_layout = 0;
+
+	// Our own copy of the generated geometry, used for updating it in place.
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+	Vector<GeometryBackgroundBorder::ColorSegment> color_segments;
 
 	Geometry geometry;
 };
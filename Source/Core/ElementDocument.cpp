@@ -34,10 +34,13 @@
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include "CompiledDocument.h"
 #include "DocumentHeader.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "LayoutEngine.h"
+#include "ProfileRecorder.h"
 #include "StreamFile.h"
 #include "StyleSheetFactory.h"
 #include "Template.h"
@@ -65,16 +68,10 @@ ElementDocument::~ElementDocument()
 {
 }
 
-void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
+// Merges the headers of the templates used by the document, followed by the document header itself.
+static void MergeDocumentHeader(DocumentHeader& header, const DocumentHeader& document_header)
 {
-	RMLUI_ZoneScoped;
-
-	// Store the source address that we came from
-	source_url = document_header->source;
-
-	// Construct a new header and copy the template details across
-	DocumentHeader header;
-	header.MergePaths(header.template_resources, document_header->template_resources, document_header->source);
+	header.MergePaths(header.template_resources, document_header.template_resources, document_header.source);
 
 	// Merge in any templates, note a merge may cause more templates to merge
 	for (size_t i = 0; i < header.template_resources.size(); i++)
@@ -88,13 +85,12 @@ void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
 	}
 
 	// Merge the document's header last, as it is the most overriding.
-	header.MergeHeader(*document_header);
-
-	// Set the title to the document title.
-	title = document_header->title;
+	header.MergeHeader(document_header);
+}
 
-	// If a style-sheet (or sheets) has been specified for this element, then we load them and set the combined sheet
-	// on the element; all of its children will inherit it by default.
+// Loads the inline and external style sheets of the header, and combines them in order.
+static SharedPtr<StyleSheetContainer> LoadStyleSheetContainer(const DocumentHeader& header)
+{
 	SharedPtr<StyleSheetContainer> new_style_sheet;
 
 	// Combine any inline sheets.
@@ -131,8 +127,42 @@ void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
 		}
 	}
 
-	// If a style sheet is available, set it on the document.
-	if (new_style_sheet)
+	return new_style_sheet;
+}
+
+// Dirties the definitions of the elements matched by any of the changed nodes, along with all of their descendants.
+static void DirtyChangedDefinitions(Element* element, const StyleSheet::NodeIndex& changed_node_index)
+{
+	if (StyleSheet::IsAnyNodeApplicable(changed_node_index, element))
+	{
+		// Updating the definition of an element also updates the definitions of its descendants.
+		element->GetStyle()->DirtyDefinition();
+		return;
+	}
+
+	const int num_children = element->GetNumChildren(true);
+	for (int i = 0; i < num_children; i++)
+		DirtyChangedDefinitions(element->GetChild(i), changed_node_index);
+}
+
+void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
+{
+	RMLUI_ZoneScoped;
+	RMLUI_RecordZone("ProcessHeader");
+
+	// Store the source address that we came from
+	source_url = document_header->source;
+
+	// Construct a new header and copy the template details across
+	DocumentHeader header;
+	MergeDocumentHeader(header, *document_header);
+
+	// Set the title to the document title.
+	title = document_header->title;
+
+	// If a style-sheet (or sheets) has been specified for this element, then we load them and set the combined sheet
+	// on the element; all of its children will inherit it by default.
+	if (SharedPtr<StyleSheetContainer> new_style_sheet = LoadStyleSheetContainer(header))
 		SetStyleSheetContainer(std::move(new_style_sheet));
 
 	// Load scripts.
@@ -202,9 +232,37 @@ void ElementDocument::SetStyleSheetContainer(SharedPtr<StyleSheetContainer> _sty
 	if (style_sheet_container == _style_sheet_container)
 		return;
 
+	// Keep the previous style sheet alive until it has been compared against the new one.
+	SharedPtr<StyleSheetContainer> previous_style_sheet_container = std::move(style_sheet_container);
 	style_sheet_container = std::move(_style_sheet_container);
 
-	DirtyMediaQueries();
+	const StyleSheet* previous_style_sheet = (previous_style_sheet_container ? previous_style_sheet_container->GetCompiledStyleSheet() : nullptr);
+
+	if (context && style_sheet_container && previous_style_sheet)
+	{
+		style_sheet_container->UpdateCompiledStyleSheet(context);
+		const StyleSheet* new_style_sheet = style_sheet_container->GetCompiledStyleSheet();
+
+		if (new_style_sheet != previous_style_sheet)
+		{
+			// Only restyle the elements affected by the changed rules, unless the changes may affect every element.
+			StyleSheet::NodeIndex changed_node_index;
+			if (new_style_sheet->GetChangedNodes(*previous_style_sheet, changed_node_index))
+			{
+				if (!changed_node_index.empty())
+					DirtyChangedDefinitions(this, changed_node_index);
+			}
+			else
+			{
+				GetStyle()->DirtyDefinition();
+				OnStyleSheetChangeRecursive();
+			}
+		}
+	}
+	else
+	{
+		DirtyMediaQueries();
+	}
 }
 
 // Reload the document's style sheet from source files.
@@ -220,15 +278,27 @@ void ElementDocument::ReloadStyleSheet()
 		return;
 	}
 
-	Factory::ClearStyleSheetCache();
+	// Templates may link their own style sheets, make sure they are reloaded too.
 	Factory::ClearTemplateCache();
-	ElementPtr temp_doc = Factory::InstanceDocumentStream(nullptr, stream.get(), context->GetDocumentsBaseTag());
-	if (!temp_doc) {
-		Log::Message(Log::LT_WARNING, "Failed to reload style sheet, could not instance document: %s", source_url.c_str());
-		return;
+
+	// Only the head of the document is needed, this avoids instancing any of its elements.
+	CompiledDocument compiled_document;
+	compiled_document.Compile(stream.get());
+
+	XMLParser parser(nullptr);
+	compiled_document.InstanceHead(parser);
+
+	DocumentHeader header;
+	MergeDocumentHeader(header, *parser.GetDocumentHeader());
+
+	for (const DocumentHeader::Resource& rcss : header.rcss)
+	{
+		if (!rcss.is_inline)
+			StyleSheetFactory::RemoveStyleSheetContainer(rcss.path);
 	}
 
-	SetStyleSheetContainer(static_cast<ElementDocument*>(temp_doc.get())->style_sheet_container);
+	// Elements keep their state, only those affected by changed rules are restyled.
+	SetStyleSheetContainer(LoadStyleSheetContainer(header));
 }
 
 void ElementDocument::DirtyMediaQueries()
@@ -408,6 +478,9 @@ void ElementDocument::LoadExternalScript(const String& RMLUI_UNUSED_PARAMETER(so
 // Updates the document, including its layout
 void ElementDocument::UpdateDocument()
 {
+	RMLUI_RecordZone("UpdateDocument");
+	RMLUI_RecordZoneText(source_url);
+
 	const float dp_ratio = (context ? context->GetDensityIndependentPixelRatio() : 1.0f);
 	const Vector2f vp_dimensions = (context ? Vector2f(context->GetDimensions()) : Vector2f(1.0f));
 	Update(dp_ratio, vp_dimensions);
@@ -424,6 +497,7 @@ void ElementDocument::UpdateLayout()
 	{
 		RMLUI_ZoneScoped;
 		RMLUI_ZoneText(source_url.c_str(), source_url.size());
+		RMLUI_RecordZone("Layout");
 
 		Vector2f containing_block(0, 0);
 		if (GetParentNode() != nullptr)
@@ -0,0 +1,183 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementLayer.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "TransformState.h"
+#include <float.h>
+
+namespace Rml {
+
+int ElementLayer::num_layers = 0;
+
+ElementLayer::ElementLayer(Element* element) : element(element)
+{
+	num_layers += 1;
+}
+
+ElementLayer::~ElementLayer()
+{
+	ReleaseTexture();
+	num_layers -= 1;
+}
+
+bool ElementLayer::Render()
+{
+	RenderInterface* new_render_interface = element->GetRenderInterface();
+	Context* context = element->GetContext();
+	if (!new_render_interface || !context)
+		return false;
+
+	// The layer is captured in screen space, thus transformed elements are rendered directly.
+	const TransformState* transform_state = element->GetTransformState();
+	if (transform_state && transform_state->GetTransform())
+	{
+		ReleaseTexture();
+		return false;
+	}
+
+	const Vector2f new_position = element->GetAbsoluteOffset(Box::BORDER);
+
+	Vector2i new_clip_origin, new_clip_dimensions;
+	const bool new_clip_enabled = ElementUtilities::GetClippingRegion(new_clip_origin, new_clip_dimensions, element);
+	const Vector2i new_context_dimensions = context->GetDimensions();
+
+	if (new_render_interface != render_interface || new_position != position || new_clip_enabled != clip_enabled ||
+		new_clip_origin != clip_origin || new_clip_dimensions != clip_dimensions || new_context_dimensions != context_dimensions)
+	{
+		dirty = true;
+	}
+
+	if (dirty)
+	{
+		RMLUI_ZoneScopedN("ElementLayer::Render");
+
+		ReleaseTexture();
+
+		// The layer covers the visible parts of everything drawn by the element and its local stacking context, which may
+		// extend outside the element itself. Render directly until the bounds are known, such as when text is first rendered.
+		Vector2f bounds_min(FLT_MAX), bounds_max(-FLT_MAX);
+		if (!ExpandVisibleBounds(element, bounds_min, bounds_max))
+			return false;
+
+		Vector2i new_origin, new_dimensions;
+		if (bounds_min.x < bounds_max.x && bounds_min.y < bounds_max.y)
+		{
+			new_origin = Vector2i(Math::RoundDownToInteger(bounds_min.x), Math::RoundDownToInteger(bounds_min.y));
+			new_dimensions = Vector2i(Math::RoundUpToInteger(bounds_max.x), Math::RoundUpToInteger(bounds_max.y)) - new_origin;
+		}
+
+		TextureHandle new_texture = 0;
+		if (new_dimensions.x > 0 && new_dimensions.y > 0 && !new_render_interface->BeginRenderToTexture(new_texture, new_origin, new_dimensions))
+			return false;
+
+		render_interface = new_render_interface;
+		texture = new_texture;
+		position = new_position;
+		origin = new_origin;
+		dimensions = new_dimensions;
+		clip_enabled = new_clip_enabled;
+		clip_origin = new_clip_origin;
+		clip_dimensions = new_clip_dimensions;
+		context_dimensions = new_context_dimensions;
+
+		// Clear the dirty flag first, so that any changes made while rendering are picked up in the next frame.
+		dirty = false;
+
+		// Nothing is visible, keep the empty layer until it changes.
+		if (!texture)
+			return true;
+
+		// The render target may not share the scissor state of the previous target, make sure it is applied on both.
+		ElementUtilities::ApplyActiveClipRegion(context, render_interface);
+		element->RenderContents();
+		render_interface->EndRenderToTexture();
+		ElementUtilities::ApplyActiveClipRegion(context, render_interface);
+
+		GeometryUtilities::GenerateQuad(vertices, indices, Vector2f(origin), Vector2f(dimensions), Colourb(255, 255, 255), Vector2f(0, 0),
+			Vector2f(1, 1));
+	}
+
+	if (texture)
+	{
+		// Every element was clipped when rendered into the layer, thus the layer itself is drawn without clipping.
+		ElementUtilities::ApplyTransform(*element);
+		ElementUtilities::SetClippingRegion(nullptr, context);
+		render_interface->RenderGeometry(vertices, 4, indices, 6, texture, Vector2f(0, 0));
+	}
+
+	return true;
+}
+
+bool ElementLayer::ExpandVisibleBounds(Element* element, Vector2f& bounds_min, Vector2f& bounds_max)
+{
+	Vector2f visible_min, visible_max;
+	Vector2f render_min, render_max;
+	if (!element->GetVisibleArea(visible_min, visible_max) || !element->GetRenderBounds(render_min, render_max))
+		return false;
+
+	render_min = Vector2f(Math::Max(render_min.x, visible_min.x), Math::Max(render_min.y, visible_min.y));
+	render_max = Vector2f(Math::Min(render_max.x, visible_max.x), Math::Min(render_max.y, visible_max.y));
+
+	if (render_min.x < render_max.x && render_min.y < render_max.y)
+	{
+		bounds_min = Vector2f(Math::Min(bounds_min.x, render_min.x), Math::Min(bounds_min.y, render_min.y));
+		bounds_max = Vector2f(Math::Max(bounds_max.x, render_max.x), Math::Max(bounds_max.y, render_max.y));
+	}
+
+	// Traverse the elements in the same order as they are rendered, see Element::RenderContents().
+	if (element->local_stacking_context)
+	{
+		if (element->stacking_context_dirty)
+			element->BuildLocalStackingContext();
+
+		for (Element* child : element->stacking_context)
+		{
+			if (!ExpandVisibleBounds(child, bounds_min, bounds_max))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void ElementLayer::ReleaseTexture()
+{
+	if (texture && render_interface)
+		render_interface->ReleaseTexture(texture);
+
+	texture = 0;
+	dirty = true;
+}
+
+} // namespace Rml
@@ -0,0 +1,88 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ELEMENTLAYER_H
+#define RMLUI_CORE_ELEMENTLAYER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
+
+namespace Rml {
+
+class Element;
+class RenderInterface;
+
+/**
+	Caches the rendering of an element and its local stacking context in a texture, for elements with the
+	'render-cache: layer' property. The layer is only re-rendered when dirtied or moved, otherwise it is drawn as a single
+	textured quad covering the visible area drawn by the element and its local stacking context.
+ */
+
+class ElementLayer : NonCopyMoveable {
+public:
+	ElementLayer(Element* element);
+	~ElementLayer();
+
+	/// Renders the element from the layer, first re-rendering the layer if necessary.
+	/// @return False if the layer cannot be used, in which case the element must be rendered directly.
+	bool Render();
+
+	/// Marks the layer for re-rendering.
+	void SetDirty() { dirty = true; }
+
+	/// Returns true if any layers exist, used to skip dirtying when the property is not in use.
+	static bool AnyLayers() { return num_layers > 0; }
+
+private:
+	void ReleaseTexture();
+
+	// Expands the bounds to cover the visible area drawn by the element and its local stacking context, in context coordinates.
+	// Returns false if the area cannot be determined, such as when there are transformed elements.
+	static bool ExpandVisibleBounds(Element* element, Vector2f& bounds_min, Vector2f& bounds_max);
+
+	static int num_layers;
+
+	Element* element;
+	bool dirty = true;
+
+	RenderInterface* render_interface = nullptr;
+	TextureHandle texture = 0;
+
+	// The state the layer was last rendered with, any changes to these require the layer to be re-rendered.
+	Vector2f position;
+	Vector2i origin, dimensions;
+	bool clip_enabled = false;
+	Vector2i clip_origin, clip_dimensions;
+	Vector2i context_dimensions;
+
+	Vertex vertices[4];
+	int indices[6];
+};
+
+} // namespace Rml
+#endif
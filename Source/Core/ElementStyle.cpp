@@ -487,6 +487,10 @@ void ElementStyle::DirtyPropertiesWithUnits(Property::Unit units)
 		if (property.unit & units)
 			DirtyProperty(id);
 	}
+
+	// Lengths in transforms are only resolved when the transform state is updated, dirty the transform to have them resolved again.
+	if ((units & Property::LENGTH) && GetLocalProperty(PropertyId::Transform))
+		DirtyProperty(PropertyId::Transform);
 }
 
 void ElementStyle::DirtyPropertiesWithUnitsRecursive(Property::Unit units)
@@ -867,6 +871,9 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		case PropertyId::PointerEvents:
 			values.pointer_events = (PointerEvents)p->Get<int>();
 			break;
+		case PropertyId::RenderCache:
+			values.render_cache = (RenderCache)p->Get<int>();
+			break;
 
 		case PropertyId::Perspective:
 			values.perspective = ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions);
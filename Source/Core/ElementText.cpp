@@ -38,6 +38,7 @@
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/Property.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include <float.h>
 
 namespace Rml {
 
@@ -52,6 +53,8 @@ ElementText::ElementText(const String& tag) : Element(tag), colour(255, 255, 255
 	decoration_property = Style::TextDecoration::None;
 
 	geometry_dirty = true;
+	geometry_min = Vector2f(FLT_MAX);
+	geometry_max = Vector2f(-FLT_MAX);
 
 	font_effects_handle = 0;
 	font_effects_dirty = true;
@@ -78,6 +81,16 @@ const String& ElementText::GetText() const
 	return text;
 }
 
+// Expands the bounds to include the vertices of the given geometry.
+static void ExpandBounds(Vector2f& bounds_min, Vector2f& bounds_max, Geometry& geometry)
+{
+	for (const Vertex& vertex : geometry.GetVertices())
+	{
+		bounds_min = Vector2f(Math::Min(bounds_min.x, vertex.position.x), Math::Min(bounds_min.y, vertex.position.y));
+		bounds_max = Vector2f(Math::Max(bounds_max.x, vertex.position.x), Math::Max(bounds_max.y, vertex.position.y));
+	}
+}
+
 void ElementText::OnRender()
 {
 	RMLUI_ZoneScoped;
@@ -118,7 +131,7 @@ void ElementText::OnRender()
 	bool render = true;
 	Vector2i clip_origin;
 	Vector2i clip_dimensions;
-	if (GetContext()->GetActiveClipRegion(clip_origin, clip_dimensions))
+	if (ElementUtilities::GetClippingRegion(clip_origin, clip_dimensions, this))
 	{
 		float clip_top = (float)clip_origin.y;
 		float clip_left = (float)clip_origin.x;
@@ -157,6 +170,27 @@ void ElementText::OnRender()
 		decoration.Render(translation);
 }
 
+bool ElementText::GetRenderBounds(Vector2f& bounds_min, Vector2f& bounds_max)
+{
+	// The text has no size of its own, instead we use the bounds of its geometry. These are only known once the geometry
+	// is up-to-date, which happens during rendering.
+	const FontFaceHandle font_face_handle = GetFontFaceHandle();
+	if (font_face_handle == 0 || geometry_dirty || font_effects_dirty || decoration_property != generated_decoration ||
+		GetFontEngineInterface()->GetVersion(font_face_handle) != font_handle_version)
+		return false;
+
+	const Vector2f translation = GetAbsoluteOffset();
+	bounds_min = translation + geometry_min;
+	bounds_max = translation + geometry_max;
+
+	return true;
+}
+
+bool ElementText::IsCullable() const
+{
+	return true;
+}
+
 // Generates a token of text from this element, returning only the width.
 bool ElementText::GenerateToken(float& token_width, int line_begin)
 {
@@ -317,6 +351,7 @@ void ElementText::ClearLines()
 	lines.clear();
 	generated_decoration = Style::TextDecoration::None;
 	decoration.Release(true);
+	DirtyRenderCache();
 }
 
 // Adds a new line into the text element.
@@ -470,6 +505,11 @@ void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle)
 	decoration.Release(true);
 	generated_decoration = Style::TextDecoration::None;
 
+	geometry_min = Vector2f(FLT_MAX);
+	geometry_max = Vector2f(-FLT_MAX);
+	for (Geometry& layer_geometry : geometry)
+		ExpandBounds(geometry_min, geometry_max, layer_geometry);
+
 	geometry_dirty = false;
 }
 
@@ -487,6 +527,8 @@ void ElementText::GenerateDecoration(const FontFaceHandle font_face_handle)
 	
 	for(const Line& line : lines)
 		GeometryUtilities::GenerateLine(font_face_handle, &decoration, line.position, line.width, decoration_property, colour);
+
+	ExpandBounds(geometry_min, geometry_max, decoration);
 }
 
 static bool BuildToken(String& token, const char*& token_begin, const char* string_end, bool first_token, bool collapse_white_space, bool break_at_endline, Style::TextTransform text_transformation, bool decode_escape_characters)
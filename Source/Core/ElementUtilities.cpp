@@ -40,6 +40,7 @@
 #include "ElementStyle.h"
 #include "LayoutDetails.h"
 #include "LayoutEngine.h"
+#include "ProfileRecorder.h"
 #include "TransformState.h"
 #include <limits>
 
@@ -163,18 +164,62 @@ int ElementUtilities::GetStringWidth(Element* element, const String& string, Cha
 	return GetFontEngineInterface()->GetStringWidth(font_face_handle, string, prior_character);
 }
 
+// Finds the clipping rectangle of an element's own client area, if it clips its overflowing content.
+static bool GetElementClipRectangle(Vector2i& rect_origin, Vector2i& rect_dimensions, Element* clipping_element, bool clip_always)
+{
+	// Ignore nodes that don't clip.
+	if (clip_always || clipping_element->GetClientWidth() < clipping_element->GetScrollWidth() - 0.5f ||
+		clipping_element->GetClientHeight() < clipping_element->GetScrollHeight() - 0.5f)
+	{
+		const Box::Area client_area = clipping_element->GetClientArea();
+		Vector2f element_origin_f = clipping_element->GetAbsoluteOffset(client_area);
+		Vector2f element_dimensions_f = clipping_element->GetBox().GetSize(client_area);
+		Math::SnapToPixelGrid(element_origin_f, element_dimensions_f);
+
+		rect_origin = Vector2i(element_origin_f);
+		rect_dimensions = Vector2i(element_dimensions_f);
+		return true;
+	}
+
+	return false;
+}
+
+// Combines the clipping rectangle with the existing clipping region, which is empty when set to (-1, -1).
+static void MergeClipRectangle(Vector2i& clip_origin, Vector2i& clip_dimensions, Vector2i rect_origin, Vector2i rect_dimensions)
+{
+	if (clip_origin == Vector2i(-1, -1) && clip_dimensions == Vector2i(-1, -1))
+	{
+		clip_origin = rect_origin;
+		clip_dimensions = rect_dimensions;
+	}
+	else
+	{
+		const Vector2i top_left(Math::Max(clip_origin.x, rect_origin.x),
+		                        Math::Max(clip_origin.y, rect_origin.y));
+		
+		const Vector2i bottom_right(Math::Min(clip_origin.x + clip_dimensions.x, rect_origin.x + rect_dimensions.x),
+		                            Math::Min(clip_origin.y + clip_dimensions.y, rect_origin.y + rect_dimensions.y));
+		
+		clip_origin = top_left;
+		clip_dimensions.x = Math::Max(0, bottom_right.x - top_left.x);
+		clip_dimensions.y = Math::Max(0, bottom_right.y - top_left.y);
+	}
+}
+
 // Generates the clipping region for an element.
 bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* element)
 {
-	using Style::Clip;
-	clip_origin = Vector2i(-1, -1);
-	clip_dimensions = Vector2i(-1, -1);
+	UpdateClippingRegion(element);
 
-	Clip target_element_clip = element->GetComputedValues().clip;
-	if (target_element_clip == Clip::Type::None)
-		return false;
+	clip_origin = element->clip_origin;
+	clip_dimensions = element->clip_dimensions;
+	return element->clip_enabled;
+}
 
-	int num_ignored_clips = target_element_clip.GetNumber();
+// Searches through the element's ancestors for the clipping region, when it ignores the given number of clipping regions.
+static void GetAncestorsClippingRegion(Vector2i& clip_origin, Vector2i& clip_dimensions, Element* element, int num_ignored_clips)
+{
+	using Style::Clip;
 
 	// Search through the element's ancestors, finding all elements that clip their overflow and have overflow to clip.
 	// For each that we find, we combine their clipping region with the existing clipping region, and so build up a
@@ -192,36 +237,9 @@ bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_d
 		// Merge the existing clip region with the current clip region if we aren't ignoring clip regions.
 		if ((clip_always || clip_enabled) && num_ignored_clips == 0)
 		{
-			// Ignore nodes that don't clip.
-			if (clip_always || clipping_element->GetClientWidth() < clipping_element->GetScrollWidth() - 0.5f ||
-				clipping_element->GetClientHeight() < clipping_element->GetScrollHeight() - 0.5f)
-			{
-				const Box::Area client_area = clipping_element->GetClientArea();
-				Vector2f element_origin_f = clipping_element->GetAbsoluteOffset(client_area);
-				Vector2f element_dimensions_f = clipping_element->GetBox().GetSize(client_area);
-				Math::SnapToPixelGrid(element_origin_f, element_dimensions_f);
-
-				const Vector2i element_origin(element_origin_f);
-				const Vector2i element_dimensions(element_dimensions_f);
-				
-				if (clip_origin == Vector2i(-1, -1) && clip_dimensions == Vector2i(-1, -1))
-				{
-					clip_origin = element_origin;
-					clip_dimensions = element_dimensions;
-				}
-				else
-				{
-					const Vector2i top_left(Math::Max(clip_origin.x, element_origin.x),
-					                        Math::Max(clip_origin.y, element_origin.y));
-					
-					const Vector2i bottom_right(Math::Min(clip_origin.x + clip_dimensions.x, element_origin.x + element_dimensions.x),
-					                            Math::Min(clip_origin.y + clip_dimensions.y, element_origin.y + element_dimensions.y));
-					
-					clip_origin = top_left;
-					clip_dimensions.x = Math::Max(0, bottom_right.x - top_left.x);
-					clip_dimensions.y = Math::Max(0, bottom_right.y - top_left.y);
-				}
-			}
+			Vector2i element_origin, element_dimensions;
+			if (GetElementClipRectangle(element_origin, element_dimensions, clipping_element, clip_always))
+				MergeClipRectangle(clip_origin, clip_dimensions, element_origin, element_dimensions);
 		}
 
 		// If this region is meant to clip and we're skipping regions, update the counter.
@@ -238,8 +256,64 @@ bool ElementUtilities::GetClippingRegion(Vector2i& clip_origin, Vector2i& clip_d
 		// Climb the tree to this region's parent.
 		clipping_element = clipping_element->GetParentNode();
 	}
-	
-	return clip_dimensions.x >= 0 && clip_dimensions.y >= 0;
+}
+
+void ElementUtilities::UpdateClippingRegion(Element* element)
+{
+	using Style::Clip;
+
+	if (!element->clip_dirty)
+		return;
+
+	// The cached regions are derived from the ancestors, so make sure they are up to date first. This also ensures that an
+	// element is never clean while any of its ancestors is dirty, which lets the element skip dirtying clean descendants.
+	Element* parent = element->GetParentNode();
+	if (parent)
+		UpdateClippingRegion(parent);
+
+	Vector2i clip_origin(-1, -1);
+	Vector2i clip_dimensions(-1, -1);
+
+	const ComputedValues& computed = element->GetComputedValues();
+	const int num_ignored_clips = computed.clip.GetNumber();
+
+	if (computed.clip == Clip::Type::None)
+	{
+		// The element ignores all clipping regions.
+	}
+	else if (num_ignored_clips == 0)
+	{
+		// In the common case where no clipping regions are ignored, the clipping region is given by the cached region of the parent.
+		if (parent && parent->children_clip_enabled)
+		{
+			clip_origin = parent->children_clip_origin;
+			clip_dimensions = parent->children_clip_dimensions;
+		}
+	}
+	else
+	{
+		GetAncestorsClippingRegion(clip_origin, clip_dimensions, element, num_ignored_clips);
+	}
+
+	element->clip_enabled = (clip_dimensions.x >= 0 && clip_dimensions.y >= 0);
+	element->clip_origin = clip_origin;
+	element->clip_dimensions = clip_dimensions;
+
+	// The region applied to the children is the region applied to the element itself, combined with the element's own
+	// client area if it clips.
+	const bool clip_enabled = (computed.overflow_x != Style::Overflow::Visible || computed.overflow_y != Style::Overflow::Visible);
+	const bool clip_always = (computed.clip == Clip::Type::Always);
+	if (clip_always || clip_enabled)
+	{
+		Vector2i element_origin, element_dimensions;
+		if (GetElementClipRectangle(element_origin, element_dimensions, element, clip_always))
+			MergeClipRectangle(clip_origin, clip_dimensions, element_origin, element_dimensions);
+	}
+
+	element->children_clip_enabled = (clip_dimensions.x >= 0 && clip_dimensions.y >= 0);
+	element->children_clip_origin = clip_origin;
+	element->children_clip_dimensions = clip_dimensions;
+	element->clip_dirty = false;
 }
 
 // Sets the clipping region from an element and its ancestors.
@@ -455,6 +529,11 @@ static bool ApplyDataViewsControllersInternal(Element* element, const bool const
 			}
 		}
 
+		if (initializer_list.empty())
+			return false;
+
+		RMLUI_RecordZone("CreateDataViews");
+
 		// Now, we can safely initialize the data views and controllers, even modifying the element's attributes when desired.
 		for (ViewControllerInitializer& initializer : initializer_list)
 		{
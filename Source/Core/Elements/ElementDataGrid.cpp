@@ -250,6 +250,11 @@ void ElementDataGrid::OnResize()
 }
 
 // Gets the markup and content of the element.
+bool ElementDataGrid::IsRMLDefinedByChildren() const
+{
+	return false;
+}
+
 void ElementDataGrid::GetInnerRML(String& content) const
 {
 	// The only content we have is the columns, and inside them the header elements.
@@ -189,6 +189,11 @@ void ElementFormControlTextArea::OnPropertyChange(const PropertyIdSet& changed_p
 }
 
 // Returns the text content of the element.
+bool ElementFormControlTextArea::IsRMLDefinedByChildren() const
+{
+	return false;
+}
+
 void ElementFormControlTextArea::GetInnerRML(String& content) const
 {
 	content = GetValue();
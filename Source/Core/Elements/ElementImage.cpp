@@ -43,6 +43,7 @@ ElementImage::ElementImage(const String& tag) : Element(tag), dimensions(-1, -1)
 	dimensions_scale = 1.0f;
 	geometry_dirty = false;
 	texture_dirty = true;
+	texture_loading = false;
 }
 
 ElementImage::~ElementImage()
@@ -74,6 +75,8 @@ bool ElementImage::GetIntrinsicDimensions(Vector2f& _dimensions, float& _ratio)
 
 	dimensions *= dimensions_scale;
 
+	texture_loading = texture.IsLoading(GetRenderInterface());
+
 	// Return the calculated dimensions. If this changes the size of the element, it will result in
 	// a call to 'onresize' below which will regenerate the geometry.
 	_dimensions = dimensions;
@@ -93,6 +96,11 @@ void ElementImage::OnRender()
 	geometry.Render(GetAbsoluteOffset(Box::CONTENT).Round());
 }
 
+bool ElementImage::IsCullable() const
+{
+	return true;
+}
+
 // Called when attributes on the element are changed.
 void ElementImage::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
@@ -129,7 +137,10 @@ void ElementImage::OnAttributeChange(const ElementAttributes& changed_attributes
 	}
 
 	if (dirty_layout)
+	{
 		DirtyLayout();
+		DirtyRenderCache();
+	}
 }
 
 void ElementImage::OnPropertyChange(const PropertyIdSet& changed_properties)
@@ -172,6 +183,21 @@ void ElementImage::OnStyleSheetChange()
 	}
 }
 
+void ElementImage::OnTexturesLoaded()
+{
+	if (texture_loading && !texture.IsLoading(GetRenderInterface()))
+	{
+		texture_loading = false;
+		DirtyLayout();
+	}
+
+	if (texture)
+	{
+		geometry_dirty = true;
+		DirtyRenderCache();
+	}
+}
+
 void ElementImage::GenerateGeometry()
 {
 	// Release the old geometry before specifying the new vertices.
@@ -205,6 +231,12 @@ void ElementImage::GenerateGeometry()
 		texcoords[1] = Vector2f(1, 1);
 	}
 
+	// Map the coordinates into the texture's region of its atlas page, if any.
+	Vector2f texture_region[2];
+	texture.GetTexCoords(GetRenderInterface(), texture_region[0], texture_region[1]);
+	for (Vector2f& texcoord : texcoords)
+		texcoord = texture_region[0] + texcoord * (texture_region[1] - texture_region[0]);
+
 	const ComputedValues& computed = GetComputedValues();
 
 	float opacity = computed.opacity;
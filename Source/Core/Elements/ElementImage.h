@@ -78,6 +78,8 @@ public:
 protected:
 	/// Renders the image.
 	void OnRender() override;
+	/// Returns true, as the image is rendered inside the element's box.
+	bool IsCullable() const override;
 
 	/// Regenerates the element's geometry.
 	void OnResize() override;
@@ -88,6 +90,9 @@ protected:
 	/// The sprite may have changed when the style sheet is recompiled.
 	void OnStyleSheetChange() override;
 
+	/// Regenerates the geometry, and the layout if the image was sized while its texture was loading.
+	void OnTexturesLoaded() override;
+
 	/// Checks for changes to the image's source or dimensions.
 	/// @param[in] changed_attributes A list of attributes changed on the element.
 	void OnAttributeChange(const ElementAttributes& changed_attributes) override;
@@ -111,6 +116,8 @@ private:
 	Texture texture;
 	// True if we need to refetch the texture's source from the element's attributes.
 	bool texture_dirty;
+	// True if the intrinsic dimensions were computed while the texture was still loading.
+	bool texture_loading;
 	// A factor which scales the intrinsic dimensions based on the dp-ratio and image scale.
 	float dimensions_scale;
 	// The element's computed intrinsic dimensions. If either of these values are set to -1, then
@@ -103,6 +103,7 @@ void ElementProgress::OnAttributeChange(const ElementAttributes& changed_attribu
 		|| changed_attributes.find("max") != changed_attributes.end())
 	{
 		geometry_dirty = true;
+		DirtyRenderCache();
 	}
 
 	if (changed_attributes.find("direction") != changed_attributes.end())
@@ -120,6 +121,7 @@ void ElementProgress::OnAttributeChange(const ElementAttributes& changed_attribu
 			direction = Direction(index);
 
 		geometry_dirty = true;
+		DirtyRenderCache();
 	}
 
 	if (changed_attributes.find("start-edge") != changed_attributes.end())
@@ -137,6 +139,7 @@ void ElementProgress::OnAttributeChange(const ElementAttributes& changed_attribu
 			start_edge = StartEdge(index);
 
 		geometry_dirty = true;
+		DirtyRenderCache();
 	}
 }
 
@@ -154,6 +157,15 @@ void ElementProgress::OnPropertyChange(const PropertyIdSet& changed_properties)
 	}
 }
 
+void ElementProgress::OnTexturesLoaded()
+{
+	if (texture)
+	{
+		geometry_dirty = true;
+		DirtyRenderCache();
+	}
+}
+
 void ElementProgress::OnResize()
 {
 	const Vector2f element_size = GetBox().GetSize();
@@ -256,6 +268,12 @@ void ElementProgress::GenerateGeometry()
 		texcoords[1] = Vector2f(1, 1);
 	}
 
+	// Map the coordinates into the texture's region of its atlas page, if any.
+	Vector2f texture_region[2];
+	texture.GetTexCoords(GetRenderInterface(), texture_region[0], texture_region[1]);
+	for (Vector2f& texcoord : texcoords)
+		texcoord = texture_region[0] + texcoord * (texture_region[1] - texture_region[0]);
+
 	Colourb quad_colour;
 	{
 		const ComputedValues& computed = GetComputedValues();
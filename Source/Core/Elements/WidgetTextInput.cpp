@@ -228,6 +228,7 @@ void WidgetTextInput::OnUpdate()
 		{
 			cursor_timer += CURSOR_BLINK_TIME;
 			cursor_visible = !cursor_visible;
+			parent->DirtyRenderCache();
 		}
 	}
 }
@@ -880,6 +881,8 @@ int WidgetTextInput::CalculateCharacterIndex(int line_index, float position)
 // Shows or hides the cursor.
 void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 {
+	parent->DirtyRenderCache();
+
 	if (show)
 	{
 		cursor_visible = true;
@@ -1153,6 +1156,8 @@ void WidgetTextInput::GenerateCursor()
 	}
 
 	GeometryUtilities::GenerateQuad(&vertices[0], &indices[0], Vector2f(0, 0), cursor_size, color);
+
+	parent->DirtyRenderCache();
 }
 
 void WidgetTextInput::UpdateCursorPosition()
@@ -1162,6 +1167,8 @@ void WidgetTextInput::UpdateCursorPosition()
 
 	cursor_position.x = (float) ElementUtilities::GetStringWidth(text_element, lines[cursor_line_index].content.substr(0, cursor_character_index));
 	cursor_position.y = -1.f + (float)cursor_line_index * text_element->GetLineHeight();
+
+	parent->DirtyRenderCache();
 }
 
 // Expand the text selection to the position of the cursor.
@@ -131,6 +131,8 @@ void Event::StopImmediatePropagation()
 
 const Dictionary& Event::GetParameters() const
 {
+	if (input_parameters_pending)
+		GenerateInputParameters();
 	return parameters;
 }
 
@@ -152,10 +154,65 @@ EventId Event::GetId() const
 	return id;
 }
 
+void Event::SetInputParameters(const EventInputParameters& in_input_parameters)
+{
+	input_parameters = in_input_parameters;
+	input_parameters_pending = (input_parameters.flags != 0);
+
+	if (input_parameters.flags & EventInputParameters::MousePosition)
+	{
+		has_mouse_position = true;
+		mouse_screen_position = Vector2f(input_parameters.mouse_position);
+	}
+}
+
+void Event::GenerateInputParameters() const
+{
+	input_parameters_pending = false;
+	GenerateInputParameters(input_parameters, parameters);
+}
+
+void Event::GenerateInputParameters(const EventInputParameters& input_parameters, Dictionary& parameters)
+{
+	static const String key_modifier_names[] = {
+		"ctrl_key",
+		"shift_key",
+		"alt_key",
+		"meta_key",
+		"caps_lock_key",
+		"num_lock_key",
+		"scroll_lock_key"
+	};
+
+	const int flags = input_parameters.flags;
+
+	if (flags & EventInputParameters::MousePosition)
+	{
+		parameters["mouse_x"] = input_parameters.mouse_position.x;
+		parameters["mouse_y"] = input_parameters.mouse_position.y;
+	}
+	if (flags & EventInputParameters::Button)
+		parameters["button"] = input_parameters.button;
+	if (flags & EventInputParameters::KeyIdentifier)
+		parameters["key_identifier"] = input_parameters.key_identifier;
+	if (flags & EventInputParameters::KeyModifiers)
+	{
+		for (int i = 0; i < 7; i++)
+			parameters[key_modifier_names[i]] = (int)((input_parameters.key_modifier_state & (1 << i)) > 0);
+	}
+	if (flags & EventInputParameters::DragElement)
+		parameters["drag_element"] = (void*)input_parameters.drag_element;
+	if (flags & EventInputParameters::WheelDelta)
+		parameters["wheel_delta"] = input_parameters.wheel_delta;
+}
+
 void Event::ProjectMouse(Element* element)
 {
 	if(!element)
 	{
+		if (input_parameters_pending)
+			GenerateInputParameters();
+
 		parameters["mouse_x"] = mouse_screen_position.x;
 		parameters["mouse_y"] = mouse_screen_position.y;
 		return;
@@ -164,6 +221,9 @@ void Event::ProjectMouse(Element* element)
 	// Only need to project mouse position if element has a transform state
 	if (element->GetTransformState())
 	{
+		if (input_parameters_pending)
+			GenerateInputParameters();
+
 		// Project mouse from parent (previous 'mouse_x/y' property) to child (element)
 		Variant *mouse_x = GetIf(parameters, "mouse_x");
 		Variant *mouse_y = GetIf(parameters, "mouse_y");
@@ -71,6 +71,8 @@ void EventDispatcher::AttachEvent(const EventId id, EventListener* listener, con
 	if (matching_entry_it == range.second)
 	{
 		listeners.emplace(range.second, entry);
+		UpdateListenerMask();
+
 		listener->OnAttach(element);
 	}
 }
@@ -82,6 +84,8 @@ void EventDispatcher::DetachEvent(const EventId id, EventListener* listener, con
 	if (listenerIt != listeners.cend())
 	{
 		listeners.erase(listenerIt);
+		UpdateListenerMask();
+
 		listener->OnDetach(element);
 	}
 }
@@ -93,11 +97,57 @@ void EventDispatcher::DetachAllEvents()
 		event.listener->OnDetach(element);
 
 	listeners.clear();
+	UpdateListenerMask();
 
 	for (int i = 0; i < element->GetNumChildren(true); ++i)
 		element->GetChild(i)->GetEventDispatcher()->DetachAllEvents();
 }
 
+void EventDispatcher::OnParentChange()
+{
+	UpdateChainListenerMask();
+}
+
+bool EventDispatcher::MayHaveListenersInChain(EventId id) const
+{
+	return (chain_listener_mask & ToMask(id)) != 0;
+}
+
+EventDispatcher::EventIdMask EventDispatcher::ToMask(EventId id)
+{
+	constexpr int num_bits = int(sizeof(EventIdMask) * 8);
+	return EventIdMask(1) << Math::Min(int(id), num_bits - 1);
+}
+
+void EventDispatcher::UpdateListenerMask()
+{
+	EventIdMask new_mask = 0;
+	for (const EventListenerEntry& entry : listeners)
+		new_mask |= ToMask(entry.id);
+
+	if (new_mask != listener_mask)
+	{
+		listener_mask = new_mask;
+		UpdateChainListenerMask();
+	}
+}
+
+void EventDispatcher::UpdateChainListenerMask()
+{
+	const Element* parent = element->GetParentNode();
+	const EventIdMask new_mask = listener_mask | (parent ? parent->GetEventDispatcher()->chain_listener_mask : 0);
+
+	// The masks of the descendants only depend on our mask and their own listeners, thus we can stop here if unchanged.
+	if (new_mask == chain_listener_mask)
+		return;
+
+	chain_listener_mask = new_mask;
+
+	const int num_children = element->GetNumChildren(true);
+	for (int i = 0; i < num_children; i++)
+		element->GetChild(i)->GetEventDispatcher()->UpdateChainListenerMask();
+}
+
 /*
 	CollectedListener
 
@@ -106,7 +156,8 @@ void EventDispatcher::DetachAllEvents()
 */
 struct CollectedListener {
 
-	CollectedListener(Element* _element, EventListener* _listener, int dom_distance_from_target, bool in_capture_phase) : element(_element->GetObserverPtr()), listener(_listener->GetObserverPtr())
+	CollectedListener(Element* _element, EventListener* _listener, int dom_distance_from_target, bool in_capture_phase, int collect_order) :
+		element(_element->GetObserverPtr()), listener(_listener->GetObserverPtr()), collect_order(collect_order)
 	{
 		sort = dom_distance_from_target * (in_capture_phase ? -1 : 1);
 	}
@@ -118,21 +169,73 @@ struct CollectedListener {
 	ObserverPtr<Element> element;
 	ObserverPtr<EventListener> listener;
 
+	// The order in which the listener was collected, used to maintain the order of listeners with equal sort values.
+	int collect_order = 0;
+
 	// Default actions are returned by EventPhase::None.
 	EventPhase GetPhase() const { return sort < 0 ? EventPhase::Capture : (sort == 0 ? EventPhase::Target : EventPhase::Bubble); }
 
 	bool operator<(const CollectedListener& other) const {
-		return sort < other.sort;
+		return std::tie(sort, collect_order) < std::tie(other.sort, other.collect_order);
 	}
 };
 
 
-bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const Dictionary& parameters, const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
-{
-	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture), "We assume here that the default action phases cannot include capture phase.");
+/*
+	DispatchScratch
 
+	The buffers used for collecting listeners and default action elements during dispatch. They are reused between events
+	to avoid allocations. Events may be dispatched recursively from within listeners, thus one scratch entry is kept for
+	each level of nesting. Like the event pool, they are not thread-safe: events are only dispatched from the thread
+	updating the contexts, worker threads merely load textures and tokenize documents.
+*/
+struct DispatchScratch {
 	Vector<CollectedListener> listeners;
 	Vector<ObserverPtr<Element>> default_action_elements;
+};
+
+static Vector<UniquePtr<DispatchScratch>> dispatch_scratch_stack;
+static int dispatch_scratch_depth = 0;
+
+class DispatchScratchScope : NonCopyMoveable {
+public:
+	DispatchScratchScope()
+	{
+		if (dispatch_scratch_depth >= (int)dispatch_scratch_stack.size())
+			dispatch_scratch_stack.push_back(MakeUnique<DispatchScratch>());
+		scratch = dispatch_scratch_stack[dispatch_scratch_depth].get();
+		dispatch_scratch_depth += 1;
+	}
+	~DispatchScratchScope()
+	{
+		// Clear the buffers while keeping their capacity, releasing any observed elements and listeners.
+		scratch->listeners.clear();
+		scratch->default_action_elements.clear();
+		dispatch_scratch_depth -= 1;
+	}
+	DispatchScratch& Get() { return *scratch; }
+
+private:
+	DispatchScratch* scratch;
+};
+
+
+template <typename Parameters>
+bool EventDispatcher::DispatchEventImpl(Element* target_element, const EventId id, const String& type, const Parameters& parameters, const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
+{
+	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture), "We assume here that the default action phases cannot include capture phase.");
+
+	// Early-out when no listeners for this event exist on the path from the target to the root. Then, we only need to
+	// walk the tree when default actions are executed in the bubble phase.
+	const bool collect_listeners = target_element->GetEventDispatcher()->MayHaveListenersInChain(id);
+	if (!collect_listeners && default_action_phase == DefaultActionPhase::None)
+		return true;
+
+	const bool walk_ancestors = (collect_listeners || ((int)default_action_phase & (int)EventPhase::Bubble));
+
+	DispatchScratchScope scratch_scope;
+	Vector<CollectedListener>& listeners = scratch_scope.Get().listeners;
+	Vector<ObserverPtr<Element>>& default_action_elements = scratch_scope.Get().default_action_elements;
 
 	const EventPhase phases_to_execute = EventPhase((int)EventPhase::Capture | (int)EventPhase::Target | (bubbles ? (int)EventPhase::Bubble : 0));
 	
@@ -141,8 +244,11 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 	Element* walk_element = target_element;
 	while (walk_element)
 	{
-		EventDispatcher* dispatcher = walk_element->GetEventDispatcher();
-		dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners);
+		if (collect_listeners)
+		{
+			EventDispatcher* dispatcher = walk_element->GetEventDispatcher();
+			dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners);
+		}
 
 		if(dom_distance_from_target == 0)
 		{
@@ -154,6 +260,9 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 			default_action_elements.push_back(walk_element->GetObserverPtr());
 		}
 
+		if (!walk_ancestors)
+			break;
+
 		walk_element = walk_element->GetParentNode();
 		dom_distance_from_target += 1;
 	}
@@ -161,8 +270,9 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 	if (listeners.empty() && default_action_elements.empty())
 		return true;
 
-	// Use stable_sort so that the order of the listeners in a given element is maintained.
-	std::stable_sort(listeners.begin(), listeners.end());
+	// The collect order is part of the comparison so that the order of the listeners in a given element is maintained.
+	// This avoids the temporary buffer allocated by stable_sort.
+	std::sort(listeners.begin(), listeners.end());
 
 	// Instance event
 	EventPtr event = Factory::InstanceEvent(target_element, id, type, parameters, interruptible);
@@ -217,6 +327,17 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 }
 
 
+bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const Dictionary& parameters, const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
+{
+	return DispatchEventImpl(target_element, id, type, parameters, interruptible, bubbles, default_action_phase);
+}
+
+bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const EventInputParameters& input_parameters, const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
+{
+	return DispatchEventImpl(target_element, id, type, input_parameters, interruptible, bubbles, default_action_phase);
+}
+
+
 void EventDispatcher::CollectListeners(int dom_distance_from_target, const EventId event_id, const EventPhase event_executes_in_phases, Vector<CollectedListener>& collect_listeners)
 {
 	// Find all the entries with a matching id, given that listeners are sorted by id first.
@@ -231,7 +352,7 @@ void EventDispatcher::CollectListeners(int dom_distance_from_target, const Event
 		if ((int)event_executes_in_phases & (int)EventPhase::Target)
 		{
 			for (auto it = begin; it != end; ++it)
-				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, false);
+				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, false, (int)collect_listeners.size());
 		}
 	}
 	else
@@ -242,7 +363,7 @@ void EventDispatcher::CollectListeners(int dom_distance_from_target, const Event
 			// Listeners will either attach to capture or bubble phase, make sure the event can execute in the same phase.
 			const EventPhase listener_executes_in_phase = (it->in_capture_phase ? EventPhase::Capture : EventPhase::Bubble);
 			if ((int)event_executes_in_phases & (int)listener_executes_in_phase)
-				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, it->in_capture_phase);
+				collect_listeners.emplace_back(element, it->listener, dom_distance_from_target, it->in_capture_phase, (int)collect_listeners.size());
 		}
 	}
 }
@@ -89,14 +89,38 @@ public:
 	/// @param[in] default_action_phase The phases to execute default actions in
 	/// @return True if the event was not consumed (ie, was prevented from propagating by an element), false if it was.
 	static bool DispatchEvent(Element* target_element, EventId id, const String& type, const Dictionary& parameters, bool interruptible, bool bubbles, DefaultActionPhase default_action_phase);
+	/// Dispatches the specified event with typed input parameters, which are only converted to a dictionary when requested.
+	/// @param[in] input_parameters The typed event parameters.
+	/// @see DispatchEvent
+	static bool DispatchEvent(Element* target_element, EventId id, const String& type, const EventInputParameters& input_parameters, bool interruptible, bool bubbles, DefaultActionPhase default_action_phase);
 
 	/// Returns event types with number of listeners for debugging.
 	/// @return Summary of attached listeners.
 	String ToString() const;
 
+	/// Updates the listener mask inherited from the element's ancestors, should be called when the element is reparented.
+	void OnParentChange();
+
+	/// Returns false if neither the element nor any of its ancestors have listeners attached for the given event id.
+	/// May return true even if no such listeners exist.
+	bool MayHaveListenersInChain(EventId id) const;
+
 private:
 	Element* element;
 
+	// Bit masks of event ids, custom ids beyond the size of the mask share the last bit.
+	using EventIdMask = uint64_t;
+	static EventIdMask ToMask(EventId id);
+
+	// Event ids with listeners attached to this element.
+	EventIdMask listener_mask = 0;
+	// Event ids with listeners attached to this element or any of its ancestors.
+	EventIdMask chain_listener_mask = 0;
+
+	// Recalculate the listener masks, propagating any changes to the descendants of the element.
+	void UpdateListenerMask();
+	void UpdateChainListenerMask();
+
 	// Listeners are sorted first by (id, phase) and then by the order in which the listener was inserted.
 	// All listeners added are unique.
 	typedef Vector< EventListenerEntry > Listeners;
@@ -104,6 +128,9 @@ private:
 
 	// Collect all the listeners from this dispatcher that are allowed to execute given the input arguments.
 	void CollectListeners(int dom_distance_from_target, EventId event_id, EventPhase phases_to_execute, Vector<CollectedListener>& collect_listeners);
+
+	template <typename Parameters>
+	static bool DispatchEventImpl(Element* target_element, EventId id, const String& type, const Parameters& parameters, bool interruptible, bool bubbles, DefaultActionPhase default_action_phase);
 };
 
 
@@ -28,9 +28,13 @@
 
 #include "EventInstancerDefault.h"
 #include "../../Include/RmlUi/Core/Event.h"
+#include "Pool.h"
 
 namespace Rml {
 
+// Not thread-safe, events are only dispatched from the thread updating the contexts.
+static Pool< Event > pool_event(50, true);
+
 EventInstancerDefault::EventInstancerDefault()
 {
 }
@@ -41,13 +45,14 @@ EventInstancerDefault::~EventInstancerDefault()
 
 EventPtr EventInstancerDefault::InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible)
 {
-	return EventPtr(new Event(target, id, type, parameters, interruptible));
+	Event* event = pool_event.AllocateAndConstruct(target, id, type, parameters, interruptible);
+	return EventPtr(event);
 }
 
 // Releases an event instanced by this instancer.
 void EventInstancerDefault::ReleaseEvent(Event* event)
 {
-	delete event;
+	pool_event.DestroyAndDeallocate(event);
 }
 
 void EventInstancerDefault::Release()
@@ -53,6 +53,7 @@
 #include "../../Include/RmlUi/Core/Elements/ElementDataGridCell.h"
 #include "../../Include/RmlUi/Core/Elements/ElementDataGridRow.h"
 
+#include "CompiledDocument.h"
 #include "ContextInstancerDefault.h"
 #include "DataControllerDefault.h"
 #include "DataViewDefault.h"
@@ -69,6 +70,7 @@
 #include "FontEffectOutline.h"
 #include "FontEffectShadow.h"
 #include "PluginRegistry.h"
+#include "ProfileRecorder.h"
 #include "StreamFile.h"
 #include "StyleSheetFactory.h"
 #include "TemplateCache.h"
@@ -204,6 +206,8 @@ Factory::~Factory()
 
 bool Factory::Initialise()
 {
+	RMLUI_RecordZone("InitialiseFactory");
+
 	default_instancers = MakeUnique<DefaultInstancers>();
 
 	// Default context instancer
@@ -474,7 +478,61 @@ bool Factory::InstanceElementStream(Element* parent, Stream* stream)
 ElementPtr Factory::InstanceDocumentStream(Context* context, Stream* stream, const String& document_base_tag)
 {
 	RMLUI_ZoneScoped;
+	RMLUI_RecordZone("InstanceDocument");
+	RMLUI_RecordZoneText(stream->GetSourceURL().GetURL());
+
+	ElementPtr element = InstanceDocumentElement(context, document_base_tag);
+	if (!element)
+		return nullptr;
+
+	XMLParser parser(element.get());
+	parser.Parse(stream);
+
+	return element;
+}
+
+void Factory::CompileDocument(String& data, const String& document_rml, const String& source_url)
+{
+	RMLUI_ZoneScoped;
+	RMLUI_RecordZone("CompileDocument");
+	RMLUI_RecordZoneText(source_url);
+
+	StreamMemory stream((const byte*)document_rml.data(), document_rml.size());
+	stream.SetSourceURL(source_url);
+
+	CompiledDocument compiled_document;
+	compiled_document.Compile(&stream);
+	compiled_document.Write(data, document_rml);
+}
+
+ElementPtr Factory::InstanceDocumentCompiled(Context* context, const String& data, const String& source_url, const String* document_rml,
+	const String& document_base_tag)
+{
+	CompiledDocument compiled_document;
+	if (!compiled_document.Read(data, URL(source_url), document_rml))
+		return nullptr;
+
+	return InstanceDocumentCompiled(context, compiled_document, document_base_tag);
+}
+
+ElementPtr Factory::InstanceDocumentCompiled(Context* context, const CompiledDocument& compiled_document, const String& document_base_tag)
+{
+	RMLUI_ZoneScoped;
+	RMLUI_RecordZone("InstanceDocument");
+	RMLUI_RecordZoneText(compiled_document.GetSourceURL().GetURL());
 
+	ElementPtr element = InstanceDocumentElement(context, document_base_tag);
+	if (!element)
+		return nullptr;
+
+	XMLParser parser(element.get());
+	compiled_document.Instance(parser);
+
+	return element;
+}
+
+ElementPtr Factory::InstanceDocumentElement(Context* context, const String& document_base_tag)
+{
 	ElementPtr element = Factory::InstanceElement(nullptr, document_base_tag, document_base_tag, XMLAttributes());
 	if (!element)
 	{
@@ -491,9 +549,6 @@ ElementPtr Factory::InstanceDocumentStream(Context* context, Stream* stream, con
 
 	document->context = context;
 
-	XMLParser parser(element.get());
-	parser.Parse(stream);
-
 	return element;
 }
 
@@ -585,6 +640,28 @@ EventPtr Factory::InstanceEvent(Element* target, EventId id, const String& type,
 	return event;
 }
 
+EventPtr Factory::InstanceEvent(Element* target, EventId id, const String& type, const EventInputParameters& input_parameters, bool interruptible)
+{
+	if (event_instancer != default_instancers->event_default.get())
+	{
+		// Custom instancers may derive from the event and read its parameters during construction, thus they are given
+		// the full dictionary up front.
+		Dictionary parameters;
+		Event::GenerateInputParameters(input_parameters, parameters);
+		return InstanceEvent(target, id, type, parameters, interruptible);
+	}
+
+	// Events from the default instancer only generate their dictionary when it is requested.
+	static const Dictionary empty_parameters;
+	EventPtr event = event_instancer->InstanceEvent(target, id, type, empty_parameters, interruptible);
+	if (event)
+	{
+		event->instancer = event_instancer;
+		event->SetInputParameters(input_parameters);
+	}
+	return event;
+}
+
 // Register an instancer for all event listeners
 void Factory::RegisterEventListenerInstancer(EventListenerInstancer* instancer)
 {
@@ -71,4 +71,9 @@ bool FileInterface::LoadFile(const String& path, String& out_data)
 	return true;
 }
 
+bool FileInterface::GetModificationTime(const String& /*path*/, uint64_t& /*out_time*/)
+{
+	return false;
+}
+
 } // namespace Rml
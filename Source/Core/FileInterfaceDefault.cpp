@@ -30,6 +30,8 @@
 
 #ifndef RMLUI_NO_FILE_INTERFACE_DEFAULT
 
+#include <sys/stat.h>
+
 namespace Rml {
 
 FileInterfaceDefault::~FileInterfaceDefault()
@@ -66,5 +68,27 @@ size_t FileInterfaceDefault::Tell(FileHandle file)
 	return ftell((FILE*) file);
 }
 
+// Retrieves the time a file was last modified.
+bool FileInterfaceDefault::GetModificationTime(const String& path, uint64_t& out_time)
+{
+#if defined(RMLUI_PLATFORM_WIN32)
+	struct _stat64 info;
+	if (_stat64(path.c_str(), &info) != 0)
+		return false;
+	out_time = (uint64_t)info.st_mtime;
+#elif defined(RMLUI_PLATFORM_MACOSX)
+	struct stat info;
+	if (stat(path.c_str(), &info) != 0)
+		return false;
+	out_time = (uint64_t)info.st_mtimespec.tv_sec * 1000000000ull + (uint64_t)info.st_mtimespec.tv_nsec;
+#else
+	struct stat info;
+	if (stat(path.c_str(), &info) != 0)
+		return false;
+	out_time = (uint64_t)info.st_mtim.tv_sec * 1000000000ull + (uint64_t)info.st_mtim.tv_nsec;
+#endif
+	return true;
+}
+
 } // namespace Rml
 #endif /*RMLUI_NO_FILE_INTERFACE_DEFAULT*/
@@ -70,6 +70,12 @@ public:
 	/// @param file The handle of the file to be queried.
 	/// @return The number of bytes from the origin of the file.
 	size_t Tell(FileHandle file) override;
+
+	/// Retrieves the time a file was last modified.
+	/// @param path The path to the file.
+	/// @param out_time The modification time of the file.
+	/// @return True on success.
+	bool GetModificationTime(const String& path, uint64_t& out_time) override;
 };
 
 } // namespace Rml
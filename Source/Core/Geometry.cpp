@@ -30,8 +30,10 @@
 #include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "GeometryArena.h"
 #include "GeometryDatabase.h"
 #include <utility>
 
@@ -71,7 +73,17 @@ void Geometry::MoveFrom(Geometry& other)
 
 	texture = std::exchange(other.texture, nullptr);
 
+	if (arena_handle)
+		arena->Erase(arena_handle);
+	arena = std::exchange(other.arena, nullptr);
+	arena_handle = std::exchange(other.arena_handle, 0);
+
+	compact_vertices = std::move(other.compact_vertices);
+	untextured_vertices = std::move(other.untextured_vertices);
+	compact_indices = std::move(other.compact_indices);
+
 	compiled_geometry = std::exchange(other.compiled_geometry, 0);
+	compiled_texture = std::exchange(other.compiled_texture, 0);
 	compile_attempted = std::exchange(other.compile_attempted, false);
 }
 
@@ -79,7 +91,7 @@ Geometry::~Geometry()
 {
 	GeometryDatabase::Erase(database_handle);
 
-	Release();
+	Release(true);
 }
 
 // Set the host element for this geometry; this should be passed in the constructor if possible.
@@ -105,12 +117,26 @@ void Geometry::Render(Vector2f translation)
 
 	translation = translation.Round();
 
+	// Textured geometry is skipped while its texture is being loaded in the background.
+	const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+	if (!texture_handle && texture && texture->IsLoading(render_interface))
+		return;
+
+	// Recompile the geometry if its texture has been evicted and reloaded with a new handle since it was compiled.
+	if (compiled_geometry && compiled_texture != texture_handle)
+		Release();
+
 	// Render our compiled geometry if possible.
 	if (compiled_geometry)
 	{
 		RMLUI_ZoneScopedN("RenderCompiled");
 		render_interface->RenderCompiledGeometry(compiled_geometry, translation);
 	}
+	else if (arena_handle)
+	{
+		RMLUI_ZoneScopedN("RenderArena");
+		arena->Render(arena_handle, render_interface, texture_handle, translation);
+	}
 	// Otherwise, if we actually have geometry, try to compile it if we haven't already done so, otherwise render it in
 	// immediate mode.
 	else
@@ -124,7 +150,24 @@ void Geometry::Render(Vector2f translation)
 		if (!compile_attempted)
 		{
 			compile_attempted = true;
-			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(render_interface) : 0);
+
+			// Prefer placing the geometry in the arena of our context if supported by the render interface, in which case
+			// we no longer need our own copy.
+			if (host_context)
+			{
+				arena_handle = host_context->geometry_arena->Insert(render_interface, vertices, indices);
+				if (arena_handle)
+				{
+					arena = host_context->geometry_arena.get();
+					Vector<Vertex>().swap(vertices);
+					Vector<int>().swap(indices);
+					arena->Render(arena_handle, render_interface, texture_handle, translation);
+					return;
+				}
+			}
+
+			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture_handle);
+			compiled_texture = texture_handle;
 
 			// If we managed to compile the geometry, we can clear the local copy of vertices and indices and
 			// immediately render the compiled version.
@@ -133,23 +176,39 @@ void Geometry::Render(Vector2f translation)
 				render_interface->RenderCompiledGeometry(compiled_geometry, translation);
 				return;
 			}
+
+			if (vertices.size() <= 65536 && render_interface->SupportsCompactGeometry())
+				GenerateCompactGeometry();
+		}
+
+		if (!compact_indices.empty())
+		{
+			if (texture)
+				render_interface->RenderCompactGeometry(compact_vertices.data(), (int)compact_vertices.size(), compact_indices.data(),
+					(int)compact_indices.size(), texture_handle, translation);
+			else
+				render_interface->RenderUntexturedGeometry(untextured_vertices.data(), (int)untextured_vertices.size(), compact_indices.data(),
+					(int)compact_indices.size(), translation);
+			return;
 		}
 
 		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
 		// render the uncompiled version.
-		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(GetRenderInterface()) : 0, translation);
+		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture_handle, translation);
 	}
 }
 
 // Returns the geometry's vertices. If these are written to, Release() should be called to force a recompile.
 Vector< Vertex >& Geometry::GetVertices()
 {
+	ReleaseArena(true);
 	return vertices;
 }
 
 // Returns the geometry's indices. If these are written to, Release() should be called to force a recompile.
 Vector< int >& Geometry::GetIndices()
 {
+	ReleaseArena(true);
 	return indices;
 }
 
@@ -166,8 +225,24 @@ void Geometry::SetTexture(const Texture* _texture)
 	Release();
 }
 
+void Geometry::UpdateVertices(const Vector< Vertex >& new_vertices)
+{
+	// The indices are unchanged, thus the vertices can be written directly to their current location in the arena.
+	if (arena_handle)
+	{
+		arena->WriteVertices(arena_handle, new_vertices);
+		return;
+	}
+
+	RMLUI_ASSERT(new_vertices.size() == vertices.size());
+	vertices = new_vertices;
+	Release();
+}
+
 void Geometry::Release(bool clear_buffers)
 {
+	ReleaseArena(!clear_buffers);
+
 	if (compiled_geometry)
 	{
 		GetRenderInterface()->ReleaseCompiledGeometry(compiled_geometry);
@@ -176,6 +251,10 @@ void Geometry::Release(bool clear_buffers)
 
 	compile_attempted = false;
 
+	compact_vertices.clear();
+	untextured_vertices.clear();
+	compact_indices.clear();
+
 	if (clear_buffers)
 	{
 		vertices.clear();
@@ -185,7 +264,58 @@ void Geometry::Release(bool clear_buffers)
 
 Geometry::operator bool() const
 {
-	return !indices.empty();
+	return !indices.empty() || arena_handle != 0;
+}
+
+void Geometry::GenerateCompactGeometry()
+{
+	// Texture coordinates are only needed for textured geometry.
+	if (texture)
+	{
+		// Half precision is only sufficient for texture coordinates within the texture, otherwise the geometry is
+		// rendered in full.
+		for (const Vertex& vertex : vertices)
+		{
+			if (vertex.tex_coord.x < 0.f || vertex.tex_coord.x > 1.f || vertex.tex_coord.y < 0.f || vertex.tex_coord.y > 1.f)
+				return;
+		}
+
+		compact_vertices.resize(vertices.size());
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			compact_vertices[i].position = vertices[i].position;
+			compact_vertices[i].colour = vertices[i].colour;
+			compact_vertices[i].tex_coord[0] = Math::FloatToHalf(vertices[i].tex_coord.x);
+			compact_vertices[i].tex_coord[1] = Math::FloatToHalf(vertices[i].tex_coord.y);
+		}
+	}
+	else
+	{
+		untextured_vertices.resize(vertices.size());
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			untextured_vertices[i].position = vertices[i].position;
+			untextured_vertices[i].colour = vertices[i].colour;
+		}
+	}
+
+	compact_indices.resize(indices.size());
+	for (size_t i = 0; i < indices.size(); i++)
+		compact_indices[i] = (uint16_t)indices[i];
+}
+
+void Geometry::ReleaseArena(bool read_back)
+{
+	if (!arena_handle)
+		return;
+
+	if (read_back)
+		arena->Read(arena_handle, vertices, indices);
+
+	arena->Erase(arena_handle);
+	arena = nullptr;
+	arena_handle = 0;
+	compile_attempted = false;
 }
 
 // Returns the host context's render interface.
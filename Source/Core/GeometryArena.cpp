@@ -0,0 +1,291 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "GeometryArena.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include <algorithm>
+
+namespace Rml {
+
+static constexpr int page_vertex_capacity = 1 << 16;
+static constexpr int page_index_capacity = 1 << 17;
+
+GeometryArena::GeometryArena() {}
+
+GeometryArena::~GeometryArena()
+{
+	RMLUI_ASSERTMSG(GetNumAllocations() == 0, "All geometry should be moved out of the arena before it is destroyed.");
+
+	for (Page& page : pages)
+	{
+		if (page.buffer)
+			page.render_interface->ReleaseGeometryBuffer(page.buffer);
+	}
+}
+
+int GeometryArena::AllocateRange(Vector<Range>& free_ranges, int size)
+{
+	for (auto it = free_ranges.begin(); it != free_ranges.end(); ++it)
+	{
+		if (it->size >= size)
+		{
+			const int offset = it->offset;
+			it->offset += size;
+			it->size -= size;
+			if (it->size == 0)
+				free_ranges.erase(it);
+			return offset;
+		}
+	}
+	return -1;
+}
+
+void GeometryArena::FreeRange(Vector<Range>& free_ranges, int offset, int size)
+{
+	auto it = std::lower_bound(free_ranges.begin(), free_ranges.end(), offset, [](const Range& range, int value) { return range.offset < value; });
+	it = free_ranges.insert(it, Range{offset, size});
+
+	auto next = it + 1;
+	if (next != free_ranges.end() && it->offset + it->size == next->offset)
+	{
+		it->size += next->size;
+		free_ranges.erase(next);
+	}
+
+	if (it != free_ranges.begin())
+	{
+		auto prev = it - 1;
+		if (prev->offset + prev->size == it->offset)
+		{
+			prev->size += it->size;
+			free_ranges.erase(it);
+		}
+	}
+}
+
+GeometryArenaHandle GeometryArena::Insert(RenderInterface* render_interface, const Vector<Vertex>& in_vertices, const Vector<int>& in_indices)
+{
+	if (std::find(unsupported_interfaces.begin(), unsupported_interfaces.end(), render_interface) != unsupported_interfaces.end())
+		return 0;
+
+	const int num_vertices = (int)in_vertices.size();
+	const int num_indices = (int)in_indices.size();
+
+	Allocation allocation = {};
+	allocation.page = -1;
+	allocation.num_vertices = num_vertices;
+	allocation.num_indices = num_indices;
+
+	for (int i = 0; i < (int)pages.size() && allocation.page < 0; i++)
+	{
+		Page& page = pages[i];
+		if (page.render_interface != render_interface || !page.buffer)
+			continue;
+
+		const int vertex_offset = AllocateRange(page.free_vertices, num_vertices);
+		if (vertex_offset < 0)
+			continue;
+
+		const int index_offset = AllocateRange(page.free_indices, num_indices);
+		if (index_offset < 0)
+		{
+			FreeRange(page.free_vertices, vertex_offset, num_vertices);
+			continue;
+		}
+
+		allocation.page = i;
+		allocation.vertex_offset = vertex_offset;
+		allocation.index_offset = index_offset;
+	}
+
+	if (allocation.page < 0)
+	{
+		allocation.page = CreatePage(render_interface, num_vertices, num_indices);
+		if (allocation.page < 0)
+			return 0;
+
+		Page& page = pages[allocation.page];
+		allocation.vertex_offset = AllocateRange(page.free_vertices, num_vertices);
+		allocation.index_offset = AllocateRange(page.free_indices, num_indices);
+	}
+
+	Page& page = pages[allocation.page];
+	page.num_allocations += 1;
+
+	std::copy(in_vertices.begin(), in_vertices.end(), page.vertices.begin() + allocation.vertex_offset);
+	std::copy(in_indices.begin(), in_indices.end(), page.indices.begin() + allocation.index_offset);
+
+	page.dirty_vertices_begin = Math::Min(page.dirty_vertices_begin, allocation.vertex_offset);
+	page.dirty_vertices_end = Math::Max(page.dirty_vertices_end, allocation.vertex_offset + num_vertices);
+	page.dirty_indices_begin = Math::Min(page.dirty_indices_begin, allocation.index_offset);
+	page.dirty_indices_end = Math::Max(page.dirty_indices_end, allocation.index_offset + num_indices);
+
+	GeometryArenaHandle handle;
+	if (free_list.empty())
+	{
+		handle = GeometryArenaHandle(allocations.size());
+		allocations.push_back(allocation);
+	}
+	else
+	{
+		handle = free_list.back();
+		free_list.pop_back();
+		allocations[handle] = allocation;
+	}
+
+	// Zero is reserved for invalid handles.
+	return handle + 1;
+}
+
+void GeometryArena::Erase(GeometryArenaHandle handle)
+{
+	const Allocation& allocation = GetAllocation(handle);
+	Page& page = pages[allocation.page];
+
+	FreeRange(page.free_vertices, allocation.vertex_offset, allocation.num_vertices);
+	FreeRange(page.free_indices, allocation.index_offset, allocation.num_indices);
+	page.num_allocations -= 1;
+
+	free_list.push_back(handle - 1);
+}
+
+void GeometryArena::Read(GeometryArenaHandle handle, Vector<Vertex>& out_vertices, Vector<int>& out_indices) const
+{
+	const Allocation& allocation = GetAllocation(handle);
+	const Page& page = pages[allocation.page];
+
+	out_vertices.assign(page.vertices.begin() + allocation.vertex_offset, page.vertices.begin() + allocation.vertex_offset + allocation.num_vertices);
+	out_indices.assign(page.indices.begin() + allocation.index_offset, page.indices.begin() + allocation.index_offset + allocation.num_indices);
+}
+
+void GeometryArena::WriteVertices(GeometryArenaHandle handle, const Vector<Vertex>& in_vertices)
+{
+	const Allocation& allocation = GetAllocation(handle);
+	Page& page = pages[allocation.page];
+
+	RMLUI_ASSERT((int)in_vertices.size() == allocation.num_vertices);
+	std::copy(in_vertices.begin(), in_vertices.end(), page.vertices.begin() + allocation.vertex_offset);
+
+	page.dirty_vertices_begin = Math::Min(page.dirty_vertices_begin, allocation.vertex_offset);
+	page.dirty_vertices_end = Math::Max(page.dirty_vertices_end, allocation.vertex_offset + allocation.num_vertices);
+}
+
+void GeometryArena::Render(GeometryArenaHandle handle, RenderInterface* render_interface, TextureHandle texture, Vector2f translation)
+{
+	const Allocation& allocation = GetAllocation(handle);
+	Page& page = pages[allocation.page];
+
+	if (render_interface != page.render_interface)
+	{
+		// Rendered through a different interface than the one it was inserted for, the local copy can still be rendered directly.
+		render_interface->RenderGeometry(&page.vertices[allocation.vertex_offset], allocation.num_vertices, &page.indices[allocation.index_offset],
+			allocation.num_indices, texture, translation);
+		return;
+	}
+
+	// Upload all changes to the page in a single call, typically once per frame.
+	if (page.dirty_vertices_begin < page.dirty_vertices_end || page.dirty_indices_begin < page.dirty_indices_end)
+	{
+		RMLUI_ZoneScopedN("UpdateGeometryBuffer");
+
+		const int vertex_begin = Math::Min(page.dirty_vertices_begin, page.dirty_vertices_end);
+		const int index_begin = Math::Min(page.dirty_indices_begin, page.dirty_indices_end);
+
+		render_interface->UpdateGeometryBuffer(page.buffer, vertex_begin, page.vertices.data() + vertex_begin, page.dirty_vertices_end - vertex_begin,
+			index_begin, page.indices.data() + index_begin, page.dirty_indices_end - index_begin);
+
+		page.dirty_vertices_begin = page.dirty_indices_begin = INT32_MAX;
+		page.dirty_vertices_end = page.dirty_indices_end = 0;
+	}
+
+	render_interface->RenderGeometryBuffer(page.buffer, allocation.vertex_offset, allocation.index_offset, allocation.num_indices, texture, translation);
+}
+
+void GeometryArena::ReleaseAll()
+{
+	for (Page& page : pages)
+	{
+		if (page.buffer && page.num_allocations == 0)
+		{
+			page.render_interface->ReleaseGeometryBuffer(page.buffer);
+			page = Page();
+		}
+	}
+
+	// Only trailing pages can be removed, as allocations refer to pages by index.
+	while (!pages.empty() && !pages.back().buffer)
+		pages.pop_back();
+
+	unsupported_interfaces.clear();
+}
+
+int GeometryArena::GetNumAllocations() const
+{
+	int num_allocations = 0;
+	for (const Page& page : pages)
+		num_allocations += page.num_allocations;
+	return num_allocations;
+}
+
+const GeometryArena::Allocation& GeometryArena::GetAllocation(GeometryArenaHandle handle) const
+{
+	RMLUI_ASSERT(handle > 0 && handle <= (GeometryArenaHandle)allocations.size());
+	return allocations[handle - 1];
+}
+
+int GeometryArena::CreatePage(RenderInterface* render_interface, int num_vertices, int num_indices)
+{
+	// Geometry larger than the default capacity is given a page of its own.
+	const int vertex_capacity = Math::Max(page_vertex_capacity, num_vertices);
+	const int index_capacity = Math::Max(page_index_capacity, num_indices);
+
+	GeometryBufferHandle buffer = 0;
+	if (!render_interface->CreateGeometryBuffer(buffer, vertex_capacity, index_capacity) || !buffer)
+	{
+		unsupported_interfaces.push_back(render_interface);
+		return -1;
+	}
+
+	// Reuse the slot of a released page if possible.
+	auto it = std::find_if(pages.begin(), pages.end(), [](const Page& page) { return !page.buffer; });
+	if (it == pages.end())
+		it = pages.insert(pages.end(), Page());
+
+	Page& page = *it;
+	page.render_interface = render_interface;
+	page.buffer = buffer;
+	page.vertices.resize(vertex_capacity);
+	page.indices.resize(index_capacity);
+	page.free_vertices = { Range{0, vertex_capacity} };
+	page.free_indices = { Range{0, index_capacity} };
+
+	return int(it - pages.begin());
+}
+
+} // namespace Rml
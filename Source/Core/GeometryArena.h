@@ -0,0 +1,127 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_GEOMETRYARENA_H
+#define RMLUI_CORE_GEOMETRYARENA_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
+#include <stdint.h>
+
+namespace Rml {
+
+class RenderInterface;
+using GeometryArenaHandle = uint32_t;
+
+/**
+    The geometry arena packs the vertices and indices of geometry into a small number of large pages, each backed by a
+    single geometry buffer in the render interface. Geometry is then rendered by offsets into the buffers, rather than
+    compiling and storing each geometry separately.
+
+    Each context owns an arena for the geometry of its elements. Only used with render interfaces supporting geometry
+    buffers, see RenderInterface::CreateGeometryBuffer(). Each successful Insert() must be followed by exactly one
+    Erase() with the returned handle.
+*/
+
+class GeometryArena : NonCopyMoveable {
+public:
+	GeometryArena();
+	~GeometryArena();
+
+	// Copies the geometry into the arena, placing it in pages of the given render interface.
+	// @return A handle to the geometry, or zero if the render interface does not support geometry buffers.
+	GeometryArenaHandle Insert(RenderInterface* render_interface, const Vector<Vertex>& vertices, const Vector<int>& indices);
+	void Erase(GeometryArenaHandle handle);
+
+	// Copies the geometry from the arena back into the given arrays.
+	void Read(GeometryArenaHandle handle, Vector<Vertex>& vertices, Vector<int>& indices) const;
+
+	// Overwrites the vertices of the geometry in place, the number of vertices must be unchanged.
+	void WriteVertices(GeometryArenaHandle handle, const Vector<Vertex>& vertices);
+
+	void Render(GeometryArenaHandle handle, RenderInterface* render_interface, TextureHandle texture, Vector2f translation);
+
+	// Releases the geometry buffers of all empty pages.
+	void ReleaseAll();
+
+	// Returns the number of geometries placed in the arena.
+	int GetNumAllocations() const;
+
+private:
+	// A contiguous range of free vertices or indices in a page.
+	struct Range {
+		int offset;
+		int size;
+	};
+
+	struct Page {
+		RenderInterface* render_interface = nullptr;
+		GeometryBufferHandle buffer = 0;
+
+		// Local copy of the buffer contents, used for uploading and for reading back the geometry.
+		Vector<Vertex> vertices;
+		Vector<int> indices;
+
+		Vector<Range> free_vertices;
+		Vector<Range> free_indices;
+		int num_allocations = 0;
+
+		// Ranges written to since the last upload, as [begin, end).
+		int dirty_vertices_begin = INT32_MAX, dirty_vertices_end = 0;
+		int dirty_indices_begin = INT32_MAX, dirty_indices_end = 0;
+	};
+
+	struct Allocation {
+		int page;
+		int vertex_offset;
+		int num_vertices;
+		int index_offset;
+		int num_indices;
+	};
+
+	// First-fit allocation from a list of free ranges, ordered by offset.
+	static int AllocateRange(Vector<Range>& free_ranges, int size);
+	// Returns the range to the free list, merging it with any adjacent free ranges.
+	static void FreeRange(Vector<Range>& free_ranges, int offset, int size);
+
+	const Allocation& GetAllocation(GeometryArenaHandle handle) const;
+
+	// Creates a new page able to hold at least the given number of vertices and indices.
+	// @return The index of the page, or -1 if the render interface does not support geometry buffers.
+	int CreatePage(RenderInterface* render_interface, int num_vertices, int num_indices);
+
+	Vector<Page> pages;
+	Vector<Allocation> allocations;
+	// Declares free slots in the 'allocations' list as indices.
+	Vector<GeometryArenaHandle> free_list;
+	Vector<RenderInterface*> unsupported_interfaces;
+};
+
+} // namespace Rml
+#endif
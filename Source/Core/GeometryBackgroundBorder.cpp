@@ -37,7 +37,8 @@ namespace Rml {
 GeometryBackgroundBorder::GeometryBackgroundBorder(Vector<Vertex>& vertices, Vector<int>& indices) : vertices(vertices), indices(indices)
 {}
 
-void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indices, CornerSizes radii, const Box& box, const Vector2f offset, const Colourb background_color, const Colourb* border_colors)
+void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indices, CornerSizes radii, const Box& box, const Vector2f offset,
+	const Colourb background_color, const Colourb* border_colors, Vector<ColorSegment>* color_segments)
 {
 	using Edge = Box::Edge;
 
@@ -134,6 +135,7 @@ void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indic
 	// -- Generate the geometry --
 
 	GeometryBackgroundBorder geometry(vertices, indices);
+	geometry.color_segments = color_segments;
 
 	{
 		// Reserve geometry. A conservative estimate, does not take border-radii into account and assumes same-colored borders.
@@ -149,6 +151,8 @@ void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indic
 	{
 		const int offset_vertices = (int)vertices.size();
 
+		geometry.color_source0 = geometry.color_source1 = -1;
+
 		for (int corner = 0; corner < 4; corner++)
 			geometry.DrawBackgroundCorner(Corner(corner), positions_inner[corner], positions_circle_center[corner], radii[corner], inner_radii[corner], background_color);
 
@@ -180,6 +184,9 @@ void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indic
 			const Edge edge0 = Edge((corner + 3) % 4);
 			const Edge edge1 = Edge(corner);
 
+			geometry.color_source0 = (int)edge0;
+			geometry.color_source1 = (int)edge1;
+
 			if (draw_corner[corner])
 				geometry.DrawBorderCorner(Corner(corner), positions_outer[corner], positions_inner[corner], positions_circle_center[corner],
 					radii[corner], inner_radii[corner], border_colors[edge0], border_colors[edge1]);
@@ -222,6 +229,8 @@ void GeometryBackgroundBorder::Draw(Vector<Vertex>& vertices, Vector<int>& indic
 
 void GeometryBackgroundBorder::DrawBackgroundCorner(Corner corner, Vector2f pos_inner, Vector2f pos_circle_center, float R, Vector2f r, Colourb color)
 {
+	const int offset_vertices = (int)vertices.size();
+
 	if (R == 0 || r.x <= 0 || r.y <= 0)
 	{
 		DrawPoint(pos_inner, color);
@@ -233,6 +242,8 @@ void GeometryBackgroundBorder::DrawBackgroundCorner(Corner corner, Vector2f pos_
 		const int num_points = GetNumPoints(R);
 		DrawArc(pos_circle_center, r, a0, a1, color, color, num_points);
 	}
+
+	AddColorSegment(offset_vertices, (int)vertices.size() - offset_vertices, 1, color_source0, color_source0);
 }
 
 void GeometryBackgroundBorder::DrawPoint(Vector2f pos, Colourb color)
@@ -306,15 +317,18 @@ void GeometryBackgroundBorder::DrawPointPoint(Vector2f pos_outer, Vector2f pos_i
 {
 	const bool different_color = (color0 != color1);
 
-	vertices.reserve((int)vertices.size() + (different_color ? 4 : 2));
+	const int offset_vertices = (int)vertices.size();
+	vertices.reserve(offset_vertices + (different_color ? 4 : 2));
 
 	DrawPoint(pos_inner, color0);
 	DrawPoint(pos_outer, color0);
+	AddColorSegment(offset_vertices, 2, 1, color_source0, color_source0);
 
 	if (different_color)
 	{
 		DrawPoint(pos_inner, color1);
 		DrawPoint(pos_outer, color1);
+		AddColorSegment(offset_vertices + 2, 2, 1, color_source1, color_source1);
 	}
 }
 
@@ -354,6 +368,8 @@ void GeometryBackgroundBorder::DrawArcArc(Vector2f pos_center, float R, Vector2f
 		indices[offset_indices + 3 * i + 4] = offset_vertices + i + 2;
 		indices[offset_indices + 3 * i + 5] = offset_vertices + i + 3;
 	}
+
+	AddColorSegment(offset_vertices, num_points, 2, color_source0, color_source1);
 }
 
 void GeometryBackgroundBorder::DrawArcPoint(Vector2f pos_center, Vector2f pos_inner, float R, float a0, float a1, Colourb color0, Colourb color1, int num_points)
@@ -370,6 +386,10 @@ void GeometryBackgroundBorder::DrawArcPoint(Vector2f pos_center, Vector2f pos_in
 
 	RMLUI_ASSERT((int)vertices.size() - offset_vertices == num_points + 2);
 
+	AddColorSegment(offset_vertices, 1, 1, color_source0, color_source0);
+	AddColorSegment(offset_vertices + 1, num_points, 1, color_source0, color_source1);
+	AddColorSegment(offset_vertices + num_points + 1, 1, 1, color_source1, color_source1);
+
 	// Swap the last two vertices such that the outer edge vertex is last, see the comment for the border drawing functions. Their colors should already be the same.
 	const int last_vertex = (int)vertices.size() - 1;
 	std::swap(vertices[last_vertex - 1].position, vertices[last_vertex].position);
@@ -416,4 +436,36 @@ int GeometryBackgroundBorder::GetNumPoints(float R) const
 	return Math::Clamp(3 + Math::RoundToInteger(R / 6.f), 2, 100);
 }
 
+void GeometryBackgroundBorder::AddColorSegment(int offset, int num_points, int stride, int source0, int source1)
+{
+	if (color_segments && num_points > 0)
+		color_segments->push_back(ColorSegment{offset, num_points, stride, source0, source1});
+}
+
+void GeometryBackgroundBorder::UpdateColors(Vector<Vertex>& vertices, const Vector<ColorSegment>& color_segments, const Colourb background_color,
+	const Colourb* border_colors)
+{
+	auto GetColor = [&](int source) { return source < 0 ? background_color : border_colors[source]; };
+
+	for (const ColorSegment& segment : color_segments)
+	{
+		RMLUI_ASSERT(segment.offset + segment.num_points * segment.stride <= (int)vertices.size());
+
+		const Colourb color0 = GetColor(segment.source0);
+		const Colourb color1 = GetColor(segment.source1);
+		Vertex* vertex = vertices.data() + segment.offset;
+
+		for (int i = 0; i < segment.num_points; i++)
+		{
+			// Interpolate the same way as when the vertices were generated.
+			Colourb color = color0;
+			if (segment.source0 != segment.source1)
+				color = Math::RoundedLerp(float(i) / float(segment.num_points - 1), color0, color1);
+
+			for (int j = 0; j < segment.stride; j++)
+				(vertex++)->colour = color;
+		}
+	}
+}
+
 } // namespace Rml
@@ -47,6 +47,17 @@ using CornerPositions = Array<Vector2f, 4>;
 
 class GeometryBackgroundBorder {
 public:
+	// Describes how the colors of a range of generated vertices are derived from the background and border colors.
+	struct ColorSegment {
+		// Index of the first vertex.
+		int offset;
+		// Number of points, the colors are interpolated from the first to the last point.
+		int num_points;
+		// Number of consecutive vertices sharing the color of each point.
+		int stride;
+		// Index into the border colors, or -1 for the background color.
+		int source0, source1;
+	};
 
 	/// Generate geometry for background and borders.
 	/// @param[out] vertices Destination vector for generated vertices.
@@ -56,7 +67,17 @@ public:
 	/// @param[in] offset Offset the position of the generated vertices.
 	/// @param[in] background_color Color of the background, set alpha to zero to not generate a background.
 	/// @param[in] border_colors Pointer to a four-element array of border colors in top-right-bottom-left order, or nullptr to not generate borders.
-	static void Draw(Vector<Vertex>& vertices, Vector<int>& indices, CornerSizes radii, const Box& box, Vector2f offset, Colourb background_color, const Colourb* border_colors);
+	/// @param[out] color_segments If set, the color segments of the generated vertices are appended to this vector, see UpdateColors().
+	static void Draw(Vector<Vertex>& vertices, Vector<int>& indices, CornerSizes radii, const Box& box, Vector2f offset, Colourb background_color,
+		const Colourb* border_colors, Vector<ColorSegment>* color_segments = nullptr);
+
+	/// Updates the colors of previously generated vertices in place.
+	/// @note The new colors must not change which backgrounds and borders are visible, or which adjacent borders have equal colors, as that changes the generated geometry.
+	/// @param[in,out] vertices The previously generated vertices.
+	/// @param[in] color_segments The color segments recorded when the vertices were generated.
+	/// @param[in] background_color The new background color.
+	/// @param[in] border_colors The new border colors in top-right-bottom-left order.
+	static void UpdateColors(Vector<Vertex>& vertices, const Vector<ColorSegment>& color_segments, Colourb background_color, const Colourb* border_colors);
 
 private:
 	enum Corner { TOP_LEFT, TOP_RIGHT, BOTTOM_RIGHT, BOTTOM_LEFT };
@@ -108,8 +129,15 @@ private:
 	// -- Tools --
 	int GetNumPoints(float R) const;
 
+	// Records the color segment of newly added vertices, if requested.
+	void AddColorSegment(int offset, int num_points, int stride, int source0, int source1);
+
 	Vector<Vertex>& vertices;
 	Vector<int>& indices;
+
+	// The color sources of the shape currently being drawn, see ColorSegment.
+	Vector<ColorSegment>* color_segments = nullptr;
+	int color_source0 = -1, color_source1 = -1;
 };
 
 } // namespace Rml
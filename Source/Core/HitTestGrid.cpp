@@ -0,0 +1,334 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "HitTestGrid.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "TransformState.h"
+#include <algorithm>
+#include <float.h>
+
+namespace Rml {
+
+static bool IsTransformed(const Element* element)
+{
+	const TransformState* transform_state = element->GetTransformState();
+	return transform_state && transform_state->GetTransform();
+}
+
+static bool IsPointWithinClippingRegion(Vector2f point, Element* element)
+{
+	Vector2i clip_origin, clip_dimensions;
+	if (ElementUtilities::GetClippingRegion(clip_origin, clip_dimensions, element))
+	{
+		return point.x >= clip_origin.x &&
+			point.y >= clip_origin.y &&
+			point.x <= (clip_origin.x + clip_dimensions.x) &&
+			point.y <= (clip_origin.y + clip_dimensions.y);
+	}
+	return true;
+}
+
+void HitTestGrid::DirtyStructure()
+{
+	structure_dirty = true;
+	structure_generation += 1;
+	dirty_elements.clear();
+}
+
+void HitTestGrid::DirtyElement(Element* element)
+{
+	// Everything is rebuilt anyway when the structure is dirty. Stop recording once it is cheaper to rebuild the grid.
+	if (!structure_dirty && dirty_elements.size() <= entries.size())
+		dirty_elements.push_back(element);
+}
+
+bool HitTestGrid::Update(Element* root, Vector2i dimensions)
+{
+	if (!structure_dirty)
+	{
+		if (root->stacking_context_dirty)
+			root->BuildLocalStackingContext();
+
+		if (root->stacking_context != root_stacking_context)
+			DirtyStructure();
+	}
+
+	const Vector2i new_num_cells(
+		(Math::Max(dimensions.x, 0) + cell_size - 1) / cell_size,
+		(Math::Max(dimensions.y, 0) + cell_size - 1) / cell_size
+	);
+
+	if (structure_dirty)
+	{
+		if (seen_structure_generation != structure_generation)
+		{
+			// The stacking order has changed since the last query, wait until it settles before rebuilding.
+			seen_structure_generation = structure_generation;
+			return false;
+		}
+	}
+	else if (new_num_cells == num_cells && dirty_elements.size() <= entries.size())
+	{
+		UpdateDirtyElements();
+		return true;
+	}
+
+	num_cells = new_num_cells;
+	Build(root);
+
+	return true;
+}
+
+void HitTestGrid::Build(Element* root)
+{
+	RMLUI_ZoneScoped;
+
+	structure_dirty = false;
+	dirty_elements.clear();
+
+	entries.clear();
+	entry_indices.clear();
+
+	cells.resize(num_cells.x * num_cells.y);
+	for (Vector<int>& cell : cells)
+		cell.clear();
+
+	AddElement(root);
+	root_stacking_context = root->stacking_context;
+
+	for (int i = 0; i < (int)entries.size(); i++)
+	{
+		UpdateEntry(entries[i]);
+		InsertIntoCells(i);
+	}
+}
+
+void HitTestGrid::AddElement(Element* element)
+{
+	// Traverse the elements in the same order as they are rendered, see Element::Render().
+	entry_indices[element] = (int)entries.size();
+	entries.push_back(Entry{ element, false, false, Vector2i(0), Vector2i(0), Rect{ Vector2f(0), Vector2f(0) } });
+
+	if (element->local_stacking_context)
+	{
+		if (element->stacking_context_dirty)
+			element->BuildLocalStackingContext();
+
+		for (Element* child : element->stacking_context)
+			AddElement(child);
+	}
+}
+
+void HitTestGrid::UpdateDirtyElements()
+{
+	if (dirty_elements.empty())
+		return;
+
+	RMLUI_ZoneScoped;
+
+	// Elements not in the grid are outside the stacking order, their pointers are only dereferenced when found.
+	dirty_entries.clear();
+	for (Element* element : dirty_elements)
+	{
+		auto it = entry_indices.find(element);
+		if (it != entry_indices.end())
+			dirty_entries.push_back(it->second);
+	}
+	dirty_elements.clear();
+
+	std::sort(dirty_entries.begin(), dirty_entries.end());
+	dirty_entries.erase(std::unique(dirty_entries.begin(), dirty_entries.end()), dirty_entries.end());
+
+	for (int entry_index : dirty_entries)
+	{
+		RemoveFromCells(entry_index);
+		UpdateEntry(entries[entry_index]);
+		InsertIntoCells(entry_index);
+	}
+}
+
+void HitTestGrid::UpdateEntry(Entry& entry) const
+{
+	Element* element = entry.element;
+
+	entry.transformed = false;
+	entry.in_cells = false;
+
+	if (element->GetComputedValues().pointer_events == Style::PointerEvents::None)
+		return;
+
+	if (IsTransformed(element))
+	{
+		// Transformed elements are tested by projecting the point onto the element, place them in every cell.
+		entry.transformed = true;
+		entry.rect = Rect{ Vector2f(-FLT_MAX), Vector2f(FLT_MAX) };
+	}
+	else
+	{
+		const Vector2f position = element->GetAbsoluteOffset(Box::BORDER);
+		Rect rect = { Vector2f(FLT_MAX), Vector2f(-FLT_MAX) };
+
+		for (int i = 0; i < element->GetNumBoxes(); i++)
+		{
+			Vector2f box_offset;
+			const Box& box = element->GetBox(i, box_offset);
+			const Vector2f box_position = position + box_offset;
+			const Vector2f box_dimensions = box.GetSize(Box::BORDER);
+
+			rect.top_left = Vector2f(Math::Min(rect.top_left.x, box_position.x), Math::Min(rect.top_left.y, box_position.y));
+			rect.bottom_right = Vector2f(Math::Max(rect.bottom_right.x, box_position.x + box_dimensions.x),
+				Math::Max(rect.bottom_right.y, box_position.y + box_dimensions.y));
+		}
+
+		Vector2i clip_origin, clip_dimensions;
+		if (ElementUtilities::GetClippingRegion(clip_origin, clip_dimensions, element))
+		{
+			rect.top_left = Vector2f(Math::Max(rect.top_left.x, float(clip_origin.x)), Math::Max(rect.top_left.y, float(clip_origin.y)));
+			rect.bottom_right = Vector2f(Math::Min(rect.bottom_right.x, float(clip_origin.x + clip_dimensions.x)),
+				Math::Min(rect.bottom_right.y, float(clip_origin.y + clip_dimensions.y)));
+		}
+
+		// Elements clipped out of view can never be hit.
+		if (!(rect.top_left.x <= rect.bottom_right.x && rect.top_left.y <= rect.bottom_right.y))
+			return;
+
+		entry.rect = rect;
+	}
+
+	entry.in_cells = GetCellRange(entry.rect, entry.cell_min, entry.cell_max);
+}
+
+void HitTestGrid::InsertIntoCells(int entry_index)
+{
+	const Entry& entry = entries[entry_index];
+	if (!entry.in_cells)
+		return;
+
+	for (int y = entry.cell_min.y; y <= entry.cell_max.y; y++)
+	{
+		for (int x = entry.cell_min.x; x <= entry.cell_max.x; x++)
+		{
+			Vector<int>& cell = cells[y * num_cells.x + x];
+			cell.insert(std::upper_bound(cell.begin(), cell.end(), entry_index), entry_index);
+		}
+	}
+}
+
+void HitTestGrid::RemoveFromCells(int entry_index)
+{
+	const Entry& entry = entries[entry_index];
+	if (!entry.in_cells)
+		return;
+
+	for (int y = entry.cell_min.y; y <= entry.cell_max.y; y++)
+	{
+		for (int x = entry.cell_min.x; x <= entry.cell_max.x; x++)
+		{
+			Vector<int>& cell = cells[y * num_cells.x + x];
+			auto it = std::lower_bound(cell.begin(), cell.end(), entry_index);
+			if (it != cell.end() && *it == entry_index)
+				cell.erase(it);
+		}
+	}
+}
+
+bool HitTestGrid::GetCellRange(const Rect& rect, Vector2i& cell_min, Vector2i& cell_max) const
+{
+	const Vector2f grid_size = Vector2f(num_cells * cell_size);
+
+	if (rect.bottom_right.x < 0.f || rect.bottom_right.y < 0.f || rect.top_left.x >= grid_size.x || rect.top_left.y >= grid_size.y)
+		return false;
+
+	cell_min = Vector2i(
+		int(Math::Max(rect.top_left.x, 0.f)) / cell_size,
+		int(Math::Max(rect.top_left.y, 0.f)) / cell_size
+	);
+	cell_max = Vector2i(
+		Math::Min(int(Math::Min(rect.bottom_right.x, grid_size.x)) / cell_size, num_cells.x - 1),
+		Math::Min(int(Math::Min(rect.bottom_right.y, grid_size.y)) / cell_size, num_cells.y - 1)
+	);
+
+	return true;
+}
+
+bool HitTestGrid::GetElementAtPoint(Vector2f point, const Element* ignore_element, Element*& result) const
+{
+	result = nullptr;
+
+	const Vector2f grid_size = Vector2f(num_cells * cell_size);
+	if (!(point.x >= 0.f && point.y >= 0.f && point.x < grid_size.x && point.y < grid_size.y))
+		return false;
+
+	const Vector<int>& cell = cells[int(point.y) / cell_size * num_cells.x + int(point.x) / cell_size];
+
+	// Test candidates from the top-most element and down.
+	for (auto it = cell.rbegin(); it != cell.rend(); ++it)
+	{
+		const Entry& entry = entries[*it];
+		Element* element = entry.element;
+
+		if (!entry.transformed &&
+			(point.x < entry.rect.top_left.x || point.y < entry.rect.top_left.y || point.x > entry.rect.bottom_right.x ||
+				point.y > entry.rect.bottom_right.y))
+			continue;
+
+		if (ignore_element)
+		{
+			const Element* ancestor = element;
+			while (ancestor && ancestor != ignore_element)
+				ancestor = ancestor->GetParentNode();
+
+			if (ancestor)
+				continue;
+		}
+
+		// The rectangle of non-transformed elements already includes the clipping region.
+		if (entry.transformed)
+		{
+			Vector2f projected_point = point;
+			if (element->Project(projected_point) && element->IsPointWithinElement(projected_point) &&
+				IsPointWithinClippingRegion(projected_point, element))
+			{
+				result = element;
+				return true;
+			}
+		}
+		else if (element->IsPointWithinElement(point))
+		{
+			result = element;
+			return true;
+		}
+	}
+
+	return true;
+}
+
+} // namespace Rml
@@ -0,0 +1,118 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_HITTESTGRID_H
+#define RMLUI_CORE_HITTESTGRID_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	A uniform grid over the screen-space border boxes of all elements in a context, used to accelerate hit testing.
+
+	Elements are stored in their stacking order, each grid cell lists the elements which may cover it. Transformed elements
+	are placed in every cell, and all candidates are tested precisely, thus the results are identical to a full search of
+	the stacking contexts.
+
+	Each context owns its own grid. Changes to individual elements only move them between the affected cells, while changes
+	to the stacking order require the grid to be rebuilt.
+ */
+
+class HitTestGrid : NonCopyMoveable {
+public:
+	/// Marks the stacking order as changed, such as when elements are added, removed, or re-ordered. The grid is then rebuilt
+	/// once the tree has settled.
+	void DirtyStructure();
+	/// Marks the position, size, clipping region, transform, or hit testing properties of the element as changed. The element
+	/// is moved to its new cells during the next update.
+	void DirtyElement(Element* element);
+
+	/// Makes sure the grid is up-to-date with the element tree. To avoid rebuilding the grid for every query while the
+	/// stacking order is changing, it is only rebuilt once the stacking order has been unchanged since the last call.
+	/// @param[in] root The root element of the context.
+	/// @param[in] dimensions The dimensions of the context.
+	/// @return True if the grid can be used for queries.
+	bool Update(Element* root, Vector2i dimensions);
+
+	/// Finds the top-most element at the given point.
+	/// @param[in] point The point to test, in screen coordinates.
+	/// @param[in] ignore_element If set, this element and its descendants will be ignored.
+	/// @param[out] result The element found at the point, or nullptr if none.
+	/// @return False if the point lies outside the grid, in which case a full search must be performed instead.
+	bool GetElementAtPoint(Vector2f point, const Element* ignore_element, Element*& result) const;
+
+private:
+	static constexpr int cell_size = 64;
+
+	struct Rect {
+		Vector2f top_left, bottom_right;
+	};
+	struct Entry {
+		Element* element;
+		bool transformed;
+		// The element is listed in the cells [cell_min, cell_max] when set, otherwise it cannot be hit.
+		bool in_cells;
+		Vector2i cell_min, cell_max;
+		Rect rect;
+	};
+
+	void Build(Element* root);
+	void AddElement(Element* element);
+	void UpdateDirtyElements();
+
+	void UpdateEntry(Entry& entry) const;
+	void InsertIntoCells(int entry_index);
+	void RemoveFromCells(int entry_index);
+	bool GetCellRange(const Rect& rect, Vector2i& cell_min, Vector2i& cell_max) const;
+
+	bool structure_dirty = true;
+	uint64_t structure_generation = 0;
+	uint64_t seen_structure_generation = uint64_t(-1);
+
+	Vector2i num_cells;
+
+	// Elements in stacking order, bottom-most first. Includes elements which cannot be hit, so that they can be looked up when changed.
+	Vector<Entry> entries;
+	UnorderedMap<Element*, int> entry_indices;
+
+	// Indices into 'entries' for each cell in increasing order.
+	Vector<Vector<int>> cells;
+
+	// Elements changed since the last update. Holds more elements than there are entries when the grid should rather be rebuilt.
+	Vector<Element*> dirty_elements;
+	Vector<int> dirty_entries;
+
+	// The documents are children of the root element which has no context, thus changes to their order are detected by comparison.
+	ElementList root_stacking_context;
+};
+
+} // namespace Rml
+#endif
@@ -40,6 +40,9 @@ class IdNameMap {
 	Vector<String> name_map;  // IDs are indices into the name_map
 	UnorderedMap<String, ID> reverse_map;
 
+	using PredefinedLookup = ID (*)(const String& name);
+	PredefinedLookup predefined_lookup = nullptr;
+
 protected:
 	IdNameMap(size_t num_ids_to_reserve) {
 		static_assert((int)ID::Invalid == 0, "Invalid id must be zero");
@@ -66,8 +69,19 @@ public:
 		return cnt == (std::ptrdiff_t)number_of_defined_ids && reverse_map.size() == (size_t)number_of_defined_ids;
 	}
 
+	/// Sets a lookup of the predefined names which is tried before the map, see 'PropertyNameTable.h'.
+	void SetPredefinedLookup(PredefinedLookup lookup) { predefined_lookup = lookup; }
+
 	ID GetId(const String& name) const
 	{
+		if (predefined_lookup)
+		{
+			// Custom ids can't reuse predefined names, thus the map only needs to be searched when there are custom ids.
+			const ID id = predefined_lookup(name);
+			if (id != ID::Invalid || name_map.size() <= (size_t)ID::FirstCustomId)
+				return id;
+		}
+
 		auto it = reverse_map.find(name);
 		if (it != reverse_map.end())
 			return it->second;
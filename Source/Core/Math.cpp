@@ -31,6 +31,7 @@
 #include <time.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 namespace Rml {
 
@@ -230,6 +231,88 @@ RMLUICORE_API int HexToDecimal(char hex_digit)
 	return -1;
 }
 
+// Converts a floating-point value to IEEE 754 half-precision.
+RMLUICORE_API uint16_t FloatToHalf(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	const uint32_t sign = (bits >> 16) & 0x8000;
+	const uint32_t abs_bits = bits & 0x7FFFFFFF;
+
+	// Infinity and NaN, keep NaNs as quiet NaNs.
+	if (abs_bits >= 0x7F800000)
+		return uint16_t(sign | 0x7C00 | (abs_bits > 0x7F800000 ? 0x200 : 0));
+
+	// Too large for half-precision, this includes values that round up to infinity.
+	if (abs_bits >= 0x477FF000)
+		return uint16_t(sign | 0x7C00);
+
+	// Subnormal half-precision values.
+	if (abs_bits < 0x38800000)
+	{
+		if (abs_bits < 0x33000000)
+			return uint16_t(sign);
+
+		const uint32_t exponent = abs_bits >> 23;
+		const uint32_t mantissa = (abs_bits & 0x7FFFFF) | 0x800000;
+		const uint32_t shift = 126 - exponent;
+
+		uint32_t result = mantissa >> shift;
+		const uint32_t remainder = mantissa & ((1u << shift) - 1);
+		const uint32_t halfway = 1u << (shift - 1);
+		if (remainder > halfway || (remainder == halfway && (result & 1)))
+			result += 1;
+
+		return uint16_t(sign | result);
+	}
+
+	// Normal values, rebias the exponent and round the mantissa to nearest even. Rounding may carry into the exponent as intended.
+	uint32_t result = (abs_bits - 0x38000000) >> 13;
+	const uint32_t remainder = abs_bits & 0x1FFF;
+	if (remainder > 0x1000 || (remainder == 0x1000 && (result & 1)))
+		result += 1;
+
+	return uint16_t(sign | result);
+}
+
+// Converts an IEEE 754 half-precision value to a floating-point value.
+RMLUICORE_API float HalfToFloat(uint16_t value)
+{
+	const uint32_t sign = uint32_t(value & 0x8000) << 16;
+	const uint32_t exponent = (value >> 10) & 0x1F;
+	uint32_t mantissa = value & 0x3FF;
+
+	uint32_t bits;
+	if (exponent == 0x1F)
+	{
+		bits = sign | 0x7F800000 | (mantissa << 13);
+	}
+	else if (exponent != 0)
+	{
+		bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+	else if (mantissa == 0)
+	{
+		bits = sign;
+	}
+	else
+	{
+		// Subnormal, normalize the mantissa.
+		uint32_t normalized_exponent = 113;
+		while (!(mantissa & 0x400))
+		{
+			mantissa <<= 1;
+			normalized_exponent -= 1;
+		}
+		bits = sign | (normalized_exponent << 23) | ((mantissa & 0x3FF) << 13);
+	}
+
+	float result;
+	memcpy(&result, &bits, sizeof(result));
+	return result;
+}
+
 // Generates a random floating-point value between 0 and a user-specified value.
 RMLUICORE_API float RandomReal(float max_value)
 {
@@ -0,0 +1,228 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ProfileRecorder.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <string.h>
+#include <thread>
+
+namespace Rml {
+
+std::atomic<bool> ProfileRecorder::enabled(false);
+
+struct RecordedZone {
+	const char* name;
+	String text;
+	std::thread::id thread;
+	int64_t begin;
+	int64_t end;
+};
+
+// Recorded zones with the same name and parent merged together.
+struct MergedZone {
+	const char* name;
+	int calls;
+	int64_t total_time;
+	int64_t children_time;
+	Vector<MergedZone> children;
+};
+
+static std::mutex zones_mutex;
+static Vector<RecordedZone> zones;
+
+static void AppendJsonString(String& out, const String& value)
+{
+	out += '"';
+	for (char c : value)
+	{
+		if (c == '"' || c == '\\')
+		{
+			out += '\\';
+			out += c;
+		}
+		else if ((unsigned char)c < 0x20)
+			out += CreateString(8, "\\u%04x", (unsigned int)c);
+		else
+			out += c;
+	}
+	out += '"';
+}
+
+static String FormatMilliseconds(int64_t nanoseconds)
+{
+	return CreateString(32, "%.3f", double(nanoseconds) * 1.0e-6);
+}
+
+static void AppendMergedZones(String& out, const Vector<MergedZone>& merged_zones, const String& indent)
+{
+	for (size_t i = 0; i < merged_zones.size(); i++)
+	{
+		const MergedZone& zone = merged_zones[i];
+		out += indent + "{\"name\": ";
+		AppendJsonString(out, zone.name);
+		out += CreateString(32, ", \"calls\": %d", zone.calls);
+		out += ", \"total_ms\": " + FormatMilliseconds(zone.total_time);
+		out += ", \"self_ms\": " + FormatMilliseconds(std::max(zone.total_time - zone.children_time, int64_t(0)));
+		out += ", \"children\": [";
+		if (!zone.children.empty())
+		{
+			out += '\n';
+			AppendMergedZones(out, zone.children, indent + '\t');
+			out += indent;
+		}
+		out += "]}";
+		out += (i + 1 < merged_zones.size() ? ",\n" : "\n");
+	}
+}
+
+void ProfileRecorder::SetEnabled(bool enable)
+{
+	enabled.store(enable, std::memory_order_relaxed);
+}
+
+void ProfileRecorder::Clear()
+{
+	std::lock_guard<std::mutex> lock(zones_mutex);
+	zones.clear();
+}
+
+int64_t ProfileRecorder::GetTime()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void ProfileRecorder::AddZone(const char* name, String&& text, int64_t begin, int64_t end)
+{
+	std::lock_guard<std::mutex> lock(zones_mutex);
+	zones.push_back(RecordedZone{name, std::move(text), std::this_thread::get_id(), begin, end});
+}
+
+String ProfileRecorder::GetRecording(ProfileRecordingFormat format)
+{
+	Vector<RecordedZone> recorded_zones;
+	{
+		std::lock_guard<std::mutex> lock(zones_mutex);
+		recorded_zones = zones;
+	}
+
+	// Number the threads in the order they started recording, so that the thread recording first is listed first.
+	std::sort(recorded_zones.begin(), recorded_zones.end(), [](const RecordedZone& a, const RecordedZone& b) { return a.begin < b.begin; });
+
+	Vector<std::thread::id> threads;
+	Vector<int> zone_threads(recorded_zones.size());
+	for (size_t i = 0; i < recorded_zones.size(); i++)
+	{
+		auto it = std::find(threads.begin(), threads.end(), recorded_zones[i].thread);
+		zone_threads[i] = int(it - threads.begin());
+		if (it == threads.end())
+			threads.push_back(recorded_zones[i].thread);
+	}
+
+	// Order the zones of each thread such that parents come before their children.
+	Vector<int> order(recorded_zones.size());
+	for (size_t i = 0; i < order.size(); i++)
+		order[i] = int(i);
+	std::sort(order.begin(), order.end(), [&](int a, int b) {
+		if (zone_threads[a] != zone_threads[b])
+			return zone_threads[a] < zone_threads[b];
+		if (recorded_zones[a].begin != recorded_zones[b].begin)
+			return recorded_zones[a].begin < recorded_zones[b].begin;
+		return recorded_zones[a].end > recorded_zones[b].end;
+	});
+
+	const int64_t start_time = (recorded_zones.empty() ? 0 : recorded_zones.front().begin);
+
+	String out;
+
+	if (format == ProfileRecordingFormat::ChromeTrace)
+	{
+		out += "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+		for (size_t i = 0; i < order.size(); i++)
+		{
+			const RecordedZone& zone = recorded_zones[order[i]];
+			out += "{\"name\": ";
+			AppendJsonString(out, zone.name);
+			out += CreateString(64, ", \"cat\": \"RmlUi\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d", zone_threads[order[i]]);
+			out += CreateString(64, ", \"ts\": %.3f, \"dur\": %.3f", double(zone.begin - start_time) * 1.0e-3, double(zone.end - zone.begin) * 1.0e-3);
+			if (!zone.text.empty())
+			{
+				out += ", \"args\": {\"text\": ";
+				AppendJsonString(out, zone.text);
+				out += '}';
+			}
+			out += (i + 1 < order.size() ? "},\n" : "}\n");
+		}
+		out += "]}\n";
+		return out;
+	}
+
+	out += "{\"threads\": [\n";
+
+	size_t zone_index = 0;
+	for (int thread = 0; thread < (int)threads.size(); thread++)
+	{
+		MergedZone root = {"", 0, 0, 0, {}};
+
+		// The path from the root to the current zone, along with the end time of the recorded zones along the path.
+		Vector<std::pair<MergedZone*, int64_t>> stack = {{&root, std::numeric_limits<int64_t>::max()}};
+
+		for (; zone_index < order.size() && zone_threads[order[zone_index]] == thread; zone_index++)
+		{
+			const RecordedZone& zone = recorded_zones[order[zone_index]];
+			while (zone.end > stack.back().second)
+				stack.pop_back();
+
+			MergedZone& parent = *stack.back().first;
+			auto it = std::find_if(parent.children.begin(), parent.children.end(),
+				[&](const MergedZone& child) { return strcmp(child.name, zone.name) == 0; });
+			if (it == parent.children.end())
+				it = parent.children.insert(parent.children.end(), MergedZone{zone.name, 0, 0, 0, {}});
+
+			const int64_t duration = zone.end - zone.begin;
+			it->calls += 1;
+			it->total_time += duration;
+			parent.children_time += duration;
+
+			stack.emplace_back(&*it, zone.end);
+		}
+
+		out += CreateString(64, "\t{\"thread\": %d, \"zones\": [\n", thread);
+		AppendMergedZones(out, root.children, "\t\t");
+		out += (thread + 1 < (int)threads.size() ? "\t]},\n" : "\t]}\n");
+	}
+
+	out += "]}\n";
+
+	return out;
+}
+
+} // namespace Rml
@@ -0,0 +1,106 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_PROFILERECORDER_H
+#define RMLUI_CORE_PROFILERECORDER_H
+
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <atomic>
+
+namespace Rml {
+
+/**
+	Records the time spent in named zones while enabled, independently of any external profiler. Zones are only placed
+	around coarse stages of initialisation and document loading, thus the recorder is cheap enough to be compiled in
+	unconditionally: A disabled zone only loads a single flag.
+
+	Zones may be recorded from any thread. Nesting is reconstructed from the recorded time ranges of each thread.
+ */
+
+class ProfileRecorder : NonCopyMoveable {
+public:
+	static void SetEnabled(bool enable);
+	static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+	/// Discards all recorded zones.
+	static void Clear();
+
+	/// Returns the recorded zones in the given format.
+	static String GetRecording(ProfileRecordingFormat format);
+
+	/// Returns the current time in nanoseconds, on the clock used for recording zones.
+	static int64_t GetTime();
+
+	/// Adds a completed zone to the recording.
+	/// @param[in] name The name of the zone, must be a string literal.
+	/// @param[in] text Additional text describing this particular instance of the zone, such as a file name.
+	/// @param[in] begin The time the zone began, as given by GetTime().
+	/// @param[in] end The time the zone ended, as given by GetTime().
+	static void AddZone(const char* name, String&& text, int64_t begin, int64_t end);
+
+private:
+	static std::atomic<bool> enabled;
+};
+
+/**
+	Records the lifetime of this object as a zone, if the recorder was enabled when it was constructed.
+ */
+
+class ProfileRecorderZone : NonCopyMoveable {
+public:
+	explicit ProfileRecorderZone(const char* name) : name(ProfileRecorder::IsEnabled() ? name : nullptr)
+	{
+		if (this->name)
+			begin = ProfileRecorder::GetTime();
+	}
+	~ProfileRecorderZone()
+	{
+		if (name)
+			ProfileRecorder::AddZone(name, std::move(text), begin, ProfileRecorder::GetTime());
+	}
+
+	/// Sets the text of the zone, ignored if the zone is not being recorded.
+	void SetText(const String& in_text)
+	{
+		if (name)
+			text = in_text;
+	}
+
+private:
+	const char* name;
+	int64_t begin = 0;
+	String text;
+};
+
+} // namespace Rml
+
+#define RMLUI_RecordZone(name)     ::Rml::ProfileRecorderZone rmlui_record_zone(name)
+#define RMLUI_RecordZoneText(text) rmlui_record_zone.SetText(text)
+
+#endif
@@ -0,0 +1,190 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "PropertyDeclarationCache.h"
+#include "../../Include/RmlUi/Core/PropertyDictionary.h"
+#include "Utilities.h"
+
+namespace Rml {
+
+PropertyDeclarationCache::PropertyDeclarationCache(size_t capacity) : capacity(capacity)
+{
+	RMLUI_ASSERT(capacity < size_t(null_index));
+	entries.reserve(capacity);
+	entry_map.reserve(capacity);
+}
+
+PropertyDeclarationCache::~PropertyDeclarationCache()
+{
+}
+
+bool PropertyDeclarationCache::Lookup(const String& name, const String& value, PropertyDictionary& dictionary)
+{
+	const size_t hash = GetHash(name, value);
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	const uint32_t index = Find(hash, name, value);
+	if (index == null_index)
+		return false;
+
+	if (index != most_recent)
+	{
+		Unlink(index);
+		LinkFront(index);
+	}
+
+	for (const auto& property : entries[index].properties)
+		dictionary.SetProperty(property.first, property.second);
+
+	return true;
+}
+
+void PropertyDeclarationCache::Insert(const String& name, const String& value, const PropertyDictionary& properties)
+{
+	if (capacity == 0)
+		return;
+
+	for (const auto& property : properties.GetProperties())
+	{
+		if (property.second.unit == Property::DECORATOR || property.second.unit == Property::FONTEFFECT)
+			return;
+	}
+
+	const size_t hash = GetHash(name, value);
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	uint32_t index = null_index;
+
+	auto it = entry_map.find(hash);
+	if (it != entry_map.end())
+	{
+		index = it->second;
+
+		// Another thread may have parsed the same declaration in the meantime.
+		if (entries[index].name == name && entries[index].value == value)
+			return;
+
+		// Otherwise, the hash collides with a different declaration, simply replace it.
+		Unlink(index);
+	}
+	else if (entries.size() < capacity)
+	{
+		index = (uint32_t)entries.size();
+		entries.emplace_back();
+		entry_map.emplace(hash, index);
+	}
+	else
+	{
+		index = least_recent;
+		Unlink(index);
+		entry_map.erase(entries[index].hash);
+		entry_map.emplace(hash, index);
+	}
+
+	Entry& entry = entries[index];
+	entry.hash = hash;
+	entry.name = name;
+	entry.value = value;
+	entry.properties.clear();
+	for (const auto& property : properties.GetProperties())
+		entry.properties.emplace_back(property.first, property.second);
+
+	LinkFront(index);
+}
+
+void PropertyDeclarationCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	entries.clear();
+	entry_map.clear();
+	most_recent = null_index;
+	least_recent = null_index;
+}
+
+size_t PropertyDeclarationCache::GetSize()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return entry_map.size();
+}
+
+size_t PropertyDeclarationCache::GetHash(const String& name, const String& value)
+{
+	size_t hash = Hash<String>()(name);
+	Utilities::HashCombine(hash, value);
+	return hash;
+}
+
+uint32_t PropertyDeclarationCache::Find(size_t hash, const String& name, const String& value) const
+{
+	auto it = entry_map.find(hash);
+	if (it == entry_map.end())
+		return null_index;
+
+	const Entry& entry = entries[it->second];
+	if (entry.name != name || entry.value != value)
+		return null_index;
+
+	return it->second;
+}
+
+void PropertyDeclarationCache::Unlink(uint32_t index)
+{
+	Entry& entry = entries[index];
+
+	if (entry.previous != null_index)
+		entries[entry.previous].next = entry.next;
+	else
+		most_recent = entry.next;
+
+	if (entry.next != null_index)
+		entries[entry.next].previous = entry.previous;
+	else
+		least_recent = entry.previous;
+
+	entry.previous = null_index;
+	entry.next = null_index;
+}
+
+void PropertyDeclarationCache::LinkFront(uint32_t index)
+{
+	Entry& entry = entries[index];
+	entry.previous = null_index;
+	entry.next = most_recent;
+
+	if (most_recent != null_index)
+		entries[most_recent].previous = index;
+	else
+		least_recent = index;
+
+	most_recent = index;
+}
+
+} // namespace Rml
@@ -0,0 +1,100 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#ifndef RMLUI_CORE_PROPERTYDECLARATIONCACHE_H
+#define RMLUI_CORE_PROPERTYDECLARATIONCACHE_H
+
+#include "../../Include/RmlUi/Core/Property.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
+
+namespace Rml {
+
+class PropertyDictionary;
+
+/**
+	A least-recently-used cache of parsed property declarations, keyed by their name and value strings.
+
+	Scripts commonly set the same few declarations over and over, such as 'left: 12.5px' every frame, the cache lets
+	these skip the value parsers entirely. Shorthands are stored with their full expansion. May be used from multiple
+	threads.
+ */
+
+class PropertyDeclarationCache : NonCopyMoveable {
+public:
+	PropertyDeclarationCache(size_t capacity);
+	~PropertyDeclarationCache();
+
+	/// Looks up a declaration, and on a hit sets all of its parsed properties on the dictionary.
+	/// @return True if the declaration was found.
+	bool Lookup(const String& name, const String& value, PropertyDictionary& dictionary);
+
+	/// Inserts the properties parsed from a successful declaration, possibly evicting the least recently used entry.
+	/// Declarations holding instanced objects, such as decorators and font effects, are not cached.
+	void Insert(const String& name, const String& value, const PropertyDictionary& properties);
+
+	/// Removes all entries.
+	void Clear();
+
+	/// Returns the number of cached declarations.
+	size_t GetSize();
+
+private:
+	static constexpr uint32_t null_index = uint32_t(-1);
+
+	struct Entry {
+		size_t hash = 0;
+		String name;
+		String value;
+		Vector<Pair<PropertyId, Property>> properties;
+		// Neighbours in the recently used list.
+		uint32_t previous = null_index;
+		uint32_t next = null_index;
+	};
+
+	static size_t GetHash(const String& name, const String& value);
+
+	uint32_t Find(size_t hash, const String& name, const String& value) const;
+	void Unlink(uint32_t index);
+	void LinkFront(uint32_t index);
+
+	size_t capacity;
+
+	std::mutex mutex;
+
+	// Protected by the mutex. Entries are allocated once and then recycled, so that a full cache can replace its least
+	// recently used entry without any heap allocations.
+	Vector<Entry> entries;
+	UnorderedMap<size_t, uint32_t> entry_map;
+	uint32_t most_recent = null_index;
+	uint32_t least_recent = null_index;
+};
+
+} // namespace Rml
+#endif
@@ -0,0 +1,313 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "PropertyNameTable.h"
+#include <string.h>
+
+namespace Rml {
+
+// Names of the predefined properties and shorthands, indexed by their id. Must match the order of the ids in 'ID.h'.
+static constexpr const char* property_names[] = {
+	"invalid",
+	"margin-top",
+	"margin-right",
+	"margin-bottom",
+	"margin-left",
+	"padding-top",
+	"padding-right",
+	"padding-bottom",
+	"padding-left",
+	"border-top-width",
+	"border-right-width",
+	"border-bottom-width",
+	"border-left-width",
+	"border-top-color",
+	"border-right-color",
+	"border-bottom-color",
+	"border-left-color",
+	"border-top-left-radius",
+	"border-top-right-radius",
+	"border-bottom-right-radius",
+	"border-bottom-left-radius",
+	"display",
+	"position",
+	"top",
+	"right",
+	"bottom",
+	"left",
+	"float",
+	"clear",
+	"box-sizing",
+	"z-index",
+	"width",
+	"min-width",
+	"max-width",
+	"height",
+	"min-height",
+	"max-height",
+	"line-height",
+	"vertical-align",
+	"overflow-x",
+	"overflow-y",
+	"clip",
+	"visibility",
+	"background-color",
+	"color",
+	"caret-color",
+	"image-color",
+	"font-family",
+	"font-style",
+	"font-weight",
+	"font-size",
+	"text-align",
+	"text-decoration",
+	"text-transform",
+	"white-space",
+	"word-break",
+	"row-gap",
+	"column-gap",
+	"cursor",
+	"drag",
+	"tab-index",
+	"scrollbar-margin",
+	"perspective",
+	"perspective-origin-x",
+	"perspective-origin-y",
+	"transform",
+	"transform-origin-x",
+	"transform-origin-y",
+	"transform-origin-z",
+	"transition",
+	"animation",
+	"opacity",
+	"pointer-events",
+	"focus",
+	"render-cache",
+	"decorator",
+	"font-effect",
+	"fill-image",
+	"align-content",
+	"align-items",
+	"align-self",
+	"flex-basis",
+	"flex-direction",
+	"flex-grow",
+	"flex-shrink",
+	"flex-wrap",
+	"justify-content",
+};
+static constexpr const char* shorthand_names[] = {
+	"invalid",
+	"margin",
+	"padding",
+	"border-width",
+	"border-color",
+	"border-top",
+	"border-right",
+	"border-bottom",
+	"border-left",
+	"border",
+	"border-radius",
+	"overflow",
+	"background",
+	"font",
+	"gap",
+	"perspective-origin",
+	"transform-origin",
+	"flex",
+	"flex-flow",
+};
+
+static_assert(sizeof(property_names) / sizeof(property_names[0]) == (size_t)PropertyId::NumDefinedIds, "Property name missing for predefined id.");
+static_assert(sizeof(shorthand_names) / sizeof(shorthand_names[0]) == (size_t)ShorthandId::NumDefinedIds, "Shorthand name missing for predefined id.");
+
+static constexpr size_t ConstexprLength(const char* str)
+{
+	size_t length = 0;
+	while (str[length])
+		length += 1;
+	return length;
+}
+
+// Reads up to eight characters as a little-endian integer.
+static constexpr uint64_t ReadWord(const char* str, size_t length)
+{
+	uint64_t word = 0;
+	for (size_t i = 0; i < length && i < 8; i++)
+		word |= uint64_t((unsigned char)str[i]) << (8 * i);
+	return word;
+}
+
+// Names are identified by their length and their first and last eight characters, which are enough to tell all the
+// predefined names apart. Together they cover all the characters of names up to sixteen characters long.
+struct NameKey {
+	uint64_t head;
+	uint64_t tail;
+	size_t length;
+};
+
+static constexpr NameKey MakeKey(const char* str, size_t length)
+{
+	return NameKey{ReadWord(str, length), length > 8 ? ReadWord(str + length - 8, 8) : 0, length};
+}
+
+static constexpr uint32_t HashKey(const NameKey& key, uint32_t seed)
+{
+	uint64_t hash = key.head * 0x9e3779b97f4a7c15ull + key.tail + key.length + uint64_t(seed) * 0xc2b2ae3d27d4eb4full;
+
+	// Finalizer from MurmurHash3.
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdull;
+	hash ^= hash >> 33;
+	return uint32_t(hash);
+}
+
+/*
+	A perfect hash table over a fixed set of names, mapping every name to a unique slot holding its id. The seed is
+	searched for at compile time, until one is found where no names collide.
+*/
+template <size_t TableSize, size_t NumNames>
+struct PerfectHashTable {
+	static_assert((TableSize & (TableSize - 1)) == 0, "Table size must be a power of two.");
+	static_assert(NumNames <= 256, "Ids must fit in a byte.");
+
+	bool valid;
+	uint32_t seed;
+	// Id of the name in each slot, zero for empty slots as the invalid id is never stored.
+	uint8_t slots[TableSize];
+	// Keys of the names, indexed by their id.
+	NameKey keys[NumNames];
+
+	static constexpr uint32_t GetSlot(uint32_t hash) { return hash & uint32_t(TableSize - 1); }
+};
+
+template <size_t TableSize, size_t NumNames>
+static constexpr PerfectHashTable<TableSize, NumNames> BuildPerfectHashTable(const char* const (&names)[NumNames])
+{
+	constexpr uint32_t max_num_seeds = 1000;
+	for (uint32_t seed = 0; seed < max_num_seeds; seed++)
+	{
+		PerfectHashTable<TableSize, NumNames> table = {};
+		table.valid = true;
+		table.seed = seed;
+
+		for (size_t id = 1; id < NumNames && table.valid; id++)
+		{
+			table.keys[id] = MakeKey(names[id], ConstexprLength(names[id]));
+
+			const uint32_t slot = table.GetSlot(HashKey(table.keys[id], seed));
+			if (table.slots[slot] != 0)
+				table.valid = false;
+			else
+				table.slots[slot] = (uint8_t)id;
+		}
+
+		if (table.valid)
+			return table;
+	}
+
+	return PerfectHashTable<TableSize, NumNames>{};
+}
+
+static constexpr auto property_table = BuildPerfectHashTable<1024>(property_names);
+static constexpr auto shorthand_table = BuildPerfectHashTable<128>(shorthand_names);
+
+static_assert(property_table.valid, "No perfect hash found for the property names, increase the table size.");
+static_assert(shorthand_table.valid, "No perfect hash found for the shorthand names, increase the table size.");
+
+// Reads eight characters, with the same result as ReadWord().
+static inline uint64_t LoadWord(const char* str)
+{
+	uint64_t word;
+	memcpy(&word, str, sizeof(word));
+
+	// Resolved at compile time, big-endian platforms fall back to reading the characters one by one.
+	const uint16_t byte_order = 1;
+	if (*(const unsigned char*)&byte_order != 1)
+		word = ReadWord(str, 8);
+
+	return word;
+}
+
+template <size_t TableSize, size_t NumNames>
+static inline size_t Find(const PerfectHashTable<TableSize, NumNames>& table, const char* const (&names)[NumNames], const String& name)
+{
+	const char* str = name.data();
+	const size_t length = name.size();
+
+	NameKey key = {};
+	key.length = length;
+	if (length >= 8)
+	{
+		key.head = LoadWord(str);
+		key.tail = (length > 8 ? LoadWord(str + length - 8) : 0);
+	}
+	else
+	{
+		key.head = ReadWord(str, length);
+	}
+
+	// The slot may be empty or belong to another name.
+	const uint8_t id = table.slots[table.GetSlot(HashKey(key, table.seed))];
+	const NameKey& candidate = table.keys[id];
+	if (id == 0 || candidate.length != key.length || candidate.head != key.head || candidate.tail != key.tail)
+		return 0;
+
+	// Only the middle of long names remains to be compared.
+	if (length > 16 && memcmp(names[id] + 8, str + 8, length - 16) != 0)
+		return 0;
+
+	return id;
+}
+
+PropertyId GetPredefinedPropertyId(const String& name)
+{
+	return (PropertyId)Find(property_table, property_names, name);
+}
+
+ShorthandId GetPredefinedShorthandId(const String& name)
+{
+	return (ShorthandId)Find(shorthand_table, shorthand_names, name);
+}
+
+const char* GetPredefinedPropertyName(PropertyId id)
+{
+	if (id == PropertyId::Invalid || id >= PropertyId::NumDefinedIds)
+		return nullptr;
+	return property_names[(size_t)id];
+}
+
+const char* GetPredefinedShorthandName(ShorthandId id)
+{
+	if (id == ShorthandId::Invalid || id >= ShorthandId::NumDefinedIds)
+		return nullptr;
+	return shorthand_names[(size_t)id];
+}
+
+} // namespace Rml
@@ -0,0 +1,54 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#ifndef RMLUI_CORE_PROPERTYNAMETABLE_H
+#define RMLUI_CORE_PROPERTYNAMETABLE_H
+
+#include "../../Include/RmlUi/Core/ID.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/*
+	Lookup of the predefined property and shorthand names of the style sheet specification. The names are found through
+	perfect hash tables generated at compile time, instead of hashing into the runtime name maps.
+*/
+
+/// Returns the predefined property with the given name, or PropertyId::Invalid if the name is not predefined.
+PropertyId GetPredefinedPropertyId(const String& name);
+/// Returns the predefined shorthand with the given name, or ShorthandId::Invalid if the name is not predefined.
+ShorthandId GetPredefinedShorthandId(const String& name);
+
+/// Returns the name of the given predefined property, or nullptr if the id is not predefined.
+const char* GetPredefinedPropertyName(PropertyId id);
+/// Returns the name of the given predefined shorthand, or nullptr if the id is not predefined.
+const char* GetPredefinedShorthandName(ShorthandId id);
+
+} // namespace Rml
+#endif
@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "PropertyDeclarationCache.h"
 #include "PropertyShorthandDefinition.h"
 #include "IdNameMap.h"
 #include <limits.h>
@@ -226,6 +227,35 @@ bool PropertySpecification::ParsePropertyDeclaration(PropertyDictionary& diction
 {
 	RMLUI_ZoneScoped;
 
+	if (!declaration_cache)
+		return ParseDeclaration(dictionary, property_name, property_value);
+
+	if (declaration_cache->Lookup(property_name, property_value, dictionary))
+		return true;
+
+	// Parse into an empty dictionary so that we know exactly which properties the declaration expands to.
+	if (dictionary.GetNumProperties() == 0)
+	{
+		const bool result = ParseDeclaration(dictionary, property_name, property_value);
+		if (result)
+			declaration_cache->Insert(property_name, property_value, dictionary);
+		return result;
+	}
+
+	PropertyDictionary parsed_properties;
+	const bool result = ParseDeclaration(parsed_properties, property_name, property_value);
+	if (result)
+		declaration_cache->Insert(property_name, property_value, parsed_properties);
+
+	// Shorthands may set some of their properties even if they fail, pass them on as if parsed directly.
+	for (const auto& property : parsed_properties.GetProperties())
+		dictionary.SetProperty(property.first, property.second);
+
+	return result;
+}
+
+bool PropertySpecification::ParseDeclaration(PropertyDictionary& dictionary, const String& property_name, const String& property_value) const
+{
 	// Try as a property first
 	PropertyId property_id = property_map->GetId(property_name);
 	if (property_id != PropertyId::Invalid)
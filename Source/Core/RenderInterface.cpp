@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -46,6 +47,44 @@ RenderInterface::~RenderInterface()
 		"destroyed and a subsequent call has been made to Rml::ReleaseTextures before the render interface is destroyed.");
 }
 
+// Called by RmlUi to determine whether uncompiled geometry should be rendered in compact form.
+bool RenderInterface::SupportsCompactGeometry()
+{
+	return false;
+}
+
+// Called by RmlUi when it wants to render textured geometry in compact form.
+void RenderInterface::RenderCompactGeometry(const CompactVertex* compact_vertices, int num_vertices, const uint16_t* compact_indices, int num_indices,
+	TextureHandle texture, const Vector2f& translation)
+{
+	expanded_vertices.resize(num_vertices);
+	for (int i = 0; i < num_vertices; i++)
+	{
+		expanded_vertices[i].position = compact_vertices[i].position;
+		expanded_vertices[i].colour = compact_vertices[i].colour;
+		expanded_vertices[i].tex_coord = Vector2f(Math::HalfToFloat(compact_vertices[i].tex_coord[0]), Math::HalfToFloat(compact_vertices[i].tex_coord[1]));
+	}
+
+	expanded_indices.assign(compact_indices, compact_indices + num_indices);
+	RenderGeometry(expanded_vertices.data(), num_vertices, expanded_indices.data(), num_indices, texture, translation);
+}
+
+// Called by RmlUi when it wants to render untextured geometry in compact form.
+void RenderInterface::RenderUntexturedGeometry(const UntexturedVertex* compact_vertices, int num_vertices, const uint16_t* compact_indices,
+	int num_indices, const Vector2f& translation)
+{
+	expanded_vertices.resize(num_vertices);
+	for (int i = 0; i < num_vertices; i++)
+	{
+		expanded_vertices[i].position = compact_vertices[i].position;
+		expanded_vertices[i].colour = compact_vertices[i].colour;
+		expanded_vertices[i].tex_coord = Vector2f(0, 0);
+	}
+
+	expanded_indices.assign(compact_indices, compact_indices + num_indices);
+	RenderGeometry(expanded_vertices.data(), num_vertices, expanded_indices.data(), num_indices, 0, translation);
+}
+
 // Called by RmlUi when it wants to compile geometry it believes will be static for the forseeable future.
 CompiledGeometryHandle RenderInterface::CompileGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/)
 {
@@ -62,6 +101,29 @@ void RenderInterface::ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*
 {
 }
 
+// Called by RmlUi when it wants to create a persistent buffer for storing geometry.
+bool RenderInterface::CreateGeometryBuffer(GeometryBufferHandle& /*buffer*/, int /*vertex_capacity*/, int /*index_capacity*/)
+{
+	return false;
+}
+
+// Called by RmlUi when it wants to write to a range of vertices and indices in a geometry buffer.
+void RenderInterface::UpdateGeometryBuffer(GeometryBufferHandle /*buffer*/, int /*vertex_offset*/, const Vertex* /*vertices*/, int /*num_vertices*/,
+	int /*index_offset*/, const int* /*indices*/, int /*num_indices*/)
+{
+}
+
+// Called by RmlUi when it wants to render a range of geometry from a geometry buffer.
+void RenderInterface::RenderGeometryBuffer(GeometryBufferHandle /*buffer*/, int /*base_vertex*/, int /*index_offset*/, int /*num_indices*/,
+	TextureHandle /*texture*/, const Vector2f& /*translation*/)
+{
+}
+
+// Called by RmlUi when it wants to release a geometry buffer.
+void RenderInterface::ReleaseGeometryBuffer(GeometryBufferHandle /*buffer*/)
+{
+}
+
 // Called by RmlUi when a texture is required by the library.
 bool RenderInterface::LoadTexture(TextureHandle& /*texture_handle*/, Vector2i& /*texture_dimensions*/, const String& /*source*/)
 {
@@ -74,11 +136,34 @@ bool RenderInterface::GenerateTexture(TextureHandle& /*texture_handle*/, const b
 	return false;
 }
 
+// Called by RmlUi when it wants to replace a region of a generated texture.
+bool RenderInterface::UpdateTexture(TextureHandle /*texture_handle*/, const byte* /*source*/, Vector2i /*origin*/, Vector2i /*dimensions*/)
+{
+	return false;
+}
+
+// Called by RmlUi when it wants the pixel data of a texture source.
+bool RenderInterface::LoadTextureData(UniquePtr<const byte[]>& /*data*/, Vector2i& /*dimensions*/, const String& /*source*/)
+{
+	return false;
+}
+
 // Called by RmlUi when a loaded texture is no longer required.
 void RenderInterface::ReleaseTexture(TextureHandle /*texture*/)
 {
 }
 
+// Called by RmlUi when it wants to redirect rendering into a new texture.
+bool RenderInterface::BeginRenderToTexture(TextureHandle& /*texture_handle*/, Vector2i /*origin*/, Vector2i /*dimensions*/)
+{
+	return false;
+}
+
+// Called by RmlUi when rendering into the texture is complete.
+void RenderInterface::EndRenderToTexture()
+{
+}
+
 // Called by RmlUi when it wants to change the current transform matrix to a new matrix.
 void RenderInterface::SetTransform(const Matrix4f* /*transform*/)
 {
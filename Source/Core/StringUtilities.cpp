@@ -124,6 +124,9 @@ RMLUICORE_API String StringUtilities::EncodeRml(const String& string)
 
 String StringUtilities::DecodeRml(const String& s)
 {
+	if (s.find('&') == String::npos)
+		return s;
+
 	String result;
 	result.reserve(s.size());
 	for (size_t i = 0; i < s.size();)
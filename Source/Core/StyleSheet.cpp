@@ -45,6 +45,65 @@ inline static bool StyleSheetNodeSort(const StyleSheetNode* lhs, const StyleShee
 	return lhs->GetSpecificity() < rhs->GetSpecificity();
 }
 
+// Returns the keys of the node index under which the nodes applicable to the element may be found.
+static int GetNodeHashes(const Element* element, Array<size_t, 4>& node_hash)
+{
+	const String& tag = element->GetTagName();
+	const String& id = element->GetId();
+
+	// The styled_node_index is hashed with the tag and id of the RCSS rule. However, we must also check
+	// the rules which don't have them defined, because they apply regardless of tag and id.
+	node_hash[0] = 0;
+	node_hash[1] = StyleSheet::NodeHash(tag, String());
+
+	// If we don't have an id, we can safely skip nodes that define an id. Otherwise, we also check the id nodes.
+	if (id.empty())
+		return 2;
+
+	node_hash[2] = StyleSheet::NodeHash(String(), id);
+	node_hash[3] = StyleSheet::NodeHash(tag, id);
+	return 4;
+}
+
+static bool EqualKeyframes(const KeyframesMap& a, const KeyframesMap& b)
+{
+	if (a.size() != b.size())
+		return false;
+
+	for (const auto& pair : a)
+	{
+		auto it = b.find(pair.first);
+		if (it == b.end() || pair.second.property_ids != it->second.property_ids || pair.second.blocks.size() != it->second.blocks.size())
+			return false;
+
+		for (size_t i = 0; i < pair.second.blocks.size(); i++)
+		{
+			const KeyframeBlock& block_a = pair.second.blocks[i];
+			const KeyframeBlock& block_b = it->second.blocks[i];
+			if (block_a.normalized_time != block_b.normalized_time || !StyleSheetNode::EqualProperties(block_a.properties, block_b.properties))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+static bool EqualDecoratorSpecifications(const DecoratorSpecificationMap& a, const DecoratorSpecificationMap& b)
+{
+	if (a.size() != b.size())
+		return false;
+
+	for (const auto& pair : a)
+	{
+		auto it = b.find(pair.first);
+		if (it == b.end() || pair.second.decorator_type != it->second.decorator_type ||
+			!StyleSheetNode::EqualProperties(pair.second.properties, it->second.properties))
+			return false;
+	}
+
+	return true;
+}
+
 StyleSheet::StyleSheet()
 {
 	root = MakeUnique<StyleSheetNode>();
@@ -110,6 +169,59 @@ void StyleSheet::BuildNodeIndex()
 	root->SetStructurallyVolatileRecursive(false);
 }
 
+bool StyleSheet::GetChangedNodes(const StyleSheet& previous, NodeIndex& changed_node_index) const
+{
+	RMLUI_ZoneScoped;
+
+	if (!EqualKeyframes(keyframes, previous.keyframes) || !EqualDecoratorSpecifications(decorator_map, previous.decorator_map))
+		return false;
+
+	const SpriteMap& sprites = spritesheet_list.sprite_map;
+	const SpriteMap& previous_sprites = previous.spritesheet_list.sprite_map;
+	if (sprites.size() != previous_sprites.size())
+		return false;
+
+	for (const auto& pair : sprites)
+	{
+		auto it = previous_sprites.find(pair.first);
+		if (it == previous_sprites.end())
+			return false;
+
+		const Sprite& sprite = pair.second;
+		const Sprite& previous_sprite = it->second;
+		if (sprite.rectangle.x != previous_sprite.rectangle.x || sprite.rectangle.y != previous_sprite.rectangle.y ||
+			sprite.rectangle.width != previous_sprite.rectangle.width || sprite.rectangle.height != previous_sprite.rectangle.height ||
+			sprite.sprite_sheet->image_source != previous_sprite.sprite_sheet->image_source ||
+			sprite.sprite_sheet->display_scale != previous_sprite.sprite_sheet->display_scale)
+			return false;
+	}
+
+	root->DiffHierarchy(*previous.root, changed_node_index);
+
+	return true;
+}
+
+bool StyleSheet::IsAnyNodeApplicable(const NodeIndex& node_index, const Element* element)
+{
+	Array<size_t, 4> node_hash;
+	const int num_hashes = GetNodeHashes(element, node_hash);
+
+	for (int i = 0; i < num_hashes; i++)
+	{
+		auto it_nodes = node_index.find(node_hash[i]);
+		if (it_nodes != node_index.end())
+		{
+			for (const StyleSheetNode* node : it_nodes->second)
+			{
+				if (node->IsApplicable(element, true))
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 // Returns the Keyframes of the given name, or null if it does not exist.
 const Keyframes * StyleSheet::GetKeyframes(const String & name) const
 {
@@ -190,24 +302,8 @@ SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const Element* ele
 	static Vector< const StyleSheetNode* > applicable_nodes;
 	applicable_nodes.clear();
 
-	const String& tag = element->GetTagName();
-	const String& id = element->GetId();
-
-	// The styled_node_index is hashed with the tag and id of the RCSS rule. However, we must also check
-	// the rules which don't have them defined, because they apply regardless of tag and id.
 	Array<size_t, 4> node_hash;
-	int num_hashes = 2;
-
-	node_hash[0] = 0;
-	node_hash[1] = NodeHash(tag, String());
-
-	// If we don't have an id, we can safely skip nodes that define an id. Otherwise, we also check the id nodes.
-	if (!id.empty())
-	{
-		num_hashes = 4;
-		node_hash[2] = NodeHash(String(), id);
-		node_hash[3] = NodeHash(tag, id);
-	}
+	const int num_hashes = GetNodeHashes(element, node_hash);
 
 	// The hashes are keys into a set of applicable nodes (given tag and id).
 	for (int i = 0; i < num_hashes; i++)
@@ -0,0 +1,815 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "StyleSheetBinary.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/DecoratorInstancer.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/PropertyDefinition.h"
+#include "../../Include/RmlUi/Core/PropertySpecification.h"
+#include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "../../Include/RmlUi/Core/Transform.h"
+#include "StyleSheetFactory.h"
+#include "StyleSheetNode.h"
+#include "Utilities.h"
+#include <string.h>
+#include <type_traits>
+
+namespace Rml {
+
+// Identifies the data as a precompiled style sheet, and catches data written with a different byte order.
+static constexpr uint32_t binary_identifier = 0x52435342;
+
+// Must be incremented whenever the layout of the binary data changes.
+static constexpr uint32_t binary_format_version = 2;
+
+static const PropertySpecification* GetMainSpecification()
+{
+	return &StyleSheetSpecification::GetPropertySpecification();
+}
+
+StyleSheetBinary::StyleSheetBinary() {}
+
+bool StyleSheetBinary::Write(String& data, const MediaBlockList& media_blocks, const String& source)
+{
+	RMLUI_ZoneScoped;
+
+	StyleSheetBinary writer;
+	writer.data = &data;
+
+	writer.WriteRaw(binary_identifier);
+	writer.WriteRaw(binary_format_version);
+	writer.WriteString(GetVersion());
+	writer.WriteRaw(Utilities::HashStable(source));
+
+	writer.WriteRaw((uint32_t)media_blocks.size());
+	for (const MediaBlock& media_block : media_blocks)
+	{
+		// Media query properties are only defined by the parser and never need to be re-parsed.
+		writer.WriteProperties(media_block.properties, nullptr);
+		writer.WriteStyleSheet(*media_block.stylesheet);
+	}
+
+	return !writer.write_error;
+}
+
+bool StyleSheetBinary::Read(MediaBlockList& media_blocks, const String& data, const String& source_path, const String* source)
+{
+	RMLUI_ZoneScoped;
+
+	StyleSheetBinary reader;
+	reader.read_position = data.data();
+	reader.read_end = data.data() + data.size();
+	reader.source_path = source_path;
+
+	uint32_t identifier = 0, format_version = 0;
+	String version;
+	uint64_t source_hash = 0;
+	if (!reader.ReadRaw(identifier) || identifier != binary_identifier || !reader.ReadRaw(format_version) ||
+		format_version != binary_format_version || !reader.ReadString(version) || version != GetVersion() || !reader.ReadRaw(source_hash))
+		return false;
+
+	if (source && Utilities::HashStable(*source) != source_hash)
+		return false;
+
+	uint32_t num_media_blocks = 0;
+	if (!reader.ReadCount(num_media_blocks))
+		return false;
+
+	MediaBlockList new_media_blocks;
+	new_media_blocks.reserve(num_media_blocks);
+
+	for (uint32_t i = 0; i < num_media_blocks; i++)
+	{
+		MediaBlock media_block(PropertyDictionary(), SharedPtr<StyleSheet>(new StyleSheet));
+		if (!reader.ReadProperties(media_block.properties, nullptr) || !reader.ReadStyleSheet(*media_block.stylesheet))
+			return false;
+
+		new_media_blocks.push_back(std::move(media_block));
+	}
+
+	if (reader.read_position != reader.read_end)
+		return false;
+
+	media_blocks = std::move(new_media_blocks);
+	return true;
+}
+
+String StyleSheetBinary::GetBinaryPath(const String& source_path)
+{
+	return source_path + ".bin";
+}
+
+void StyleSheetBinary::WriteStyleSheet(const StyleSheet& style_sheet)
+{
+	WriteRaw((int32_t)style_sheet.specificity_offset);
+
+	WriteNode(*style_sheet.root);
+
+	WriteRaw((uint32_t)style_sheet.keyframes.size());
+	for (const auto& pair : style_sheet.keyframes)
+	{
+		const Keyframes& keyframes = pair.second;
+		WriteString(pair.first);
+
+		WriteRaw((uint32_t)keyframes.property_ids.size());
+		for (PropertyId id : keyframes.property_ids)
+			WriteString(StyleSheetSpecification::GetPropertyName(id));
+
+		WriteRaw((uint32_t)keyframes.blocks.size());
+		for (const KeyframeBlock& block : keyframes.blocks)
+		{
+			WriteRaw(block.normalized_time);
+			WriteProperties(block.properties, GetMainSpecification());
+		}
+	}
+
+	// Spritesheets are written before decorators, since the decorators may refer to their sprites when instanced.
+	const SpritesheetList& spritesheet_list = style_sheet.spritesheet_list;
+	WriteRaw((uint32_t)spritesheet_list.spritesheets.size());
+	for (const auto& spritesheet : spritesheet_list.spritesheets)
+	{
+		WriteString(spritesheet->name);
+		WriteString(spritesheet->image_source);
+		WriteRaw((int32_t)spritesheet->definition_line_number);
+		WriteRaw(spritesheet->display_scale);
+
+		uint32_t num_sprites = 0;
+		for (const auto& pair : spritesheet_list.sprite_map)
+			num_sprites += (pair.second.sprite_sheet == spritesheet.get() ? 1 : 0);
+
+		WriteRaw(num_sprites);
+		for (const auto& pair : spritesheet_list.sprite_map)
+		{
+			if (pair.second.sprite_sheet == spritesheet.get())
+			{
+				WriteString(pair.first);
+				WriteRaw(pair.second.rectangle);
+			}
+		}
+	}
+
+	WriteRaw((uint32_t)style_sheet.decorator_map.size());
+	for (const auto& pair : style_sheet.decorator_map)
+	{
+		const DecoratorSpecification& specification = pair.second;
+		DecoratorInstancer* instancer = Factory::GetDecoratorInstancer(specification.decorator_type);
+		if (!instancer)
+		{
+			write_error = true;
+			return;
+		}
+
+		// All properties of the decorator share the source of the @decorator rule.
+		const PropertyMap& properties = specification.properties.GetProperties();
+		WriteString(pair.first);
+		WriteString(specification.decorator_type);
+		WriteSource(properties.empty() ? nullptr : properties.begin()->second.source.get());
+		WriteProperties(specification.properties, &instancer->GetPropertySpecification());
+	}
+}
+
+void StyleSheetBinary::WriteNode(const StyleSheetNode& node)
+{
+	WriteProperties(node.properties, GetMainSpecification());
+
+	WriteRaw((uint32_t)node.children.size());
+	for (const auto& child : node.children)
+	{
+		WriteString(child->tag);
+		WriteString(child->id);
+
+		WriteRaw((uint32_t)child->class_names.size());
+		for (const String& name : child->class_names)
+			WriteString(name);
+
+		WriteRaw((uint32_t)child->pseudo_class_names.size());
+		for (const String& name : child->pseudo_class_names)
+			WriteString(name);
+
+		WriteRaw((uint32_t)child->structural_selectors.size());
+		for (const StructuralSelector& selector : child->structural_selectors)
+		{
+			WriteString(StyleSheetFactory::GetSelectorName(selector.selector));
+			WriteRaw((int32_t)selector.a);
+			WriteRaw((int32_t)selector.b);
+		}
+
+		WriteRaw(child->child_combinator);
+
+		WriteNode(*child);
+	}
+}
+
+void StyleSheetBinary::WriteProperties(const PropertyDictionary& properties, const PropertySpecification* specification)
+{
+	const PropertyMap& property_map = properties.GetProperties();
+
+	WriteRaw((uint32_t)property_map.size());
+	for (const auto& pair : property_map)
+	{
+		const Property& property = pair.second;
+
+		if (specification == GetMainSpecification())
+			WriteString(StyleSheetSpecification::GetPropertyName(pair.first));
+		else
+			WriteRaw((uint32_t)pair.first);
+
+		WriteRaw((uint32_t)property.unit);
+		WriteRaw((int32_t)property.specificity);
+		WriteRaw((int32_t)property.parser_index);
+		WriteSource(property.source.get());
+		WriteValue(property);
+	}
+}
+
+void StyleSheetBinary::WriteValue(const Property& property)
+{
+	const Variant& value = property.value;
+	const Variant::Type type = value.GetType();
+	WriteRaw((char)type);
+
+	switch (type)
+	{
+	case Variant::NONE: break;
+	case Variant::BOOL: WriteRaw(value.GetReference<bool>()); break;
+	case Variant::BYTE: WriteRaw(value.GetReference<byte>()); break;
+	case Variant::CHAR: WriteRaw(value.GetReference<char>()); break;
+	case Variant::FLOAT: WriteRaw(value.GetReference<float>()); break;
+	case Variant::DOUBLE: WriteRaw(value.GetReference<double>()); break;
+	case Variant::INT: WriteRaw(value.GetReference<int>()); break;
+	case Variant::INT64: WriteRaw(value.GetReference<int64_t>()); break;
+	case Variant::UINT: WriteRaw(value.GetReference<unsigned int>()); break;
+	case Variant::UINT64: WriteRaw(value.GetReference<uint64_t>()); break;
+	case Variant::VECTOR2: WriteRaw(value.GetReference<Vector2f>()); break;
+	case Variant::VECTOR3: WriteRaw(value.GetReference<Vector3f>()); break;
+	case Variant::VECTOR4: WriteRaw(value.GetReference<Vector4f>()); break;
+	case Variant::COLOURF: WriteRaw(value.GetReference<Colourf>()); break;
+	case Variant::COLOURB: WriteRaw(value.GetReference<Colourb>()); break;
+	case Variant::STRING: WriteString(value.GetReference<String>()); break;
+	case Variant::TRANSFORMPTR:
+	{
+		const TransformPtr& transform = value.GetReference<TransformPtr>();
+		const uint32_t num_primitives = (transform ? (uint32_t)transform->GetPrimitives().size() : 0);
+		WriteRaw(bool(transform));
+		WriteRaw(num_primitives);
+		if (transform)
+		{
+			for (const TransformPrimitive& primitive : transform->GetPrimitives())
+				WriteRaw(primitive);
+		}
+	}
+	break;
+	case Variant::TRANSITIONLIST:
+	{
+		const TransitionList& transition_list = value.GetReference<TransitionList>();
+		WriteRaw(transition_list.none);
+		WriteRaw(transition_list.all);
+		WriteRaw((uint32_t)transition_list.transitions.size());
+		for (const Transition& transition : transition_list.transitions)
+		{
+			// Transitions of all properties use an invalid id.
+			WriteString(transition.id == PropertyId::Invalid ? String() : StyleSheetSpecification::GetPropertyName(transition.id));
+			WriteTween(transition.tween);
+			WriteRaw(transition.duration);
+			WriteRaw(transition.delay);
+			WriteRaw(transition.reverse_adjustment_factor);
+		}
+	}
+	break;
+	case Variant::ANIMATIONLIST:
+	{
+		const AnimationList& animation_list = value.GetReference<AnimationList>();
+		WriteRaw((uint32_t)animation_list.size());
+		for (const Animation& animation : animation_list)
+		{
+			WriteRaw(animation.duration);
+			WriteTween(animation.tween);
+			WriteRaw(animation.delay);
+			WriteRaw(animation.alternate);
+			WriteRaw(animation.paused);
+			WriteRaw((int32_t)animation.num_iterations);
+			WriteString(animation.name);
+		}
+	}
+	break;
+	case Variant::DECORATORSPTR:
+	case Variant::FONTEFFECTSPTR:
+		// These hold instanced objects, instead we store their declaration and let the property definition parse it when read.
+		WriteString(value.Get<String>());
+		break;
+	case Variant::SCRIPTINTERFACE:
+	case Variant::VOIDPTR:
+		write_error = true;
+		break;
+	}
+}
+
+void StyleSheetBinary::WriteSource(const PropertySource* source)
+{
+	// Each source is written in full the first time it is encountered, then only referred to by its index. The path is
+	// not stored, since all sources originate from the style sheet being compiled.
+	if (!source)
+	{
+		WriteRaw(uint32_t(-1));
+		return;
+	}
+
+	auto it = source_indices.find(source);
+	if (it != source_indices.end())
+	{
+		WriteRaw(it->second);
+		return;
+	}
+
+	const uint32_t index = (uint32_t)source_indices.size();
+	source_indices.emplace(source, index);
+
+	WriteRaw(index);
+	WriteRaw((int32_t)source->line_number);
+	WriteString(source->rule_name);
+}
+
+void StyleSheetBinary::WriteString(const String& value)
+{
+	WriteRaw((uint32_t)value.size());
+	data->append(value);
+}
+
+void StyleSheetBinary::WriteTween(const Tween& tween)
+{
+	// Callback functions cannot be stored. The direction is given by which of the in and out types are set.
+	if (tween.callback)
+		write_error = true;
+
+	WriteRaw((uint8_t)tween.type_in);
+	WriteRaw((uint8_t)tween.type_out);
+}
+
+template <typename T>
+void StyleSheetBinary::WriteRaw(const T& value)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written directly.");
+	data->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+bool StyleSheetBinary::ReadStyleSheet(StyleSheet& style_sheet)
+{
+	int32_t specificity_offset = 0;
+	if (!ReadRaw(specificity_offset))
+		return false;
+	style_sheet.specificity_offset = specificity_offset;
+
+	if (!ReadNode(*style_sheet.root))
+		return false;
+
+	uint32_t num_keyframes = 0;
+	if (!ReadCount(num_keyframes))
+		return false;
+
+	for (uint32_t i = 0; i < num_keyframes; i++)
+	{
+		String name;
+		uint32_t num_property_ids = 0;
+		if (!ReadString(name) || !ReadCount(num_property_ids))
+			return false;
+
+		Keyframes& keyframes = style_sheet.keyframes[name];
+
+		for (uint32_t j = 0; j < num_property_ids; j++)
+		{
+			String property_name;
+			if (!ReadString(property_name))
+				return false;
+
+			const PropertyId id = StyleSheetSpecification::GetPropertyId(property_name);
+			if (id == PropertyId::Invalid)
+				return false;
+
+			keyframes.property_ids.push_back(id);
+		}
+
+		uint32_t num_blocks = 0;
+		if (!ReadCount(num_blocks))
+			return false;
+
+		for (uint32_t j = 0; j < num_blocks; j++)
+		{
+			float normalized_time = 0.f;
+			if (!ReadRaw(normalized_time))
+				return false;
+
+			keyframes.blocks.emplace_back(normalized_time);
+			if (!ReadProperties(keyframes.blocks.back().properties, GetMainSpecification()))
+				return false;
+		}
+	}
+
+	uint32_t num_spritesheets = 0;
+	if (!ReadCount(num_spritesheets))
+		return false;
+
+	for (uint32_t i = 0; i < num_spritesheets; i++)
+	{
+		String name, image_source;
+		int32_t line_number = 0;
+		float display_scale = 1.f;
+		uint32_t num_sprites = 0;
+		if (!ReadString(name) || !ReadString(image_source) || !ReadRaw(line_number) || !ReadRaw(display_scale) || !ReadCount(num_sprites))
+			return false;
+
+		SpriteDefinitionList sprite_definitions(num_sprites);
+		for (auto& sprite_definition : sprite_definitions)
+		{
+			if (!ReadString(sprite_definition.first) || !ReadRaw(sprite_definition.second))
+				return false;
+		}
+
+		style_sheet.spritesheet_list.AddSpriteSheet(name, image_source, source_path, line_number, display_scale, sprite_definitions);
+	}
+
+	uint32_t num_decorators = 0;
+	if (!ReadCount(num_decorators))
+		return false;
+
+	for (uint32_t i = 0; i < num_decorators; i++)
+	{
+		String name, decorator_type;
+		SharedPtr<const PropertySource> source;
+		if (!ReadString(name) || !ReadString(decorator_type) || !ReadSource(source))
+			return false;
+
+		DecoratorInstancer* instancer = Factory::GetDecoratorInstancer(decorator_type);
+		if (!instancer)
+			return false;
+
+		PropertyDictionary properties;
+		if (!ReadProperties(properties, &instancer->GetPropertySpecification()))
+			return false;
+
+		SharedPtr<Decorator> decorator = instancer->InstanceDecorator(decorator_type, properties, DecoratorInstancerInterface(style_sheet, source.get()));
+		if (!decorator)
+		{
+			Log::Message(Log::LT_WARNING, "Could not instance decorator of type '%s' declared at %s:%d.", decorator_type.c_str(),
+				source_path.c_str(), source ? source->line_number : 0);
+			continue;
+		}
+
+		style_sheet.decorator_map.emplace(name, DecoratorSpecification{std::move(decorator_type), std::move(properties), std::move(decorator)});
+	}
+
+	return true;
+}
+
+bool StyleSheetBinary::ReadNode(StyleSheetNode& node)
+{
+	if (!ReadProperties(node.properties, GetMainSpecification()))
+		return false;
+
+	uint32_t num_children = 0;
+	if (!ReadCount(num_children))
+		return false;
+
+	node.children.reserve(num_children);
+
+	for (uint32_t i = 0; i < num_children; i++)
+	{
+		String tag, id;
+		StringList class_names, pseudo_class_names;
+		StructuralSelectorList structural_selectors;
+		bool child_combinator = false;
+		uint32_t count = 0;
+
+		if (!ReadString(tag) || !ReadString(id) || !ReadCount(count))
+			return false;
+
+		class_names.resize(count);
+		for (String& name : class_names)
+			if (!ReadString(name))
+				return false;
+
+		if (!ReadCount(count))
+			return false;
+
+		pseudo_class_names.resize(count);
+		for (String& name : pseudo_class_names)
+			if (!ReadString(name))
+				return false;
+
+		if (!ReadCount(count))
+			return false;
+
+		for (uint32_t j = 0; j < count; j++)
+		{
+			String selector_name;
+			int32_t a = 0, b = 0;
+			if (!ReadString(selector_name) || !ReadRaw(a) || !ReadRaw(b))
+				return false;
+
+			StructuralSelector selector = StyleSheetFactory::GetSelector(selector_name);
+			if (!selector.selector)
+				return false;
+
+			selector.a = a;
+			selector.b = b;
+			structural_selectors.push_back(selector);
+		}
+
+		if (!ReadRaw(child_combinator))
+			return false;
+
+		auto child = MakeUnique<StyleSheetNode>(&node, std::move(tag), std::move(id), std::move(class_names), std::move(pseudo_class_names),
+			std::move(structural_selectors), child_combinator);
+
+		if (!ReadNode(*child))
+			return false;
+
+		node.children.push_back(std::move(child));
+	}
+
+	return true;
+}
+
+bool StyleSheetBinary::ReadProperties(PropertyDictionary& properties, const PropertySpecification* specification)
+{
+	uint32_t num_properties = 0;
+	if (!ReadCount(num_properties))
+		return false;
+
+	for (uint32_t i = 0; i < num_properties; i++)
+	{
+		PropertyId id = PropertyId::Invalid;
+		if (specification == GetMainSpecification())
+		{
+			// Custom properties may be registered in a different order, thus their ids are resolved by name.
+			String name;
+			if (!ReadString(name))
+				return false;
+			id = StyleSheetSpecification::GetPropertyId(name);
+		}
+		else
+		{
+			uint32_t id_value = 0;
+			if (!ReadRaw(id_value))
+				return false;
+			id = (PropertyId)id_value;
+		}
+
+		uint32_t unit = 0;
+		int32_t specificity = 0, parser_index = 0;
+
+		Property property;
+		property.definition = (specification ? specification->GetProperty(id) : nullptr);
+
+		if (id == PropertyId::Invalid || (specification && !property.definition) || !ReadRaw(unit) || !ReadRaw(specificity) ||
+			!ReadRaw(parser_index) || !ReadSource(property.source))
+			return false;
+
+		property.unit = (Property::Unit)unit;
+		property.specificity = specificity;
+		property.parser_index = parser_index;
+
+		if (!ReadValue(property))
+			return false;
+
+		properties.SetProperty(id, property);
+	}
+
+	return true;
+}
+
+bool StyleSheetBinary::ReadValue(Property& property)
+{
+	char type = 0;
+	if (!ReadRaw(type))
+		return false;
+
+	Variant& value = property.value;
+
+	switch ((Variant::Type)type)
+	{
+	case Variant::NONE: value.Clear(); return true;
+	case Variant::BOOL: return ReadVariant<bool>(value);
+	case Variant::BYTE: return ReadVariant<byte>(value);
+	case Variant::CHAR: return ReadVariant<char>(value);
+	case Variant::FLOAT: return ReadVariant<float>(value);
+	case Variant::DOUBLE: return ReadVariant<double>(value);
+	case Variant::INT: return ReadVariant<int>(value);
+	case Variant::INT64: return ReadVariant<int64_t>(value);
+	case Variant::UINT: return ReadVariant<unsigned int>(value);
+	case Variant::UINT64: return ReadVariant<uint64_t>(value);
+	case Variant::VECTOR2: return ReadVariant<Vector2f>(value);
+	case Variant::VECTOR3: return ReadVariant<Vector3f>(value);
+	case Variant::VECTOR4: return ReadVariant<Vector4f>(value);
+	case Variant::COLOURF: return ReadVariant<Colourf>(value);
+	case Variant::COLOURB: return ReadVariant<Colourb>(value);
+	case Variant::STRING:
+	{
+		String string;
+		if (!ReadString(string))
+			return false;
+		value = std::move(string);
+		return true;
+	}
+	case Variant::TRANSFORMPTR:
+	{
+		bool has_transform = false;
+		uint32_t num_primitives = 0;
+		if (!ReadRaw(has_transform) || !ReadCount(num_primitives))
+			return false;
+
+		TransformPtr transform;
+		if (has_transform)
+		{
+			Transform::PrimitiveList primitives(num_primitives, TransformPrimitive(Transforms::TranslateX(0.f)));
+			for (TransformPrimitive& primitive : primitives)
+				if (!ReadRaw(primitive))
+					return false;
+
+			transform = MakeShared<Transform>(std::move(primitives));
+		}
+
+		value = std::move(transform);
+		return true;
+	}
+	case Variant::TRANSITIONLIST:
+	{
+		TransitionList transition_list;
+		uint32_t num_transitions = 0;
+		if (!ReadRaw(transition_list.none) || !ReadRaw(transition_list.all) || !ReadCount(num_transitions))
+			return false;
+
+		transition_list.transitions.resize(num_transitions);
+		for (Transition& transition : transition_list.transitions)
+		{
+			String name;
+			if (!ReadString(name) || !ReadTween(transition.tween) || !ReadRaw(transition.duration) || !ReadRaw(transition.delay) ||
+				!ReadRaw(transition.reverse_adjustment_factor))
+				return false;
+
+			if (!name.empty())
+			{
+				transition.id = StyleSheetSpecification::GetPropertyId(name);
+				if (transition.id == PropertyId::Invalid)
+					return false;
+			}
+		}
+
+		value = std::move(transition_list);
+		return true;
+	}
+	case Variant::ANIMATIONLIST:
+	{
+		uint32_t num_animations = 0;
+		if (!ReadCount(num_animations))
+			return false;
+
+		AnimationList animation_list(num_animations);
+		for (Animation& animation : animation_list)
+		{
+			int32_t num_iterations = 0;
+			if (!ReadRaw(animation.duration) || !ReadTween(animation.tween) || !ReadRaw(animation.delay) || !ReadRaw(animation.alternate) ||
+				!ReadRaw(animation.paused) || !ReadRaw(num_iterations) || !ReadString(animation.name))
+				return false;
+			animation.num_iterations = num_iterations;
+		}
+
+		value = std::move(animation_list);
+		return true;
+	}
+	case Variant::DECORATORSPTR:
+	case Variant::FONTEFFECTSPTR:
+	{
+		String declaration;
+		if (!ReadString(declaration) || !property.definition)
+			return false;
+
+		// Parsing replaces the unit and parser index, restore the rest of the property afterwards.
+		const int specificity = property.specificity;
+		SharedPtr<const PropertySource> source = std::move(property.source);
+		if (!property.definition->ParseValue(property, declaration))
+			return false;
+
+		property.specificity = specificity;
+		property.source = std::move(source);
+		return true;
+	}
+	case Variant::SCRIPTINTERFACE:
+	case Variant::VOIDPTR:
+		break;
+	}
+
+	return false;
+}
+
+bool StyleSheetBinary::ReadSource(SharedPtr<const PropertySource>& source)
+{
+	uint32_t index = 0;
+	if (!ReadRaw(index))
+		return false;
+
+	if (index == uint32_t(-1))
+	{
+		source.reset();
+		return true;
+	}
+
+	if (index < (uint32_t)sources.size())
+	{
+		source = sources[index];
+		return true;
+	}
+
+	int32_t line_number = 0;
+	String rule_name;
+	if (index != (uint32_t)sources.size() || !ReadRaw(line_number) || !ReadString(rule_name))
+		return false;
+
+	source = MakeShared<PropertySource>(source_path, (int)line_number, std::move(rule_name));
+	sources.push_back(source);
+	return true;
+}
+
+bool StyleSheetBinary::ReadCount(uint32_t& count)
+{
+	// Every element occupies at least one byte, reject counts that cannot possibly fit in the remaining data.
+	return ReadRaw(count) && count <= (uint32_t)(read_end - read_position);
+}
+
+bool StyleSheetBinary::ReadString(String& value)
+{
+	uint32_t size = 0;
+	if (!ReadCount(size))
+		return false;
+
+	value.assign(read_position, size);
+	read_position += size;
+	return true;
+}
+
+bool StyleSheetBinary::ReadTween(Tween& tween)
+{
+	uint8_t type_in = 0, type_out = 0;
+	if (!ReadRaw(type_in) || !ReadRaw(type_out))
+		return false;
+
+	auto IsValidType = [](uint8_t type) { return type < (uint8_t)Tween::Count && type != (uint8_t)Tween::Callback; };
+	if (!IsValidType(type_in) || !IsValidType(type_out))
+		return false;
+
+	tween = Tween((Tween::Type)type_in, (Tween::Type)type_out);
+	return true;
+}
+
+template <typename T>
+bool StyleSheetBinary::ReadRaw(T& value)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be read directly.");
+	if ((size_t)(read_end - read_position) < sizeof(T))
+		return false;
+
+	memcpy(static_cast<void*>(&value), read_position, sizeof(T));
+	read_position += sizeof(T);
+	return true;
+}
+
+template <typename T>
+bool StyleSheetBinary::ReadVariant(Variant& variant)
+{
+	T value{};
+	if (!ReadRaw(value))
+		return false;
+	variant = value;
+	return true;
+}
+
+} // namespace Rml
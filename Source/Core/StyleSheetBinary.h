@@ -0,0 +1,114 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#ifndef RMLUI_CORE_STYLESHEETBINARY_H
+#define RMLUI_CORE_STYLESHEETBINARY_H
+
+#include "../../Include/RmlUi/Core/StyleSheetTypes.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class PropertyDictionary;
+class PropertySpecification;
+class StyleSheet;
+class StyleSheetNode;
+class Tween;
+struct PropertySource;
+
+/**
+	Reads and writes the precompiled binary representation of style sheets.
+
+	The binary form contains the fully parsed media blocks, with their node trees, properties, keyframes, decorators and
+	spritesheets, so that it can be loaded without any text parsing. The data is tied to the exact library version and
+	platform it was produced with, and to a hash of the source it was compiled from, any mismatch makes it stale.
+ */
+
+class StyleSheetBinary {
+public:
+	/// Serializes the given media blocks.
+	/// @param[out] data The binary data, appended to.
+	/// @param[in] media_blocks The parsed media blocks to write.
+	/// @param[in] source The source text the media blocks were parsed from.
+	/// @return True on success, false if the style sheets contain values that cannot be serialized.
+	static bool Write(String& data, const MediaBlockList& media_blocks, const String& source);
+
+	/// Reconstructs the media blocks from their binary representation.
+	/// @param[out] media_blocks The media blocks to read into.
+	/// @param[in] data The binary data.
+	/// @param[in] source_path The path of the source style sheet, used as the source of all properties and for resolving relative paths.
+	/// @param[in] source The current source text if available, the data is considered stale if it was compiled from a different source.
+	/// @return True on success, false if the data is invalid or stale.
+	static bool Read(MediaBlockList& media_blocks, const String& data, const String& source_path, const String* source);
+
+	/// Returns the path of the precompiled binary for the style sheet at the given path.
+	static String GetBinaryPath(const String& source_path);
+
+private:
+	StyleSheetBinary();
+
+	void WriteStyleSheet(const StyleSheet& style_sheet);
+	void WriteNode(const StyleSheetNode& node);
+	// Properties of the main style sheet specification are identified by name, those of other specifications by id.
+	void WriteProperties(const PropertyDictionary& properties, const PropertySpecification* specification);
+	void WriteValue(const Property& property);
+	void WriteSource(const PropertySource* source);
+	void WriteString(const String& value);
+	void WriteTween(const Tween& tween);
+	template <typename T>
+	void WriteRaw(const T& value);
+
+	bool ReadStyleSheet(StyleSheet& style_sheet);
+	bool ReadNode(StyleSheetNode& node);
+	bool ReadProperties(PropertyDictionary& properties, const PropertySpecification* specification);
+	bool ReadValue(Property& property);
+	bool ReadSource(SharedPtr<const PropertySource>& source);
+	bool ReadCount(uint32_t& count);
+	bool ReadString(String& value);
+	bool ReadTween(Tween& tween);
+	template <typename T>
+	bool ReadRaw(T& value);
+	template <typename T>
+	bool ReadVariant(Variant& variant);
+
+	// Output buffer while writing.
+	String* data = nullptr;
+	// Set when encountering values which cannot be written.
+	bool write_error = false;
+	UnorderedMap<const PropertySource*, uint32_t> source_indices;
+
+	// Input range while reading.
+	const char* read_position = nullptr;
+	const char* read_end = nullptr;
+	String source_path;
+	Vector<SharedPtr<const PropertySource>> sources;
+};
+
+} // namespace Rml
+#endif
@@ -31,9 +31,14 @@
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "../../Include/RmlUi/Core/URL.h"
 #include "ComputeProperty.h"
+#include "ProfileRecorder.h"
+#include "StyleSheetBinary.h"
+#include "StyleSheetFactory.h"
 #include "StyleSheetParser.h"
 #include "Utilities.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -49,9 +54,26 @@ bool StyleSheetContainer::LoadStyleSheetContainer(Stream* stream, int begin_line
 {
 	StyleSheetParser parser;
 	bool result = parser.Parse(media_blocks, stream, begin_line_number);
+	AddEmptyMediaBlockIfEmpty();
 	return result;
 }
 
+bool StyleSheetContainer::LoadCompiledStyleSheetContainer(const String& data, const String& source_path, const String* source)
+{
+	// Use the same path representation as when parsing the source, see StreamFile and StyleSheetParser.
+	const String url_path = StringUtilities::Replace(URL(StringUtilities::Replace(source_path, ':', '|')).GetURL(), '|', ':');
+	if (!StyleSheetBinary::Read(media_blocks, data, url_path, source))
+		return false;
+
+	AddEmptyMediaBlockIfEmpty();
+	return true;
+}
+
+bool StyleSheetContainer::SaveCompiledStyleSheetContainer(String& data, const String& source) const
+{
+	return StyleSheetBinary::Write(data, media_blocks, source);
+}
+
 bool StyleSheetContainer::UpdateCompiledStyleSheet(const Context* context)
 {
 	RMLUI_ZoneScoped;
@@ -154,30 +176,36 @@ bool StyleSheetContainer::UpdateCompiledStyleSheet(const Context* context)
 
 	if (style_sheet_changed)
 	{
-		StyleSheet* first_sheet = nullptr;
-		UniquePtr<StyleSheet> new_sheet;
-
+		// Documents linking the same style sheets, such as many documents sharing a common set of files, produce the same
+		// list of active sheets. Reuse any compiled sheet built from these sources rather than combining them again.
+		Vector<const StyleSheet*> sources;
+		sources.reserve(new_active_media_block_indices.size());
 		for (int index : new_active_media_block_indices)
+			sources.push_back(media_blocks[index].stylesheet.get());
+
+		SharedPtr<StyleSheet> new_sheet = StyleSheetFactory::FindCompiledStyleSheet(sources);
+
+		if (!new_sheet)
 		{
-			MediaBlock& media_block = media_blocks[index];
-			if (!first_sheet)
-				first_sheet = media_block.stylesheet.get();
-			else if (!new_sheet)
-				new_sheet = first_sheet->CombineStyleSheet(*media_block.stylesheet);
+			RMLUI_RecordZone("CompileStyleSheet");
+
+			if (sources.empty())
+				new_sheet.reset(new StyleSheet);
+			else if (sources.size() == 1)
+				new_sheet = media_blocks[new_active_media_block_indices[0]].stylesheet;
 			else
-				new_sheet->MergeStyleSheet(*media_block.stylesheet);
-		}
+			{
+				UniquePtr<StyleSheet> combined_sheet = sources[0]->CombineStyleSheet(*sources[1]);
+				for (size_t i = 2; i < sources.size(); i++)
+					combined_sheet->MergeStyleSheet(*sources[i]);
+				new_sheet = std::move(combined_sheet);
+			}
 
-		if (!first_sheet)
-		{
-			new_sheet.reset(new StyleSheet);
-			first_sheet = new_sheet.get();
+			new_sheet->BuildNodeIndex();
+			StyleSheetFactory::AddCompiledStyleSheet(sources, new_sheet);
 		}
 
-		compiled_style_sheet = (new_sheet ? new_sheet.get() : first_sheet);
-		combined_compiled_style_sheet = std::move(new_sheet);
-
-		compiled_style_sheet->BuildNodeIndex();
+		compiled_style_sheet = std::move(new_sheet);
 	}
 
 	active_media_block_indices = std::move(new_active_media_block_indices);
@@ -187,7 +215,7 @@ bool StyleSheetContainer::UpdateCompiledStyleSheet(const Context* context)
 
 StyleSheet* StyleSheetContainer::GetCompiledStyleSheet()
 {
-	return compiled_style_sheet;
+	return compiled_style_sheet.get();
 }
 
 SharedPtr<StyleSheetContainer> StyleSheetContainer::CombineStyleSheetContainer(const StyleSheetContainer& container) const
@@ -242,4 +270,52 @@ void StyleSheetContainer::MergeStyleSheetContainer(const StyleSheetContainer& ot
 	}
 }
 
+SharedPtr<StyleSheetContainer> StyleSheetContainer::ReplaceStyleSheetContainer(const StyleSheetContainer& previous,
+	const StyleSheetContainer& replacement) const
+{
+	RMLUI_ZoneScoped;
+
+	const MediaBlockList& previous_blocks = previous.media_blocks;
+	if (previous_blocks.empty())
+		return nullptr;
+
+	auto EqualStyleSheet = [](const MediaBlock& a, const MediaBlock& b) { return a.stylesheet == b.stylesheet; };
+
+	SharedPtr<StyleSheetContainer> new_sheet;
+
+	// The merged containers make up consecutive ranges of media blocks, which share their style sheets with the source containers.
+	for (size_t i = 0; i < media_blocks.size();)
+	{
+		if (i + previous_blocks.size() <= media_blocks.size() &&
+			std::equal(previous_blocks.begin(), previous_blocks.end(), media_blocks.begin() + i, EqualStyleSheet))
+		{
+			if (!new_sheet)
+			{
+				new_sheet = MakeShared<StyleSheetContainer>();
+				for (size_t j = 0; j < i; j++)
+					new_sheet->media_blocks.emplace_back(media_blocks[j].properties, media_blocks[j].stylesheet);
+			}
+
+			for (const MediaBlock& media_block : replacement.media_blocks)
+				new_sheet->media_blocks.emplace_back(media_block.properties, media_block.stylesheet);
+
+			i += previous_blocks.size();
+		}
+		else
+		{
+			if (new_sheet)
+				new_sheet->media_blocks.emplace_back(media_blocks[i].properties, media_blocks[i].stylesheet);
+			i += 1;
+		}
+	}
+
+	return new_sheet;
+}
+
+void StyleSheetContainer::AddEmptyMediaBlockIfEmpty()
+{
+	if (media_blocks.empty())
+		media_blocks.emplace_back(PropertyDictionary(), SharedPtr<StyleSheet>(new StyleSheet()));
+}
+
 } // namespace Rml
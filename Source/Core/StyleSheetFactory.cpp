@@ -29,6 +29,7 @@
 #include "StyleSheetFactory.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "StyleSheetNode.h"
+#include "ProfileRecorder.h"
 #include "StreamFile.h"
 #include "StyleSheetNodeSelectorNthChild.h"
 #include "StyleSheetNodeSelectorNthLastChild.h"
@@ -41,7 +42,13 @@
 #include "StyleSheetNodeSelectorOnlyChild.h"
 #include "StyleSheetNodeSelectorOnlyOfType.h"
 #include "StyleSheetNodeSelectorEmpty.h"
+#include "Utilities.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "StyleSheetBinary.h"
 
 namespace Rml {
 
@@ -81,20 +88,44 @@ void StyleSheetFactory::Shutdown()
 
 const StyleSheetContainer* StyleSheetFactory::GetStyleSheetContainer(const String& sheet_name)
 {
-	// Look up the sheet definition in the cache
-	auto it = instance->stylesheets.find(sheet_name);
-	if (it != instance->stylesheets.end())
-		return it->second.get();
+	std::unique_lock<std::mutex> lock(instance->stylesheets_mutex);
+
+	// Look up the sheet definition in the cache, waiting for it if it is currently being loaded by another thread.
+	while (true)
+	{
+		auto it = instance->stylesheets.find(sheet_name);
+		if (it != instance->stylesheets.end())
+			return it->second.sheet.get();
+
+		if (instance->loading_stylesheets.count(sheet_name) == 0)
+			break;
+
+		instance->stylesheets_condition.wait(lock);
+	}
+
+	// Don't currently have the sheet, attempt to load it. This is done outside the lock so that several sheets can be
+	// loaded in parallel.
+	instance->loading_stylesheets.insert(sheet_name);
+	lock.unlock();
+
+	// Record the modification time before loading, so that any later change is detected.
+	uint64_t modification_time = 0;
+	const bool has_modification_time = GetFileInterface()->GetModificationTime(sheet_name, modification_time);
 
-	// Don't currently have the sheet, attempt to load it
 	UniquePtr<const StyleSheetContainer> sheet = instance->LoadStyleSheetContainer(sheet_name);
-	if (!sheet)
-		return nullptr;
 
-	const StyleSheetContainer* result = sheet.get();
+	lock.lock();
+	instance->loading_stylesheets.erase(sheet_name);
 
-	// Add it to the cache.
-	instance->stylesheets[sheet_name] = std::move(sheet);
+	const StyleSheetContainer* result = nullptr;
+	if (sheet)
+	{
+		result = sheet.get();
+		instance->stylesheets[sheet_name] = StyleSheetEntry{std::move(sheet), has_modification_time, modification_time};
+	}
+
+	lock.unlock();
+	instance->stylesheets_condition.notify_all();
 
 	return result;
 }
@@ -102,9 +133,92 @@ const StyleSheetContainer* StyleSheetFactory::GetStyleSheetContainer(const Strin
 // Clear the style sheet cache.
 void StyleSheetFactory::ClearStyleSheetCache()
 {
+	std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
 	instance->stylesheets.clear();
 }
 
+void StyleSheetFactory::RemoveStyleSheetContainer(const String& sheet)
+{
+	std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
+	instance->stylesheets.erase(sheet);
+}
+
+void StyleSheetFactory::ReloadModifiedStyleSheets(Vector<ReloadedStyleSheet>& reloaded_sheets)
+{
+	RMLUI_ZoneScoped;
+
+	FileInterface* file_interface = GetFileInterface();
+
+	Vector<Pair<String, uint64_t>> sheet_times;
+	{
+		std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
+		for (const auto& pair : instance->stylesheets)
+		{
+			if (pair.second.has_modification_time)
+				sheet_times.emplace_back(pair.first, pair.second.modification_time);
+		}
+	}
+
+	for (const auto& sheet_time : sheet_times)
+	{
+		const String& sheet_name = sheet_time.first;
+
+		uint64_t modification_time = 0;
+		if (!file_interface->GetModificationTime(sheet_name, modification_time) || modification_time == sheet_time.second)
+			continue;
+
+		UniquePtr<const StyleSheetContainer> sheet = instance->LoadStyleSheetContainer(sheet_name);
+
+		std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
+		auto it = instance->stylesheets.find(sheet_name);
+		if (it == instance->stylesheets.end())
+			continue;
+
+		// Keep the previous sheet if the new one could not be loaded, but don't try again until the file is modified once more.
+		it->second.modification_time = modification_time;
+		if (!sheet)
+		{
+			Log::Message(Log::LT_WARNING, "Failed to reload modified style sheet %s.", sheet_name.c_str());
+			continue;
+		}
+
+		reloaded_sheets.push_back(ReloadedStyleSheet{std::move(it->second.sheet), sheet.get()});
+		it->second.sheet = std::move(sheet);
+	}
+}
+
+static size_t HashCompiledStyleSheetSources(const Vector<const StyleSheet*>& sources)
+{
+	size_t seed = 0;
+	for (const StyleSheet* sheet : sources)
+		Utilities::HashCombine(seed, sheet);
+	return seed;
+}
+
+SharedPtr<StyleSheet> StyleSheetFactory::FindCompiledStyleSheet(const Vector<const StyleSheet*>& sources)
+{
+	auto it = instance->compiled_stylesheets.find(HashCompiledStyleSheetSources(sources));
+	if (it == instance->compiled_stylesheets.end() || it->second.sources != sources)
+		return nullptr;
+
+	return it->second.sheet.lock();
+}
+
+void StyleSheetFactory::AddCompiledStyleSheet(const Vector<const StyleSheet*>& sources, const SharedPtr<StyleSheet>& compiled_sheet)
+{
+	// Prune entries whose compiled style sheets have since been released.
+	CompiledStyleSheets& compiled_stylesheets = instance->compiled_stylesheets;
+	for (auto it = compiled_stylesheets.begin(); it != compiled_stylesheets.end();)
+	{
+		if (it->second.sheet.expired())
+			it = compiled_stylesheets.erase(it);
+		else
+			++it;
+	}
+
+	compiled_stylesheets[HashCompiledStyleSheetSources(sources)] = CompiledStyleSheet{sources, compiled_sheet};
+}
+
 // Returns one of the available node selectors.
 StructuralSelector StyleSheetFactory::GetSelector(const String& name)
 {
@@ -184,10 +298,52 @@ StructuralSelector StyleSheetFactory::GetSelector(const String& name)
 	return StructuralSelector(it->second.get(), a, b);
 }
 
+String StyleSheetFactory::GetSelectorName(const StyleSheetNodeSelector* selector)
+{
+	for (const auto& pair : instance->selectors)
+	{
+		if (pair.second.get() == selector)
+			return pair.first;
+	}
+	return String();
+}
+
 UniquePtr<const StyleSheetContainer> StyleSheetFactory::LoadStyleSheetContainer(const String& sheet)
 {
+	RMLUI_RecordZone("LoadStyleSheet");
+	RMLUI_RecordZoneText(sheet);
+
 	UniquePtr<StyleSheetContainer> new_style_sheet;
 
+	// When enabled, prefer a precompiled binary of the style sheet while it is up-to-date with its source, which avoids all parsing.
+	FileInterface* file_interface = GetFileInterface();
+	String compiled_data;
+	if (GetCompiledFileLoading() && file_interface->LoadFile(StyleSheetBinary::GetBinaryPath(sheet), compiled_data))
+	{
+		String source;
+		const bool has_source = file_interface->LoadFile(sheet, source);
+
+		new_style_sheet = MakeUnique<StyleSheetContainer>();
+		if (new_style_sheet->LoadCompiledStyleSheetContainer(compiled_data, sheet, has_source ? &source : nullptr))
+			return new_style_sheet;
+
+		Log::Message(Log::LT_INFO, "Precompiled style sheet '%s' is stale or invalid, parsing its source instead.", sheet.c_str());
+		new_style_sheet.reset();
+
+		// The source has already been read, parse it from memory instead of opening its file again.
+		if (has_source)
+		{
+			StreamMemory stream((const byte*)source.data(), source.size());
+			stream.SetSourceURL(sheet);
+
+			new_style_sheet = MakeUnique<StyleSheetContainer>();
+			if (!new_style_sheet->LoadStyleSheetContainer(&stream))
+				new_style_sheet.reset();
+
+			return new_style_sheet;
+		}
+	}
+
 	// Open stream, construct new sheet and pass the stream into the sheet
 	auto stream = MakeUnique<StreamFile>();
 	if (stream->Open(sheet))
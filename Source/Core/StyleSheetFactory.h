@@ -30,9 +30,12 @@
 #define RMLUI_CORE_STYLESHEETFACTORY_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include <condition_variable>
+#include <mutex>
 
 namespace Rml {
 
+class StyleSheet;
 class StyleSheetContainer;
 class StyleSheetNodeSelector;
 struct StructuralSelector;
@@ -53,18 +56,42 @@ public:
 	/// Shutdown style manager
 	static void Shutdown();
 
-	/// Gets the named sheet, retrieving it from the cache if its already been loaded.
+	/// Gets the named sheet, retrieving it from the cache if its already been loaded. May be called from worker threads.
 	/// @param sheet name of sheet to load
 	/// @lifetime Returned pointer is valid until the next call to ClearStyleSheetCache or Shutdown, it should not be stored around.
 	static const StyleSheetContainer* GetStyleSheetContainer(const String& sheet);
 
 	/// Clear the style sheet cache.
 	static void ClearStyleSheetCache();
+	/// Removes the named sheet from the cache, so that it is loaded again the next time it is requested.
+	/// @param sheet name of sheet to remove
+	static void RemoveStyleSheetContainer(const String& sheet);
+
+	struct ReloadedStyleSheet {
+		UniquePtr<const StyleSheetContainer> previous;
+		const StyleSheetContainer* current;
+	};
+	/// Reloads the cached sheets whose source files have been modified since they were loaded, as reported by the file interface.
+	/// @param reloaded_sheets[out] The previous and current version of each reloaded sheet.
+	/// @lifetime The current sheets are valid until the next call to ClearStyleSheetCache or Shutdown, as with GetStyleSheetContainer().
+	static void ReloadModifiedStyleSheets(Vector<ReloadedStyleSheet>& reloaded_sheets);
+
+	/// Returns the compiled style sheet previously built from the given source style sheets, if it is still in use.
+	/// @param sources The style sheets of the active media blocks, in order.
+	/// @return The shared compiled style sheet, or nullptr if none exists.
+	static SharedPtr<StyleSheet> FindCompiledStyleSheet(const Vector<const StyleSheet*>& sources);
+	/// Registers a compiled style sheet to be shared by later compilations of the same source style sheets.
+	/// @note Only a weak reference is kept, the style sheet is released once no containers use it any longer.
+	static void AddCompiledStyleSheet(const Vector<const StyleSheet*>& sources, const SharedPtr<StyleSheet>& compiled_sheet);
 
 	/// Returns one of the available node selectors.
 	/// @param name[in] The name of the desired selector.
 	/// @return The selector registered with the given name, or nullptr if none exists.
 	static StructuralSelector GetSelector(const String& name);
+	/// Returns the name a node selector was registered with.
+	/// @param selector[in] The selector to look up.
+	/// @return The name of the selector, or an empty string if it is not registered.
+	static String GetSelectorName(const StyleSheetNodeSelector* selector);
 
 private:
 	StyleSheetFactory();
@@ -72,9 +99,30 @@ private:
 	// Loads an individual style sheet
 	UniquePtr<const StyleSheetContainer> LoadStyleSheetContainer(const String& sheet);
 
-	// Individual loaded stylesheets
-	using StyleSheets = UnorderedMap<String, UniquePtr<const StyleSheetContainer>>;
+	struct StyleSheetEntry {
+		UniquePtr<const StyleSheetContainer> sheet;
+		// The modification time of the source file when the sheet was loaded, if provided by the file interface.
+		bool has_modification_time;
+		uint64_t modification_time;
+	};
+
+	// Individual loaded stylesheets, protected by the mutex as they may be loaded by the document preloader.
+	using StyleSheets = UnorderedMap<String, StyleSheetEntry>;
 	StyleSheets stylesheets;
+	// Sheets currently being loaded, any other thread requesting them waits for the load instead of repeating it.
+	UnorderedSet<String> loading_stylesheets;
+	std::mutex stylesheets_mutex;
+	std::condition_variable stylesheets_condition;
+
+	struct CompiledStyleSheet {
+		Vector<const StyleSheet*> sources;
+		WeakPtr<StyleSheet> sheet;
+	};
+
+	// Compiled style sheets, keyed by the hash of the sources they were built from. The sources are kept alive by any
+	// container using the compiled sheet, thus their addresses cannot be reused while the entry is valid.
+	using CompiledStyleSheets = UnorderedMap<size_t, CompiledStyleSheet>;
+	CompiledStyleSheets compiled_stylesheets;
 
 	// Custom complex selectors available for style sheets.
 	using SelectorMap = UnorderedMap<String, UniquePtr<StyleSheetNodeSelector>>;
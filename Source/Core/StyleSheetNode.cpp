@@ -140,6 +140,55 @@ void StyleSheetNode::BuildIndex(StyleSheet::NodeIndex& styled_node_index) const
 	}
 }
 
+void StyleSheetNode::DiffHierarchy(const StyleSheetNode& previous, StyleSheet::NodeIndex& changed_node_index) const
+{
+	// The requirements of the two nodes are equal, thus either of them matches the elements affected by the change.
+	if (!EqualProperties(properties, previous.properties))
+		AddToIndex(changed_node_index);
+
+	Vector<bool> previous_child_matched(previous.children.size(), false);
+
+	for (size_t i = 0; i < children.size(); i++)
+	{
+		const StyleSheetNode& child = *children[i];
+
+		// The children are usually in the same order in both hierarchies, start looking for the equivalent child at the same index.
+		const size_t num_previous_children = previous.children.size();
+		const StyleSheetNode* previous_child = nullptr;
+		for (size_t j = 0; j < num_previous_children; j++)
+		{
+			const size_t index = (i + j) % num_previous_children;
+			const StyleSheetNode& candidate = *previous.children[index];
+			if (!previous_child_matched[index] &&
+				candidate.EqualRequirements(child.tag, child.id, child.class_names, child.pseudo_class_names, child.structural_selectors,
+					child.child_combinator))
+			{
+				previous_child_matched[index] = true;
+				previous_child = &candidate;
+				break;
+			}
+		}
+
+		if (previous_child)
+			child.DiffHierarchy(*previous_child, changed_node_index);
+		else
+			child.BuildIndex(changed_node_index);
+	}
+
+	for (size_t i = 0; i < previous.children.size(); i++)
+	{
+		if (!previous_child_matched[i])
+			previous.children[i]->BuildIndex(changed_node_index);
+	}
+}
+
+void StyleSheetNode::AddToIndex(StyleSheet::NodeIndex& node_index) const
+{
+	StyleSheet::NodeList& nodes = node_index[StyleSheet::NodeHash(tag, id)];
+	if (std::find(nodes.begin(), nodes.end(), this) == nodes.end())
+		nodes.push_back(this);
+}
+
 bool StyleSheetNode::SetStructurallyVolatileRecursive(bool ancestor_is_structural_pseudo_class)
 {
 	// If any ancestor or descendant is a structural pseudo class, then we are structurally volatile.
@@ -176,6 +225,44 @@ bool StyleSheetNode::EqualRequirements(const String& _tag, const String& _id, co
 	return true;
 }
 
+static bool EqualPropertyValues(const Property& a, const Property& b)
+{
+	// Decorators and font effects are instanced separately for every parse, compare their declarations instead.
+	const Variant::Type type = a.value.GetType();
+	if (a.unit == b.unit && type == b.value.GetType())
+	{
+		if (type == Variant::DECORATORSPTR)
+		{
+			const DecoratorsPtr& decorators_a = a.value.GetReference<DecoratorsPtr>();
+			const DecoratorsPtr& decorators_b = b.value.GetReference<DecoratorsPtr>();
+			return decorators_a == decorators_b || (decorators_a && decorators_b && decorators_a->value == decorators_b->value);
+		}
+		if (type == Variant::FONTEFFECTSPTR)
+		{
+			const FontEffectsPtr& effects_a = a.value.GetReference<FontEffectsPtr>();
+			const FontEffectsPtr& effects_b = b.value.GetReference<FontEffectsPtr>();
+			return effects_a == effects_b || (effects_a && effects_b && effects_a->value == effects_b->value);
+		}
+	}
+
+	return a == b;
+}
+
+bool StyleSheetNode::EqualProperties(const PropertyDictionary& a, const PropertyDictionary& b)
+{
+	if (a.GetNumProperties() != b.GetNumProperties())
+		return false;
+
+	for (const auto& pair : a.GetProperties())
+	{
+		const Property* property_b = b.GetProperty(pair.first);
+		if (!property_b || pair.second.specificity != property_b->specificity || !EqualPropertyValues(pair.second, *property_b))
+			return false;
+	}
+
+	return true;
+}
+
 // Returns the specificity of this node.
 int StyleSheetNode::GetSpecificity() const
 {
@@ -77,6 +77,11 @@ public:
 	bool SetStructurallyVolatileRecursive(bool ancestor_is_structurally_volatile);
 	/// Builds up a style sheet's index recursively.
 	void BuildIndex(StyleSheet::NodeIndex& styled_node_index) const;
+	/// Compares this hierarchy against a previous version of it, such as from a reloaded style sheet. Nodes whose properties
+	/// differ, and styled nodes only present in either hierarchy, are added to the index.
+	/// @param[in] previous The equivalent node in the previous hierarchy.
+	/// @param[out] changed_node_index The index of changed nodes, which may contain nodes from both hierarchies.
+	void DiffHierarchy(const StyleSheetNode& previous, StyleSheet::NodeIndex& changed_node_index) const;
 
 	/// Imports properties from a single rule definition into the node's properties and sets the
 	/// appropriate specificity on them. Any existing attributes sharing a key with a new attribute
@@ -90,6 +95,9 @@ public:
 	/// Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
 	bool IsApplicable(const Element* element, bool skip_id_tag) const;
 
+	/// Returns true if the dictionaries contain the same properties, with equal values and specificities.
+	static bool EqualProperties(const PropertyDictionary& a, const PropertyDictionary& b);
+
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
 	/// Returns true if this node employs a structural selector, and therefore generates element definitions that are
@@ -103,6 +111,9 @@ private:
 
 	void CalculateAndSetSpecificity();
 
+	// Adds this node to the index, regardless of whether it has any properties.
+	void AddToIndex(StyleSheet::NodeIndex& node_index) const;
+
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element) const;
 	inline bool MatchClassPseudoClass(const Element* element) const;
@@ -129,6 +140,8 @@ private:
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
+
+	friend class Rml::StyleSheetBinary;
 };
 
 } // namespace Rml
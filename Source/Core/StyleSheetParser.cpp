@@ -28,6 +28,7 @@
 
 #include "StyleSheetParser.h"
 #include "ComputeProperty.h"
+#include "ProfileRecorder.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetNode.h"
 #include "../../Include/RmlUi/Core/DecoratorInstancer.h"
@@ -41,6 +42,7 @@
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include <algorithm>
+#include <mutex>
 #include <string.h>
 
 namespace Rml {
@@ -217,6 +219,9 @@ public:
 
 static UniquePtr<MediaQueryPropertyParser> media_query_property_parser;
 
+// Guards the shared parsers above, as style sheets may be parsed concurrently by the document preloader.
+static std::mutex shared_parser_mutex;
+
 
 StyleSheetParser::StyleSheetParser()
 {
@@ -418,6 +423,7 @@ bool StyleSheetParser::ParseDecoratorBlock(const String& at_name, DecoratorSpeci
 
 bool StyleSheetParser::ParseMediaFeatureMap(PropertyDictionary& properties, const String & rules)
 {
+	std::lock_guard<std::mutex> lock(shared_parser_mutex);
 	media_query_property_parser->SetTargetProperties(&properties);
 
 	enum ParseState { Global, Name, Value };
@@ -512,6 +518,8 @@ bool StyleSheetParser::ParseMediaFeatureMap(PropertyDictionary& properties, cons
 bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* _stream, int begin_line_number)
 {
 	RMLUI_ZoneScoped;
+	RMLUI_RecordZone("ParseStyleSheet");
+	RMLUI_RecordZoneText(_stream->GetSourceURL().GetURL());
 
 	int rule_count = 0;
 	line_number = begin_line_number;
@@ -619,6 +627,7 @@ bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* _stream, int
 					else if (at_rule_identifier == "spritesheet")
 					{
 						// The spritesheet parser is reasonably heavy to initialize, so we make it a static global.
+						std::lock_guard<std::mutex> lock(shared_parser_mutex);
 						ReadProperties(*spritesheet_property_parser);
 
 						const String& image_source = spritesheet_property_parser->GetImageSource();
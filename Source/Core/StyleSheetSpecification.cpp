@@ -29,6 +29,9 @@
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
+#include "PropertyDeclarationCache.h"
+#include "ProfileRecorder.h"
+#include "PropertyNameTable.h"
 #include "PropertyParserNumber.h"
 #include "PropertyParserAnimation.h"
 #include "PropertyParserRatio.h"
@@ -45,6 +48,8 @@ namespace Rml {
 
 static StyleSheetSpecification* instance = nullptr;
 
+static constexpr size_t declaration_cache_size = 512;
+
 
 struct DefaultStyleSheetParsers {
 	PropertyParserNumber number = PropertyParserNumber(Property::NUMBER);
@@ -72,6 +77,13 @@ StyleSheetSpecification::StyleSheetSpecification() :
 	instance = this;
 
 	default_parsers.reset(new DefaultStyleSheetParsers);
+
+	// Inline styles and scripts tend to repeat the same declarations, cache the most recently parsed ones.
+	properties.declaration_cache = MakeUnique<PropertyDeclarationCache>(declaration_cache_size);
+
+	// Predefined names are found through tables generated at compile time, the name maps are only needed for custom names.
+	properties.property_map->SetPredefinedLookup(&GetPredefinedPropertyId);
+	properties.shorthand_map->SetPredefinedLookup(&GetPredefinedShorthandId);
 }
 
 StyleSheetSpecification::~StyleSheetSpecification()
@@ -82,16 +94,20 @@ StyleSheetSpecification::~StyleSheetSpecification()
 
 PropertyDefinition& StyleSheetSpecification::RegisterProperty(PropertyId id, const String& property_name, const String& default_value, bool inherited, bool forces_layout)
 {
+	RMLUI_ASSERTMSG(id == PropertyId::Invalid || property_name == GetPredefinedPropertyName(id), "Property name does not match the name table.");
 	return properties.RegisterProperty(property_name, default_value, inherited, forces_layout, id);
 }
 
 ShorthandId StyleSheetSpecification::RegisterShorthand(ShorthandId id, const String& shorthand_name, const String& property_names, ShorthandType type)
 {
+	RMLUI_ASSERTMSG(id == ShorthandId::Invalid || shorthand_name == GetPredefinedShorthandName(id), "Shorthand name does not match the name table.");
 	return properties.RegisterShorthand(shorthand_name, property_names, type, id);
 }
 
 bool StyleSheetSpecification::Initialise()
 {
+	RMLUI_RecordZone("InitialiseStyleSheetSpecification");
+
 	if (instance == nullptr)
 	{
 		new StyleSheetSpecification();
@@ -401,6 +417,7 @@ void StyleSheetSpecification::RegisterDefaultProperties()
 	RegisterProperty(PropertyId::Focus, "focus", "auto", true, false).AddParser("keyword", "none, auto");
 	RegisterProperty(PropertyId::ScrollbarMargin, "scrollbar-margin", "0", false, false).AddParser("length");
 	RegisterProperty(PropertyId::PointerEvents, "pointer-events", "auto", true, false).AddParser("keyword", "none, auto");
+	RegisterProperty(PropertyId::RenderCache, "render-cache", "none", false, false).AddParser("keyword", "none, layer");
 
 	// Perspective and Transform specifications
 	RegisterProperty(PropertyId::Perspective, "perspective", "none", false, false).AddParser("keyword", "none").AddParser("length");
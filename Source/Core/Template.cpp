@@ -103,20 +103,18 @@ bool Template::Load(Stream* stream)
 
 	header = *parser.GetDocumentHeader();
 
-	// Store the body in stream form
-	body = MakeUnique<StreamMemory>(body_end - body_start);	
-	body->SetSourceURL(stream->GetSourceURL());
-	body->PushBack(body_start, body_end - body_start);
+	// Tokenize the body once, so that it can be instanced repeatedly without parsing
+	StreamMemory body_stream((const byte*)body_start, body_end - body_start);
+	body_stream.SetSourceURL(stream->GetSourceURL());
+	body.Compile(&body_stream);
 
 	return true;
 }
 
 Element* Template::ParseTemplate(Element* element)
 {
-	body->Seek(0, SEEK_SET);
-
 	XMLParser parser(element);
-	parser.Parse(body.get());
+	body.Instance(parser);
 
 	// If theres an inject attribute on the template, 
 	// attempt to find the required element
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_TEMPLATE_H
 
 #include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "CompiledDocument.h"
 #include "DocumentHeader.h"
 
 namespace Rml {
@@ -37,7 +38,7 @@ namespace Rml {
 class Element;
 
 /**
-	Contains a RML template. The Header is stored in parsed form, body in an unparsed stream.
+	Contains a RML template. The Header is stored in parsed form, body in compiled form.
 
 	@author Lloyd Weehuizen
  */
@@ -66,7 +67,7 @@ private:
 	String name;
 	String content;
 	DocumentHeader header;
-	UniquePtr<StreamMemory> body;
+	CompiledDocument body;
 };
 
 } // namespace Rml
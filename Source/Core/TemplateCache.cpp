@@ -27,6 +27,7 @@
  */
 
 #include "TemplateCache.h"
+#include "ProfileRecorder.h"
 #include "StreamFile.h"
 #include "Template.h"
 #include "../../Include/RmlUi/Core/Log.h"
@@ -65,12 +66,28 @@ void TemplateCache::Shutdown()
 
 Template* TemplateCache::LoadTemplate(const String& name)
 {
-	// Check if the template is already loaded
-	Templates::iterator itr = instance->templates.find(name);
-	if (itr != instance->templates.end())
-		return (*itr).second;
+	std::unique_lock<std::mutex> lock(instance->mutex);
+
+	// Check if the template is already loaded, or is being loaded by another thread
+	while (true)
+	{
+		Templates::iterator itr = instance->templates.find(name);
+		if (itr != instance->templates.end())
+			return (*itr).second;
+
+		if (instance->loading_templates.count(name) == 0)
+			break;
+
+		instance->condition.wait(lock);
+	}
+
+	// Nope, we better load it, outside the lock so that templates can be loaded in parallel
+	instance->loading_templates.insert(name);
+	lock.unlock();
+
+	RMLUI_RecordZone("LoadTemplate");
+	RMLUI_RecordZoneText(name);
 
-	// Nope, we better load it
 	Template* new_template = nullptr;
 	auto stream = MakeUnique<StreamFile>();
 	if (stream->Open(name))
@@ -88,23 +105,31 @@ Template* TemplateCache::LoadTemplate(const String& name)
 			delete new_template;
 			new_template = nullptr;
 		}
-		else
-		{
-			instance->templates[name] = new_template;
-			instance->template_ids[new_template->GetName()] = new_template;
-		}
 	}
 	else
 	{
 		Log::Message(Log::LT_ERROR, "Failed to open template file %s.", name.c_str());		
 	}
 
+	lock.lock();
+	instance->loading_templates.erase(name);
+
+	if (new_template)
+	{
+		instance->templates[name] = new_template;
+		instance->template_ids[new_template->GetName()] = new_template;
+	}
+
+	lock.unlock();
+	instance->condition.notify_all();
+
 	return new_template;
 }
 
 Template* TemplateCache::GetTemplate(const String& name)
 {
 	// Check if the template is already loaded
+	std::lock_guard<std::mutex> lock(instance->mutex);
 	Templates::iterator itr = instance->template_ids.find(name);
 	if (itr != instance->template_ids.end())
 		return (*itr).second;
@@ -114,6 +139,7 @@ Template* TemplateCache::GetTemplate(const String& name)
 
 void TemplateCache::Clear()
 {
+	std::lock_guard<std::mutex> lock(instance->mutex);
 	for (Templates::iterator i = instance->templates.begin(); i != instance->templates.end(); ++i)
 		delete (*i).second;
 
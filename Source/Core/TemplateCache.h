@@ -30,6 +30,8 @@
 #define RMLUI_CORE_TEMPLATECACHE_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include <condition_variable>
+#include <mutex>
 
 namespace Rml {
 
@@ -48,7 +50,7 @@ public:
 	static bool Initialise();
 	static void Shutdown();
 
-	/// Load the named template from the given path, if its already loaded get the cached copy
+	/// Load the named template from the given path, if its already loaded get the cached copy. May be called from worker threads.
 	static Template* LoadTemplate(const String& path);
 	/// Get the template by id
 	static Template* GetTemplate(const String& id);
@@ -61,8 +63,13 @@ private:
 	~TemplateCache();
 
 	using Templates = UnorderedMap<String, Template*>;
+	// Protected by the mutex, as templates may be loaded by the document preloader.
 	Templates templates;
 	Templates template_ids;
+	// Templates currently being loaded, any other thread requesting them waits for the load instead of repeating it.
+	UnorderedSet<String> loading_templates;
+	std::mutex mutex;
+	std::condition_variable condition;
 };
 
 } // namespace Rml
@@ -72,6 +72,25 @@ Vector2i Texture::GetDimensions(RenderInterface* render_interface) const
 	return resource->GetDimensions(render_interface);
 }
 
+// Returns the region of the texture handle occupied by this texture.
+void Texture::GetTexCoords(RenderInterface* render_interface, Vector2f& top_left, Vector2f& bottom_right) const
+{
+	if (!resource)
+	{
+		top_left = Vector2f(0, 0);
+		bottom_right = Vector2f(1, 1);
+		return;
+	}
+
+	resource->GetTexCoords(render_interface, top_left, bottom_right);
+}
+
+// Returns true while the texture is being loaded in the background.
+bool Texture::IsLoading(RenderInterface* render_interface) const
+{
+	return resource && resource->IsLoading(render_interface);
+}
+
 bool Texture::operator==(const Texture& other) const
 {
 	return resource == other.resource;
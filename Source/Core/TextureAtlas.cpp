@@ -0,0 +1,363 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "TextureAtlas.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include <algorithm>
+#include <string.h>
+
+namespace Rml {
+namespace TextureAtlas {
+
+// Textures are surrounded by a border of this many pixels, repeating their edges.
+static constexpr int padding = 1;
+
+// A row of textures of similar height, filled from left to right.
+struct Shelf {
+	int y;
+	int height;
+	int x;
+	int num_entries;
+};
+
+struct Page {
+	RenderInterface* render_interface = nullptr;
+	TextureHandle texture = 0;
+	int size = 0;
+
+	Vector<Shelf> shelves;
+	int shelves_height = 0;
+	int num_entries = 0;
+	size_t used_area = 0;
+};
+
+struct Entry {
+	int page = -1;
+	int shelf = -1;
+	// Position and dimensions of the texture within the page, excluding padding.
+	Vector2i position;
+	Vector2i dimensions;
+};
+
+class Atlas {
+public:
+	void Configure(int in_max_texture_size, int in_page_size)
+	{
+		max_texture_size = Math::Max(in_max_texture_size, 0);
+		page_size = Math::Max(in_page_size, 1);
+
+		if (max_texture_size + 2 * padding > page_size)
+		{
+			Log::Message(Log::LT_WARNING, "Texture atlas page size %d is too small for textures of size %d.", page_size, max_texture_size);
+			max_texture_size = Math::Max(page_size - 2 * padding, 0);
+		}
+
+		unsupported_interfaces.clear();
+	}
+
+	bool IsEnabled() const { return max_texture_size > 0; }
+
+	TextureAtlasHandle Insert(RenderInterface* render_interface, const byte* data, Vector2i dimensions)
+	{
+		if (!IsEnabled() || dimensions.x <= 0 || dimensions.y <= 0 || dimensions.x > max_texture_size || dimensions.y > max_texture_size)
+			return 0;
+
+		if (std::find(unsupported_interfaces.begin(), unsupported_interfaces.end(), render_interface) != unsupported_interfaces.end())
+			return 0;
+
+		RMLUI_ZoneScoped;
+
+		const Vector2i padded_dimensions = dimensions + Vector2i(2 * padding);
+
+		Entry entry;
+		entry.page = -1;
+		entry.dimensions = dimensions;
+
+		for (int i = 0; i < (int)pages.size() && entry.page < 0; i++)
+		{
+			if (pages[i].render_interface == render_interface && pages[i].texture && Allocate(pages[i], padded_dimensions, entry))
+				entry.page = i;
+		}
+
+		const bool new_page = (entry.page < 0);
+		if (new_page)
+		{
+			entry.page = CreatePage(render_interface);
+			if (entry.page < 0)
+				return 0;
+
+			Allocate(pages[entry.page], padded_dimensions, entry);
+		}
+
+		Page& page = pages[entry.page];
+
+		PadTexture(data, dimensions);
+		if (!render_interface->UpdateTexture(page.texture, padded_data.data(), entry.position - Vector2i(padding), padded_dimensions))
+		{
+			if (new_page)
+			{
+				// We can only find out about support for texture updates once we have a texture to update.
+				unsupported_interfaces.push_back(render_interface);
+				ReleasePage(page);
+				return 0;
+			}
+
+			Log::Message(Log::LT_WARNING, "Failed to update texture atlas page, the texture will be loaded separately.");
+			page.shelves[entry.shelf].num_entries -= 1;
+			return 0;
+		}
+
+		page.num_entries += 1;
+		page.used_area += size_t(padded_dimensions.x) * size_t(padded_dimensions.y);
+
+		TextureAtlasHandle handle;
+		if (free_list.empty())
+		{
+			handle = TextureAtlasHandle(entries.size());
+			entries.push_back(entry);
+		}
+		else
+		{
+			handle = free_list.back();
+			free_list.pop_back();
+			entries[handle] = entry;
+		}
+
+		// Zero is reserved for invalid handles.
+		return handle + 1;
+	}
+
+	void Erase(TextureAtlasHandle handle)
+	{
+		const Entry& entry = GetEntry(handle);
+		Page& page = pages[entry.page];
+		Shelf& shelf = page.shelves[entry.shelf];
+
+		// Space is only reclaimed once a whole shelf is empty, this keeps the packing simple and fast.
+		shelf.num_entries -= 1;
+		if (shelf.num_entries == 0)
+			shelf.x = 0;
+
+		page.num_entries -= 1;
+		page.used_area -= size_t(entry.dimensions.x + 2 * padding) * size_t(entry.dimensions.y + 2 * padding);
+
+		if (page.num_entries == 0)
+			ReleasePage(page);
+
+		free_list.push_back(handle - 1);
+	}
+
+	TextureHandle GetTextureHandle(TextureAtlasHandle handle) const { return pages[GetEntry(handle).page].texture; }
+
+	void GetTexCoords(TextureAtlasHandle handle, Vector2f& top_left, Vector2f& bottom_right) const
+	{
+		const Entry& entry = GetEntry(handle);
+		const float inv_page_size = 1.f / float(pages[entry.page].size);
+
+		top_left = Vector2f(entry.position) * inv_page_size;
+		bottom_right = Vector2f(entry.position + entry.dimensions) * inv_page_size;
+	}
+
+	TextureAtlasStatistics GetStatistics() const
+	{
+		TextureAtlasStatistics statistics;
+		for (const Page& page : pages)
+		{
+			if (!page.texture)
+				continue;
+
+			statistics.num_pages += 1;
+			statistics.num_textures += page.num_entries;
+			statistics.used_area += page.used_area;
+			statistics.total_area += size_t(page.size) * size_t(page.size);
+		}
+		return statistics;
+	}
+
+	void Shutdown()
+	{
+		// Any remaining pages are released as their textures are released.
+		max_texture_size = 0;
+		unsupported_interfaces.clear();
+		padded_data = Vector<byte>();
+	}
+
+private:
+	const Entry& GetEntry(TextureAtlasHandle handle) const
+	{
+		RMLUI_ASSERT(handle > 0 && handle <= (TextureAtlasHandle)entries.size());
+		return entries[handle - 1];
+	}
+
+	// Finds room for the padded dimensions in the page, placing the texture in the shelf wasting the least height.
+	bool Allocate(Page& page, Vector2i padded_dimensions, Entry& entry) const
+	{
+		int best_shelf = -1;
+		for (int i = 0; i < (int)page.shelves.size(); i++)
+		{
+			const Shelf& shelf = page.shelves[i];
+			if (shelf.height >= padded_dimensions.y && shelf.x + padded_dimensions.x <= page.size &&
+				(best_shelf < 0 || shelf.height < page.shelves[best_shelf].height))
+				best_shelf = i;
+		}
+
+		// Open a new shelf rather than wasting more than half of an existing one.
+		if ((best_shelf < 0 || page.shelves[best_shelf].height > 2 * padded_dimensions.y) &&
+			page.shelves_height + padded_dimensions.y <= page.size && padded_dimensions.x <= page.size)
+		{
+			page.shelves.push_back(Shelf{page.shelves_height, padded_dimensions.y, 0, 0});
+			page.shelves_height += padded_dimensions.y;
+			best_shelf = (int)page.shelves.size() - 1;
+		}
+
+		if (best_shelf < 0)
+			return false;
+
+		Shelf& shelf = page.shelves[best_shelf];
+		entry.shelf = best_shelf;
+		entry.position = Vector2i(shelf.x + padding, shelf.y + padding);
+		shelf.x += padded_dimensions.x;
+		shelf.num_entries += 1;
+
+		return true;
+	}
+
+	int CreatePage(RenderInterface* render_interface)
+	{
+		RMLUI_ZoneScopedN("CreateTextureAtlasPage");
+
+		// Generate the page at its full size up-front, textures are then uploaded into it as they are packed.
+		const Vector<byte> empty_data(size_t(page_size) * size_t(page_size) * 4, 0);
+
+		TextureHandle texture = 0;
+		if (!render_interface->GenerateTexture(texture, empty_data.data(), Vector2i(page_size)) || !texture)
+		{
+			unsupported_interfaces.push_back(render_interface);
+			return -1;
+		}
+
+		// Reuse the slot of a released page if possible.
+		auto it = std::find_if(pages.begin(), pages.end(), [](const Page& page) { return !page.texture; });
+		if (it == pages.end())
+			it = pages.insert(pages.end(), Page());
+
+		Page& page = *it;
+		page.render_interface = render_interface;
+		page.texture = texture;
+		page.size = page_size;
+
+		return int(it - pages.begin());
+	}
+
+	void ReleasePage(Page& page)
+	{
+		page.render_interface->ReleaseTexture(page.texture);
+		page = Page();
+	}
+
+	// Copies the texture into 'padded_data', surrounded by its repeated edge pixels.
+	void PadTexture(const byte* data, Vector2i dimensions)
+	{
+		const int padded_width = dimensions.x + 2 * padding;
+		const int padded_height = dimensions.y + 2 * padding;
+		padded_data.resize(size_t(padded_width) * size_t(padded_height) * 4);
+
+		for (int y = 0; y < padded_height; y++)
+		{
+			const int source_y = Math::Clamp(y - padding, 0, dimensions.y - 1);
+			const byte* source_row = data + size_t(source_y) * size_t(dimensions.x) * 4;
+			byte* destination_row = padded_data.data() + size_t(y) * size_t(padded_width) * 4;
+
+			for (int x = 0; x < padding; x++)
+			{
+				memcpy(destination_row + x * 4, source_row, 4);
+				memcpy(destination_row + (padding + dimensions.x + x) * 4, source_row + (dimensions.x - 1) * 4, 4);
+			}
+			memcpy(destination_row + padding * 4, source_row, size_t(dimensions.x) * 4);
+		}
+	}
+
+	int max_texture_size = 0;
+	int page_size = 1024;
+
+	Vector<Page> pages;
+	Vector<Entry> entries;
+	// Declares free slots in the 'entries' list as indices.
+	Vector<TextureAtlasHandle> free_list;
+	Vector<RenderInterface*> unsupported_interfaces;
+
+	Vector<byte> padded_data;
+};
+
+static Atlas atlas;
+
+void Configure(int max_texture_size, int page_size)
+{
+	atlas.Configure(max_texture_size, page_size);
+}
+
+bool IsEnabled()
+{
+	return atlas.IsEnabled();
+}
+
+TextureAtlasHandle Insert(RenderInterface* render_interface, const byte* data, Vector2i dimensions)
+{
+	return atlas.Insert(render_interface, data, dimensions);
+}
+
+void Erase(TextureAtlasHandle handle)
+{
+	atlas.Erase(handle);
+}
+
+TextureHandle GetTextureHandle(TextureAtlasHandle handle)
+{
+	return atlas.GetTextureHandle(handle);
+}
+
+void GetTexCoords(TextureAtlasHandle handle, Vector2f& top_left, Vector2f& bottom_right)
+{
+	atlas.GetTexCoords(handle, top_left, bottom_right);
+}
+
+TextureAtlasStatistics GetStatistics()
+{
+	return atlas.GetStatistics();
+}
+
+void Shutdown()
+{
+	atlas.Shutdown();
+}
+
+} // namespace TextureAtlas
+} // namespace Rml
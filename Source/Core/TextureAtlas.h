@@ -0,0 +1,75 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#ifndef RMLUI_CORE_TEXTUREATLAS_H
+#define RMLUI_CORE_TEXTUREATLAS_H
+
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <stdint.h>
+
+namespace Rml {
+
+class RenderInterface;
+using TextureAtlasHandle = uint32_t;
+
+/**
+    The texture atlas packs small textures into a few large pages, so that elements using different images can be
+    rendered from the same texture. Each page is generated once at its full size, and textures are then uploaded into
+    their own region of the page, thus the texture handle of a page remains the same for as long as it is in use.
+
+    Textures are placed in horizontal shelves with a one pixel border of repeated edge pixels to avoid bleeding between
+    neighbors when filtered. Only used when enabled through Rml::SetTextureAtlas() and with render interfaces supporting
+    RenderInterface::UpdateTexture(). Each successful Insert() must be followed by exactly one Erase() with the returned
+    handle.
+*/
+
+namespace TextureAtlas {
+
+    void Configure(int max_texture_size, int page_size);
+    bool IsEnabled();
+
+    // Packs the texture into an atlas page of the given render interface.
+    // @return A handle to the packed texture, or zero if the texture was not packed.
+    TextureAtlasHandle Insert(RenderInterface* render_interface, const byte* data, Vector2i dimensions);
+    void Erase(TextureAtlasHandle handle);
+
+    // Returns the texture handle of the page containing the packed texture.
+    TextureHandle GetTextureHandle(TextureAtlasHandle handle);
+    // Returns the region of the packed texture within its page, in normalized texture coordinates.
+    void GetTexCoords(TextureAtlasHandle handle, Vector2f& top_left, Vector2f& bottom_right);
+
+    TextureAtlasStatistics GetStatistics();
+
+    // Disables the atlas and forgets which render interfaces lack support for it.
+    void Shutdown();
+}
+
+} // namespace Rml
+#endif
@@ -28,14 +28,20 @@
 
 #include "TextureDatabase.h"
 #include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "TextureLoader.h"
 #include "TextureResource.h"
+#include <algorithm>
 
 namespace Rml {
 
 static TextureDatabase* texture_database = nullptr;
 
+uint64_t TextureDatabase::render_generation = 0;
+
 TextureDatabase::TextureDatabase()
 {
 	RMLUI_ASSERT(texture_database == nullptr);
@@ -46,6 +52,9 @@ TextureDatabase::~TextureDatabase()
 {
 	RMLUI_ASSERT(texture_database == this);
 
+	// Textures still being decoded are simply discarded.
+	loader.reset();
+
 #ifdef RMLUI_DEBUG
 	// All textures not owned by the database should have been released at this point.
 	int num_leaks_file = 0;
@@ -84,6 +93,8 @@ SharedPtr<TextureResource> TextureDatabase::Fetch(const String& source, const St
 	else
 		GetSystemInterface()->JoinPath(path, StringUtilities::Replace(source_directory, '|', ':'), source);
 
+	std::lock_guard<std::mutex> lock(texture_database->textures_mutex);
+
 	auto iterator = texture_database->textures.find(path);
 	if (iterator != texture_database->textures.end())
 		return iterator->second;
@@ -113,6 +124,7 @@ StringList TextureDatabase::GetSourceList()
 
 	if (texture_database)
 	{
+		std::lock_guard<std::mutex> lock(texture_database->textures_mutex);
 		result.reserve(texture_database->textures.size());
 
 		for (const auto& pair : texture_database->textures)
@@ -126,6 +138,7 @@ void TextureDatabase::ReleaseTextures(RenderInterface* render_interface)
 {
 	if (texture_database)
 	{
+		std::lock_guard<std::mutex> lock(texture_database->textures_mutex);
 		for (const auto& texture : texture_database->textures)
 			texture.second->Release(render_interface);
 
@@ -138,6 +151,7 @@ bool TextureDatabase::HoldsReferenceToRenderInterface(RenderInterface* render_in
 {
 	if (texture_database)
 	{
+		std::lock_guard<std::mutex> lock(texture_database->textures_mutex);
 		for (const auto& texture : texture_database->textures)
 			if (texture.second->HoldsRenderInterface(render_interface))
 				return true;
@@ -150,4 +164,177 @@ bool TextureDatabase::HoldsReferenceToRenderInterface(RenderInterface* render_in
 	return false;
 }
 
+void TextureDatabase::SetAsyncLoading(int num_threads, int upload_budget)
+{
+	if (!texture_database)
+		return;
+
+	if (texture_database->loader)
+	{
+		// Wait for any textures in flight, and finish loading them before the loader is replaced.
+		texture_database->loader->Stop();
+		texture_database->upload_budget = 0;
+		ProcessAsyncLoads();
+		texture_database->loader.reset();
+	}
+
+	texture_database->upload_budget = Math::Max(upload_budget, 0);
+
+	if (num_threads > 0)
+		texture_database->loader = MakeUnique<TextureLoader>(num_threads);
+}
+
+void TextureDatabase::Prefetch(RenderInterface* render_interface, const String& source)
+{
+	if (!texture_database)
+		return;
+
+	// Loading is started on first use of the texture.
+	Fetch(source, "")->GetHandle(render_interface);
+}
+
+bool TextureDatabase::LoadAsync(RenderInterface* render_interface, const String& source)
+{
+	if (!texture_database || !texture_database->loader)
+		return false;
+
+	texture_database->loader->Request(render_interface, source);
+	return true;
+}
+
+void TextureDatabase::ProcessAsyncLoads()
+{
+	if (!texture_database || !texture_database->loader || texture_database->loader->GetNumPending() == 0)
+		return;
+
+	RMLUI_ZoneScoped;
+
+	const int upload_budget = texture_database->upload_budget;
+	int uploaded_bytes = 0;
+	bool any_loaded = false;
+
+	TextureLoader::Result result;
+	while ((upload_budget == 0 || uploaded_bytes < upload_budget) && texture_database->loader->PopResult(result))
+	{
+		// The texture may have been released while it was being decoded, then the result is simply dropped.
+		std::lock_guard<std::mutex> lock(texture_database->textures_mutex);
+		auto it = texture_database->textures.find(result.source);
+		if (it != texture_database->textures.end())
+			it->second->FinishAsyncLoad(result.render_interface, std::move(result.data), result.dimensions);
+
+		uploaded_bytes += result.dimensions.x * result.dimensions.y * 4;
+		any_loaded = true;
+	}
+
+	if (any_loaded)
+		texture_database->async_load_generation += 1;
+}
+
+int TextureDatabase::GetAsyncLoadGeneration()
+{
+	return texture_database ? texture_database->async_load_generation : 0;
+}
+
+int TextureDatabase::GetNumAsyncLoads()
+{
+	return (texture_database && texture_database->loader) ? texture_database->loader->GetNumPending() : 0;
+}
+
+void TextureDatabase::SetMemoryBudget(size_t budget)
+{
+	if (texture_database)
+		texture_database->memory_budget = budget;
+}
+
+TextureMemoryStatistics TextureDatabase::GetMemoryStatistics()
+{
+	TextureMemoryStatistics statistics;
+	if (texture_database)
+	{
+		statistics = texture_database->memory_statistics;
+		statistics.budget = texture_database->memory_budget;
+	}
+	return statistics;
+}
+
+void TextureDatabase::AddResidentTexture(size_t byte_size, bool reload)
+{
+	if (!texture_database)
+		return;
+
+	TextureMemoryStatistics& statistics = texture_database->memory_statistics;
+	statistics.resident_bytes += byte_size;
+	statistics.num_resident_textures += 1;
+	statistics.num_reloads += int(reload);
+}
+
+void TextureDatabase::RemoveResidentTexture(size_t byte_size)
+{
+	if (!texture_database)
+		return;
+
+	TextureMemoryStatistics& statistics = texture_database->memory_statistics;
+	RMLUI_ASSERT(statistics.resident_bytes >= byte_size && statistics.num_resident_textures > 0);
+	statistics.resident_bytes -= byte_size;
+	statistics.num_resident_textures -= 1;
+}
+
+void TextureDatabase::EvictTextures()
+{
+	if (!texture_database || texture_database->memory_budget == 0 || texture_database->memory_statistics.resident_bytes <= texture_database->memory_budget)
+		return;
+
+	RMLUI_ZoneScoped;
+
+	// Textures used during the most recent render of every context are considered visible, and are never evicted.
+	const uint64_t num_visible_generations = (uint64_t)Math::Max(GetNumContexts(), 1);
+	const uint64_t oldest_visible_generation = (render_generation >= num_visible_generations ? render_generation - num_visible_generations + 1 : 0);
+
+	struct Candidate {
+		TextureResource* texture;
+		// File textures no longer referenced by anyone but the database are evicted first, and then removed entirely.
+		bool unreferenced;
+		uint64_t last_used;
+	};
+	Vector<Candidate> candidates;
+
+	std::lock_guard<std::mutex> lock(texture_database->textures_mutex);
+
+	for (const auto& pair : texture_database->textures)
+	{
+		TextureResource* texture = pair.second.get();
+		if (texture->IsEvictable() && texture->GetLastUsed() < oldest_visible_generation)
+			candidates.push_back(Candidate{texture, pair.second.use_count() == 1, texture->GetLastUsed()});
+	}
+	for (TextureResource* texture : texture_database->callback_textures)
+	{
+		if (texture->IsEvictable() && texture->GetLastUsed() < oldest_visible_generation)
+			candidates.push_back(Candidate{texture, false, texture->GetLastUsed()});
+	}
+
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+		if (a.unreferenced != b.unreferenced)
+			return a.unreferenced;
+		return a.last_used < b.last_used;
+	});
+
+	TextureMemoryStatistics& statistics = texture_database->memory_statistics;
+
+	for (const Candidate& candidate : candidates)
+	{
+		if (statistics.resident_bytes <= texture_database->memory_budget)
+			break;
+
+		candidate.texture->Evict();
+		statistics.num_evictions += 1;
+
+		if (candidate.unreferenced)
+		{
+			// Copy the key, as the source string is destroyed along with the texture.
+			const String source = candidate.texture->GetSource();
+			texture_database->textures.erase(source);
+		}
+	}
+}
+
 } // namespace Rml
@@ -29,11 +29,14 @@
 #ifndef RMLUI_CORE_TEXTUREDATABASE_H
 #define RMLUI_CORE_TEXTUREDATABASE_H
 
+#include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
 
 namespace Rml {
 
 class RenderInterface;
+class TextureLoader;
 class TextureResource;
 
 /**
@@ -66,15 +69,61 @@ public:
 	/// For debugging. Returns true if any textures hold a reference to the given render interface.
 	static bool HoldsReferenceToRenderInterface(RenderInterface* render_interface);
 
+	/// Enables decoding of file textures on background threads, see Rml::SetAsyncTextureLoading().
+	static void SetAsyncLoading(int num_threads, int upload_budget);
+
+	/// Starts loading the file texture through the given render interface, in the background if enabled.
+	static void Prefetch(RenderInterface* render_interface, const String& source);
+
+	/// Queues the file texture for decoding in the background.
+	/// @return False if asynchronous loading is disabled, then the texture must be loaded immediately.
+	static bool LoadAsync(RenderInterface* render_interface, const String& source);
+
+	/// Generates the textures which have finished decoding, until the upload budget is exhausted.
+	static void ProcessAsyncLoads();
+
+	/// Returns a counter which is incremented whenever textures finish loading in the background.
+	static int GetAsyncLoadGeneration();
+
+	/// Returns the number of textures currently being loaded in the background.
+	static int GetNumAsyncLoads();
+
+	/// Sets the number of bytes of loaded textures to retain before evicting the least recently used ones, or zero for no limit.
+	static void SetMemoryBudget(size_t budget);
+	static TextureMemoryStatistics GetMemoryStatistics();
+
+	/// Called by texture resources to keep track of the memory used by their textures.
+	static void AddResidentTexture(size_t byte_size, bool reload);
+	static void RemoveResidentTexture(size_t byte_size);
+
+	/// Called at the start of each context render, textures used since then are considered visible.
+	static void AdvanceRenderGeneration() { render_generation += 1; }
+	static uint64_t GetRenderGeneration() { return render_generation; }
+
+	/// Evicts the least recently used textures which are not visible, until the memory budget is satisfied.
+	static void EvictTextures();
+
 private:
 	TextureDatabase();
 	~TextureDatabase();
 
+	// Protected by the mutex, as textures may be fetched by style sheets parsed in the document preloader.
 	using TextureMap = UnorderedMap<String, SharedPtr<TextureResource>>;
 	TextureMap textures;
+	std::mutex textures_mutex;
 
 	using CallbackTextureMap = UnorderedSet<TextureResource*>;
 	CallbackTextureMap callback_textures;
+
+	static uint64_t render_generation;
+
+	size_t memory_budget = 0;
+	TextureMemoryStatistics memory_statistics;
+
+	UniquePtr<TextureLoader> loader;
+	// The maximum number of bytes of texture data to generate in each call to ProcessAsyncLoads(), or zero for no limit.
+	int upload_budget = 0;
+	int async_load_generation = 0;
 };
 
 } // namespace Rml
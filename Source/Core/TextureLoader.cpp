@@ -0,0 +1,117 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "TextureLoader.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+
+namespace Rml {
+
+TextureLoader::TextureLoader(int num_threads)
+{
+	threads.reserve(num_threads);
+	for (int i = 0; i < num_threads; i++)
+		threads.emplace_back(&TextureLoader::Run, this);
+}
+
+TextureLoader::~TextureLoader()
+{
+	Stop();
+}
+
+void TextureLoader::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	condition.notify_all();
+
+	for (std::thread& thread : threads)
+		thread.join();
+	threads.clear();
+}
+
+void TextureLoader::Request(RenderInterface* render_interface, const String& source)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		jobs.push(Job{render_interface, source});
+	}
+	condition.notify_one();
+
+	num_pending += 1;
+}
+
+bool TextureLoader::PopResult(Result& result)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (results.empty())
+		return false;
+
+	result = std::move(results.front());
+	results.pop();
+	num_pending -= 1;
+
+	return true;
+}
+
+void TextureLoader::Run()
+{
+	while (true)
+	{
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [this] { return stop || !jobs.empty(); });
+
+			// Finish any remaining jobs before stopping, so that their results can still be retrieved.
+			if (jobs.empty())
+				return;
+
+			job = std::move(jobs.front());
+			jobs.pop();
+		}
+
+		Result result;
+		result.render_interface = job.render_interface;
+		result.source = std::move(job.source);
+
+		{
+			RMLUI_ZoneScopedN("DecodeTexture");
+			if (!job.render_interface->LoadTextureData(result.data, result.dimensions, result.source))
+				result.data.reset();
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		results.push(std::move(result));
+	}
+}
+
+} // namespace Rml
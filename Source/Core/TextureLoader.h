@@ -0,0 +1,96 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#ifndef RMLUI_CORE_TEXTURELOADER_H
+#define RMLUI_CORE_TEXTURELOADER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+
+class RenderInterface;
+
+/**
+    Decodes file textures on a pool of worker threads, through RenderInterface::LoadTextureData(). The decoded pixel data
+    is handed back to the main thread, which is then responsible for generating the textures.
+ */
+
+class TextureLoader : NonCopyMoveable {
+public:
+	struct Result {
+		RenderInterface* render_interface = nullptr;
+		String source;
+		// Null if the texture could not be decoded.
+		UniquePtr<const byte[]> data;
+		Vector2i dimensions;
+	};
+
+	TextureLoader(int num_threads);
+	~TextureLoader();
+
+	/// Stops the worker threads once all queued textures have been decoded, their results can still be retrieved.
+	void Stop();
+
+	/// Queues the texture source for decoding on the worker threads.
+	void Request(RenderInterface* render_interface, const String& source);
+
+	/// Retrieves the next decoded texture, in the order they finished.
+	/// @return False if no decoded textures are available.
+	bool PopResult(Result& result);
+
+	/// Returns the number of textures requested and not yet retrieved.
+	int GetNumPending() const { return num_pending; }
+
+private:
+	struct Job {
+		RenderInterface* render_interface;
+		String source;
+	};
+
+	void Run();
+
+	Vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool stop = false;
+
+	// Protected by the mutex.
+	Queue<Job> jobs;
+	Queue<Result> results;
+
+	// Only accessed on the main thread.
+	int num_pending = 0;
+};
+
+} // namespace Rml
+#endif
@@ -73,27 +73,27 @@ void TextureResource::Reset()
 // Returns the resource's underlying texture.
 TextureHandle TextureResource::GetHandle(RenderInterface* render_interface)
 {
-	auto texture_iterator = texture_data.find(render_interface);
-	if (texture_iterator == texture_data.end())
-	{
-		Load(render_interface);
-		texture_iterator = texture_data.find(render_interface);
-	}
-
-	return texture_iterator->second.first;
+	return GetData(render_interface).handle;
 }
 
 // Returns the dimensions of the resource's texture.
 Vector2i TextureResource::GetDimensions(RenderInterface* render_interface)
 {
-	auto texture_iterator = texture_data.find(render_interface);
-	if (texture_iterator == texture_data.end())
+	return GetData(render_interface).dimensions;
+}
+
+void TextureResource::GetTexCoords(RenderInterface* render_interface, Vector2f& top_left, Vector2f& bottom_right)
+{
+	const TextureData& data = GetData(render_interface);
+	if (data.atlas_entry)
 	{
-		Load(render_interface);
-		texture_iterator = texture_data.find(render_interface);
+		TextureAtlas::GetTexCoords(data.atlas_entry, top_left, bottom_right);
+	}
+	else
+	{
+		top_left = Vector2f(0, 0);
+		bottom_right = Vector2f(1, 1);
 	}
-
-	return texture_iterator->second.second;
 }
 
 // Returns the resource's source.
@@ -108,11 +108,7 @@ void TextureResource::Release(RenderInterface* render_interface)
 	if (!render_interface)
 	{
 		for (auto& interface_data_pair : texture_data)
-		{
-			TextureHandle handle = interface_data_pair.second.first;
-			if (handle)
-				interface_data_pair.first->ReleaseTexture(handle);
-		}
+			ReleaseData(interface_data_pair.first, interface_data_pair.second);
 
 		texture_data.clear();
 	}
@@ -122,15 +118,91 @@ void TextureResource::Release(RenderInterface* render_interface)
 		if (texture_iterator == texture_data.end())
 			return;
 
-		TextureHandle handle = texture_iterator->second.first;
-		if (handle)
-			texture_iterator->first->ReleaseTexture(handle);
+		ReleaseData(texture_iterator->first, texture_iterator->second);
 
 		texture_data.erase(render_interface);
 	}
 }
 
-bool TextureResource::Load(RenderInterface* render_interface)
+const TextureResource::TextureData& TextureResource::GetData(RenderInterface* render_interface)
+{
+	last_used = TextureDatabase::GetRenderGeneration();
+
+	auto texture_iterator = texture_data.find(render_interface);
+	if (texture_iterator == texture_data.end())
+	{
+		Load(render_interface);
+		texture_iterator = texture_data.find(render_interface);
+	}
+
+	return texture_iterator->second;
+}
+
+void TextureResource::SetData(RenderInterface* render_interface, const TextureData& data)
+{
+	texture_data[render_interface] = data;
+
+	if (data.handle)
+	{
+		TextureDatabase::AddResidentTexture(GetByteSize(data), evicted);
+		evicted = false;
+	}
+}
+
+void TextureResource::ReleaseData(RenderInterface* render_interface, const TextureData& data)
+{
+	if (data.handle)
+		TextureDatabase::RemoveResidentTexture(GetByteSize(data));
+
+	if (data.atlas_entry)
+		TextureAtlas::Erase(data.atlas_entry);
+	else if (data.handle)
+		render_interface->ReleaseTexture(data.handle);
+}
+
+bool TextureResource::IsEvictable() const
+{
+	for (const auto& interface_data_pair : texture_data)
+	{
+		if (interface_data_pair.second.handle && !interface_data_pair.second.atlas_entry)
+			return true;
+	}
+	return false;
+}
+
+void TextureResource::Evict()
+{
+	Release();
+	evicted = true;
+}
+
+size_t TextureResource::GetByteSize(const TextureData& data)
+{
+	return size_t(data.dimensions.x) * size_t(data.dimensions.y) * 4;
+}
+
+bool TextureResource::IsLoading(RenderInterface* render_interface) const
+{
+	auto texture_iterator = texture_data.find(render_interface);
+	return texture_iterator != texture_data.end() && texture_iterator->second.loading;
+}
+
+void TextureResource::FinishAsyncLoad(RenderInterface* render_interface, UniquePtr<const byte[]> data, Vector2i dimensions)
+{
+	// Ignore the result if the texture was released while loading.
+	auto texture_iterator = texture_data.find(render_interface);
+	if (texture_iterator == texture_data.end() || !texture_iterator->second.loading)
+		return;
+
+	texture_data.erase(texture_iterator);
+
+	if (data)
+		Generate(render_interface, data.get(), dimensions);
+	else
+		Load(render_interface, false);
+}
+
+bool TextureResource::Load(RenderInterface* render_interface, bool allow_async)
 {
 	RMLUI_ZoneScoped;
 
@@ -145,7 +217,7 @@ bool TextureResource::Load(RenderInterface* render_interface)
 		if (!callback_fnc(source, data, dimensions) || !data)
 		{
 			Log::Message(Log::LT_WARNING, "Failed to generate texture from callback function %s.", source.c_str());
-			texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+			SetData(render_interface, TextureData());
 
 			return false;
 		}
@@ -155,29 +227,67 @@ bool TextureResource::Load(RenderInterface* render_interface)
 
 		if (success)
 		{
-			texture_data[render_interface] = TextureData(handle, dimensions);
+			SetData(render_interface, TextureData{handle, dimensions});
 		}
 		else
 		{
 			Log::Message(Log::LT_WARNING, "Failed to generate internal texture %s.", source.c_str());
-			texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+			SetData(render_interface, TextureData());
 		}
 
 		return success;
 	}
 
+	if (allow_async && TextureDatabase::LoadAsync(render_interface, source))
+	{
+		TextureData data;
+		data.loading = true;
+		SetData(render_interface, data);
+		return true;
+	}
+
+	// Load the pixel data ourselves when it may be packed into the texture atlas. Callback textures are never packed, as
+	// their users, such as font engines, may not be aware of the atlas region.
+	if (TextureAtlas::IsEnabled())
+	{
+		Vector2i dimensions;
+		UniquePtr<const byte[]> data;
+		if (render_interface->LoadTextureData(data, dimensions, source) && data)
+			return Generate(render_interface, data.get(), dimensions);
+	}
+
 	// No callback function, load the texture through the render interface.
 	TextureHandle handle;
 	Vector2i dimensions;
 	if (!render_interface->LoadTexture(handle, dimensions, source))
 	{
 		Log::Message(Log::LT_WARNING, "Failed to load texture from %s.", source.c_str());
-		texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+		SetData(render_interface, TextureData());
+
+		return false;
+	}
+
+	SetData(render_interface, TextureData{handle, dimensions});
+	return true;
+}
+
+bool TextureResource::Generate(RenderInterface* render_interface, const byte* data, Vector2i dimensions)
+{
+	if (TextureAtlasHandle atlas_entry = TextureAtlas::Insert(render_interface, data, dimensions))
+	{
+		SetData(render_interface, TextureData{TextureAtlas::GetTextureHandle(atlas_entry), dimensions, atlas_entry});
+		return true;
+	}
 
+	TextureHandle handle;
+	if (!render_interface->GenerateTexture(handle, data, dimensions))
+	{
+		Log::Message(Log::LT_WARNING, "Failed to generate texture from %s.", source.c_str());
+		SetData(render_interface, TextureData());
 		return false;
 	}
 
-	texture_data[render_interface] = TextureData(handle, dimensions);
+	SetData(render_interface, TextureData{handle, dimensions});
 	return true;
 }
 
@@ -31,6 +31,7 @@
 
 #include "../../Include/RmlUi/Core/Texture.h"
 #include "../../Include/RmlUi/Core/Traits.h"
+#include "TextureAtlas.h"
 
 namespace Rml {
 
@@ -58,6 +59,8 @@ public:
 	TextureHandle GetHandle(RenderInterface* render_interface);
 	/// Returns the dimensions of the resource's texture.
 	Vector2i GetDimensions(RenderInterface* render_interface);
+	/// Returns the region of the texture handle occupied by the texture, in normalized texture coordinates.
+	void GetTexCoords(RenderInterface* render_interface, Vector2f& top_left, Vector2f& bottom_right);
 
 	/// Returns the resource's source.
 	const String& GetSource() const;
@@ -65,22 +68,56 @@ public:
 	/// Releases the texture's handle.
 	void Release(RenderInterface* render_interface = nullptr);
 
+	/// Returns true if the texture is loaded in a texture of its own for any render interface. Textures packed into the
+	/// texture atlas are not evicted, as their memory is shared with other textures, and their location may change on reload.
+	bool IsEvictable() const;
+	/// Releases the texture for all render interfaces, it is reloaded on next use.
+	void Evict();
+	/// Returns the render generation the texture was last used in, see TextureDatabase::GetRenderGeneration().
+	uint64_t GetLastUsed() const { return last_used; }
+
+	/// Returns true while the texture is being loaded in the background for the given render interface.
+	bool IsLoading(RenderInterface* render_interface) const;
+	/// Generates the texture from the pixel data decoded in the background.
+	/// @param[in] data The decoded pixel data, or null if decoding failed, then the texture is loaded immediately instead.
+	void FinishAsyncLoad(RenderInterface* render_interface, UniquePtr<const byte[]> data, Vector2i dimensions);
+
 	/// For debugging. Returns true if the texture holds a reference to the given render interface, otherwise false.
 	inline bool HoldsRenderInterface(RenderInterface* render_interface) const { return texture_data.count(render_interface); }
 
 private:
 	void Reset();
 
+	struct TextureData {
+		TextureHandle handle = 0;
+		Vector2i dimensions;
+		// Set if the texture is packed into a texture atlas page, whose texture handle is then used.
+		TextureAtlasHandle atlas_entry = 0;
+		// Set while the texture is being decoded in the background, the handle and dimensions are then empty.
+		bool loading = false;
+	};
+
 	/// Attempts to load the texture from the source, or the callback function if set.
-	bool Load(RenderInterface* render_interface);
+	/// @param[in] allow_async Queues file textures for loading in the background if enabled.
+	bool Load(RenderInterface* render_interface, bool allow_async = true);
+	/// Returns the texture data for the given render interface, loading it if necessary.
+	const TextureData& GetData(RenderInterface* render_interface);
+	/// Packs the pixel data into the texture atlas if possible, otherwise generates a separate texture.
+	bool Generate(RenderInterface* render_interface, const byte* data, Vector2i dimensions);
+	void SetData(RenderInterface* render_interface, const TextureData& data);
+	void ReleaseData(RenderInterface* render_interface, const TextureData& data);
+	static size_t GetByteSize(const TextureData& data);
 
 	String source;
 
-	using TextureData = Pair<TextureHandle, Vector2i>;
 	using TextureDataMap = SmallUnorderedMap<RenderInterface*, TextureData>;
 	TextureDataMap texture_data;
 
 	UniquePtr<TextureCallback> texture_callback;
+
+	uint64_t last_used = 0;
+	// True if the texture was evicted and not yet reloaded.
+	bool evicted = false;
 };
 
 } // namespace Rml
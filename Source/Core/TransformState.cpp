@@ -63,6 +63,13 @@ bool TransformState::SetLocalPerspective(const Matrix4f* in_perspective)
 	return is_changed;
 }
 
+void TransformState::SetLocalTransform(const Matrix4f* in_local_transform)
+{
+	have_local_transform = (in_local_transform != nullptr);
+	if (in_local_transform)
+		local_transform = *in_local_transform;
+}
+
 const Matrix4f* TransformState::GetTransform() const
 {
 	return have_transform ? &transform : nullptr;
@@ -73,6 +80,11 @@ const Matrix4f* TransformState::GetLocalPerspective() const
 	return have_perspective ? &local_perspective : nullptr;
 }
 
+const Matrix4f* TransformState::GetLocalTransform() const
+{
+	return have_local_transform ? &local_transform : nullptr;
+}
+
 const Matrix4f* TransformState::GetInverseTransform() const
 {
 	if (!have_transform)
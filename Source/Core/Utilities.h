@@ -29,6 +29,8 @@
 #ifndef RMLUI_CORE_UTILITIES_H
 #define RMLUI_CORE_UTILITIES_H
 
+#include "../../Include/RmlUi/Core/Types.h"
+
 namespace Rml {
 
 namespace Utilities {
@@ -40,6 +42,18 @@ inline void HashCombine(std::size_t& seed, const T& v)
 	seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
 }
 
+// FNV-1a, for hashes which must be stable between builds and platforms.
+inline uint64_t HashStable(const String& string)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (char c : string)
+	{
+		hash ^= (uint64_t)(unsigned char)c;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
 }
 } // namespace Rml
 #endif
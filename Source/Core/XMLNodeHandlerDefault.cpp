@@ -27,6 +27,7 @@
  */
 
 #include "XMLNodeHandlerDefault.h"
+#include "ProfileRecorder.h"
 #include "XMLParseTools.h"
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/Element.h"
@@ -49,6 +50,7 @@ XMLNodeHandlerDefault::~XMLNodeHandlerDefault()
 Element* XMLNodeHandlerDefault::ElementStart(XMLParser* parser, const String& name, const XMLAttributes& attributes)
 {	
 	RMLUI_ZoneScopedC(0x556B2F);
+	RMLUI_RecordZone("InstanceElement");
 
 	// Determine the parent
 	Element* parent = parser->GetParseFrame()->element;
@@ -78,6 +80,7 @@ bool XMLNodeHandlerDefault::ElementEnd(XMLParser* RMLUI_UNUSED_PARAMETER(parser)
 bool XMLNodeHandlerDefault::ElementData(XMLParser* parser, const String& data, XMLDataType type)
 {
 	RMLUI_ZoneScopedC(0x006400);
+	RMLUI_RecordZone("InstanceText");
 
 	// Determine the parent
 	Element* parent = parser->GetParseFrame()->element;
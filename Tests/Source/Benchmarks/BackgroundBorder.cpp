@@ -142,3 +142,101 @@ TEST_CASE("backgrounds_and_borders")
 
 	document->Close();
 }
+
+static String document_animation_rml = R"(
+<rml>
+<head>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		div {
+			position: absolute;
+			width: 60px;
+			height: 40px;
+			background: #c3c3c3;
+			border: 4px #55f;
+			border-left-color: #f57;
+		}
+		.rounded {
+			border-radius: 10px;
+		}
+	</style>
+</head>
+
+<body>
+</body>
+</rml>
+)";
+
+TEST_CASE("backgrounds_and_borders.animation")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_animation_rml);
+	REQUIRE(document);
+	document->Show();
+
+	String rml;
+	for (int i = 0; i < 100; i++)
+		rml += CreateString(64, "<div style=\"left: %dpx; top: %dpx;\"/>", (i % 10) * 75, (i / 10) * 55);
+	document->SetInnerRML(rml);
+
+	ElementList elements;
+	document->QuerySelectorAll(elements, "div");
+	REQUIRE(elements.size() == 100);
+
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	nanobench::Bench bench;
+	bench.title("Animating 100 backgrounds and borders");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	int frame = 0;
+
+	auto run_benchmarks = [&](const String& suffix) {
+		bench.run("Border width (regenerate)" + suffix, [&] {
+			frame += 1;
+			const Property width(float(2 + frame % 2), Property::PX);
+			for (Element* element : elements)
+				element->SetProperty(PropertyId::BorderTopWidth, width);
+			context->Update();
+			context->Render();
+		});
+
+		bench.run("Color" + suffix, [&] {
+			frame += 1;
+			const Colourb color((byte)frame, 128, (byte)(255 - frame));
+			for (Element* element : elements)
+			{
+				element->SetProperty(PropertyId::BackgroundColor, Property(color, Property::COLOUR));
+				element->SetProperty(PropertyId::BorderTopColor, Property(color, Property::COLOUR));
+			}
+			context->Update();
+			context->Render();
+		});
+
+		bench.run("Size" + suffix, [&] {
+			frame += 1;
+			const Property width(float(60 + frame % 20), Property::PX);
+			for (Element* element : elements)
+				element->SetProperty(PropertyId::Width, width);
+			context->Update();
+			context->Render();
+		});
+	};
+
+	run_benchmarks("");
+
+	for (Element* element : elements)
+		element->SetClass("rounded", true);
+	context->Update();
+	context->Render();
+
+	run_benchmarks(" (rounded)");
+
+	document->Close();
+	context->Update();
+}
@@ -0,0 +1,194 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_rml = R"(
+<rml>
+<head>
+	<title>Context</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+			padding: 0;
+		}
+		.cell {
+			display: inline-block;
+			width: 18px;
+			height: 18px;
+			margin: 1px;
+			background-color: #888;
+		}
+		.mover {
+			position: absolute;
+			left: 0;
+			top: 100px;
+			width: 50px;
+			height: 50px;
+			background-color: #f00;
+		}
+	</style>
+</head>
+
+<body>
+</body>
+</rml>
+)";
+
+TEST_CASE("context.hit_test")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// A dense grid of 40 x 30 elements, covering the document.
+	String rml;
+	for (int i = 0; i < 40 * 30; i++)
+		rml += "<div class=\"cell\"/>";
+	document->SetInnerRML(rml);
+
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	nanobench::Bench bench;
+	bench.title("Hit testing 1200 elements");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	int i = 0;
+	auto next_point = [&i]() {
+		i = (i + 37) % (800 * 600);
+		return Vector2f(float(i % 800), float(i / 800));
+	};
+
+	bench.run("GetElementAtPoint (full search)", [&] {
+		// Starting the search at the document bypasses the spatial index.
+		Element* element = context->GetElementAtPoint(next_point(), nullptr, document);
+		nanobench::doNotOptimizeAway(element);
+	});
+
+	bench.run("GetElementAtPoint", [&] {
+		Element* element = context->GetElementAtPoint(next_point());
+		nanobench::doNotOptimizeAway(element);
+	});
+
+	bench.run("ProcessMouseMove", [&] {
+		const Vector2f point = next_point();
+		context->ProcessMouseMove(int(point.x), int(point.y), 0);
+	});
+
+	// Move an element between every query, as happens during animations.
+	Element* mover = document->AppendChild(document->CreateElement("div"));
+	mover->SetClass("mover", true);
+	context->Update();
+	context->Render();
+
+	int frame = 0;
+	auto next_frame = [&]() {
+		frame = (frame + 1) % 700;
+		mover->SetProperty("transform", CreateString(32, "translateX(%dpx)", frame));
+		context->Update();
+	};
+
+	bench.run("GetElementAtPoint (full search, animated)", [&] {
+		next_frame();
+		Element* element = context->GetElementAtPoint(next_point(), nullptr, document);
+		nanobench::doNotOptimizeAway(element);
+	});
+
+	bench.run("GetElementAtPoint (animated)", [&] {
+		next_frame();
+		Element* element = context->GetElementAtPoint(next_point());
+		nanobench::doNotOptimizeAway(element);
+	});
+
+	document->Close();
+	context->Update();
+}
+
+TEST_CASE("context.queue_input")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	String rml;
+	for (int i = 0; i < 40 * 30; i++)
+		rml += "<div class=\"cell\"/>";
+	document->SetInnerRML(rml);
+
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	nanobench::Bench bench;
+	bench.title("Frame with 16 mouse moves");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	// Emulate a high polling rate mouse, which moves across several elements in a single frame.
+	int x = 0;
+	auto frame = [&] {
+		for (int i = 0; i < 16; i++)
+		{
+			x = (x + 7) % 800;
+			context->ProcessMouseMove(x, 300, 0);
+		}
+		context->Update();
+	};
+
+	bench.run("Immediate input", frame);
+
+	context->SetQueueInput(true);
+	bench.run("Queued input", frame);
+	context->SetQueueInput(false);
+
+	document->Close();
+	context->Update();
+}
@@ -70,7 +70,8 @@ TEST_CASE("data_expressions")
 
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+		VariableIdList variable_ids = parser.ReleaseVariableIds();
+		DataInterpreter interpreter(program, addresses, variable_ids, interface);
 
 		bench.run(execute_name, [&] {
 			result &= interpreter.Run();
@@ -103,7 +104,8 @@ TEST_CASE("data_expressions")
 
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+		VariableIdList variable_ids = parser.ReleaseVariableIds();
+		DataInterpreter interpreter(program, addresses, variable_ids, interface);
 
 		bench.run(execute_name, [&] {
 			result &= interpreter.Run();
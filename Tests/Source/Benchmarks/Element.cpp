@@ -256,4 +256,190 @@ TEST_CASE("element.asymptotic_complexity")
 	}
 
 	document->Close();
-}
\ No newline at end of file
+}
+
+TEST_CASE("element.render_scroll_view")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	static const String scroll_document_rml = R"(
+<rml>
+<head>
+	<title>Scroll view</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+			padding: 0;
+			overflow: visible;
+		}
+		#scroll {
+			width: 400px;
+			height: 300px;
+			overflow: auto;
+		}
+		#scroll div {
+			height: 30px;
+			border: 1px #000;
+			background-color: #ddd;
+		}
+	</style>
+</head>
+<body>
+<div id="scroll"/>
+</body>
+</rml>
+)";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(scroll_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* scroll = document->GetElementById("scroll");
+	REQUIRE(scroll);
+
+	String rml;
+	for (int i = 0; i < 1000; i++)
+		rml += CreateString(64, "<div>Item %d</div>", i);
+	scroll->SetInnerRML(rml);
+
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	MESSAGE("\nScroll view with 1000 items.\n" << TestsShell::GetRenderStats());
+
+	nanobench::Bench bench;
+	bench.title("Render scroll view");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("Render (top)", [&] {
+		context->Render();
+	});
+
+	scroll->SetScrollTop(15000.f);
+	context->Update();
+
+	bench.run("Render (middle)", [&] {
+		context->Render();
+	});
+
+	document->Close();
+}
+
+TEST_CASE("element.set_property")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	// Emulates scripts positioning a few hundred elements every frame.
+	constexpr int num_elements = 300;
+	String rml;
+	for (int i = 0; i < num_elements; i++)
+		rml += "<div style=\"position: absolute;\"/>";
+	el->SetInnerRML(rml);
+
+	ElementList elements;
+	for (int i = 0; i < el->GetNumChildren(); i++)
+		elements.push_back(el->GetChild(i));
+	REQUIRE(elements.size() == num_elements);
+
+	context->Update();
+
+	nanobench::Bench bench;
+	bench.title("Set properties on 300 elements");
+	bench.minEpochIterations(10);
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	StringList repeated_values;
+	for (int i = 0; i < 16; i++)
+		repeated_values.push_back(CreateString(16, "%.1fpx", 10.f + 0.5f * i));
+
+	int frame = 0;
+	bench.run("SetProperty(string, repeated values)", [&] {
+		frame += 1;
+		for (int i = 0; i < num_elements; i++)
+		{
+			elements[i]->SetProperty("left", repeated_values[(frame + i) % repeated_values.size()]);
+			elements[i]->SetProperty("margin", "1px 2px");
+		}
+	});
+
+	bench.run("SetProperty(string, unique values)", [&] {
+		frame += 1;
+		for (int i = 0; i < num_elements; i++)
+		{
+			elements[i]->SetProperty("left", CreateString(16, "%dpx", frame * num_elements + i));
+			elements[i]->SetProperty("margin", CreateString(24, "%dpx 2px", frame * num_elements + i));
+		}
+	});
+
+	bench.run("SetProperty(typed)", [&] {
+		frame += 1;
+		for (int i = 0; i < num_elements; i++)
+		{
+			elements[i]->SetProperty(PropertyId::Left, 10.f + 0.5f * ((frame + i) % 16), Property::PX);
+			for (PropertyId id : {PropertyId::MarginTop, PropertyId::MarginBottom})
+				elements[i]->SetProperty(id, 1.f, Property::PX);
+			for (PropertyId id : {PropertyId::MarginLeft, PropertyId::MarginRight})
+				elements[i]->SetProperty(id, 2.f, Property::PX);
+		}
+	});
+
+	document->Close();
+	context->Update();
+}
+
+TEST_CASE("element.clone")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	// 100 items of five elements each, including text.
+	String rml;
+	for (int i = 0; i < 100; i++)
+		rml += CreateString(256, R"(<div class="item"><span class="name" id="name%d">Item %d</span><p><em>Details</em></p><button>Open</button></div>)", i, i);
+	el->SetInnerRML(rml);
+
+	REQUIRE(GetNumDescendentElements(el) >= 500);
+
+	nanobench::Bench bench;
+	bench.title("Clone 500-element subtree");
+	bench.minEpochIterations(10);
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("SetInnerRML(GetInnerRML())", [&] {
+		ElementPtr copy = document->CreateElement("div");
+		copy->SetInnerRML(el->GetInnerRML());
+		nanobench::doNotOptimizeAway(copy);
+	});
+
+	bench.run("Clone", [&] {
+		ElementPtr clone = el->Clone();
+		nanobench::doNotOptimizeAway(clone);
+	});
+
+	document->Close();
+	context->Update();
+}
@@ -29,9 +29,11 @@
 #include "../Common/TestsShell.h"
 #include "../Common/TestsInterface.h"
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
 #include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
 #include <RmlUi/Core/Types.h>
 
 #include <doctest.h>
@@ -113,6 +115,15 @@ TEST_CASE("elementdocument")
 			context->Update();
 		});
 
+		String compiled_document;
+		Factory::CompileDocument(compiled_document, document_rml, "[document from memory]");
+
+		bench.run("LoadCompiledDocument", [&] {
+			ElementDocument* document = context->LoadCompiledDocument(compiled_document, "[document from memory]");
+			document->Close();
+			context->Update();
+		});
+
 		bench.run("LoadDocument + Show", [&] {
 			ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
 			document->Show();
@@ -183,4 +194,147 @@ TEST_CASE("elementdocument")
 			context->Update();
 		});
 	}
+	{
+		nanobench::Bench bench;
+		bench.title("ElementDocument from files w/ClearStyleSheetCache");
+		bench.minEpochIterations(10);
+		bench.timeUnit(std::chrono::microseconds(1), "us");
+		bench.relative(true);
+
+		const StringList document_paths = {
+			"basic/benchmark/data/benchmark.rml",
+			"basic/animation/data/animation.rml",
+			"basic/transform/data/transform.rml",
+			"assets/demo.rml",
+		};
+
+		auto LoadDocuments = [&] {
+			for (const String& document_path : document_paths)
+			{
+				ElementDocument* document = context->LoadDocument(document_path);
+				document->Close();
+			}
+			context->Update();
+		};
+
+		bench.run("Clear + LoadDocument", [&] {
+			Factory::ClearStyleSheetCache();
+			Factory::ClearTemplateCache();
+			LoadDocuments();
+		});
+
+		bench.run("Clear + PreloadDocuments (immediate) + LoadDocument", [&] {
+			Factory::ClearStyleSheetCache();
+			Factory::ClearTemplateCache();
+			PreloadDocuments(document_paths, 0);
+			LoadDocuments();
+		});
+
+		bench.run("Clear + PreloadDocuments + LoadDocument", [&] {
+			Factory::ClearStyleSheetCache();
+			Factory::ClearTemplateCache();
+			PreloadDocuments(document_paths, (int)document_paths.size());
+			LoadDocuments();
+		});
+	}
+}
+
+TEST_CASE("elementdocument.reload_style_sheet")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	{
+		nanobench::Bench bench;
+		bench.title("Change style sheet with 100 rules, 2000 elements");
+		bench.timeUnit(std::chrono::microseconds(1), "us");
+		bench.relative(true);
+
+		String rml = "<rml><head><link type=\"text/rcss\" href=\"/../Tests/Data/style.rcss\"/></head><body>";
+		for (int i = 0; i < 1000; i++)
+			rml += CreateString(64, "<div class=\"row\"><div class=\"c%d\">%d</div></div>", i % 100, i);
+		rml += "</body></rml>";
+
+		String rcss;
+		for (int i = 0; i < 100; i++)
+			rcss += CreateString(64, ".c%d { width: %dpx; height: 10px; }\n", i, i + 10);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(rml);
+		REQUIRE(document);
+		document->Show();
+		context->Update();
+		context->Render();
+
+		bench.run("InstanceStyleSheetString", [&] {
+			SharedPtr<StyleSheetContainer> sheet = Factory::InstanceStyleSheetString(rcss);
+			nanobench::doNotOptimizeAway(sheet);
+		});
+
+		// Only a single rule differs between the sheets, which matches one percent of the elements.
+		int index = 0;
+		bench.run("InstanceStyleSheetString + SetStyleSheetContainer + Update", [&] {
+			index = (index + 1) % 2;
+			document->SetStyleSheetContainer(Factory::InstanceStyleSheetString(rcss + (index ? ".c0 { color: #f00; }" : ".c0 { color: #00f; }")));
+			context->Update();
+		});
+
+		document->Close();
+		context->Update();
+	}
+
+	{
+		nanobench::Bench bench;
+		bench.title("Reload style sheet of demo document");
+		bench.minEpochIterations(10);
+		bench.timeUnit(std::chrono::microseconds(1), "us");
+		bench.relative(true);
+
+		ElementDocument* document = context->LoadDocument("assets/demo.rml");
+		REQUIRE(document);
+		document->Show();
+		context->Update();
+		context->Render();
+
+		bench.run("ReloadStyleSheet + Update", [&] {
+			document->ReloadStyleSheet();
+			context->Update();
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
+
+TEST_CASE("elementdocument.profile_recording")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	nanobench::Bench bench;
+	bench.title("ElementDocument w/ClearStyleSheetCache and profile recording");
+	bench.minEpochIterations(10);
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	auto load_document = [&] {
+		Factory::ClearStyleSheetCache();
+		ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+		document->Show();
+		context->Update();
+		document->Close();
+		context->Update();
+	};
+
+	bench.run("Clear + LoadDocument + Show + Update", load_document);
+
+	SetProfileRecording(true);
+	bench.run("Clear + LoadDocument + Show + Update (recording)", [&] {
+		ClearProfileRecording();
+		load_document();
+	});
+	SetProfileRecording(false);
+
+	// Report the breakdown of the last recorded load.
+	MESSAGE(GetProfileRecording(ProfileRecordingFormat::Json));
+	ClearProfileRecording();
 }
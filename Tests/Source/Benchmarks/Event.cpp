@@ -0,0 +1,171 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_rml = R"(
+<rml>
+<head>
+	<title>Event</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+		}
+		div {
+			padding: 1px;
+		}
+	</style>
+</head>
+
+<body>
+</body>
+</rml>
+)";
+
+static String GenerateNestedRml(const int depth)
+{
+	String rml;
+	for (int i = 0; i < depth; i++)
+		rml += "<div>";
+	for (int i = 0; i < depth; i++)
+		rml += "</div>";
+	return rml;
+}
+
+class CountingListener : public EventListener {
+public:
+	void ProcessEvent(Event& /*event*/) override { num_events += 1; }
+	int num_events = 0;
+};
+
+class ParameterListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override { sum += event.GetParameter("mouse_x", 0); }
+	int sum = 0;
+};
+
+TEST_CASE("event.mousemove")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	constexpr int depth = 50;
+	document->SetInnerRML(GenerateNestedRml(depth));
+
+	ElementList elements;
+	for (Element* element = document->GetFirstChild(); element; element = element->GetFirstChild())
+		elements.push_back(element);
+	REQUIRE(elements.size() == depth);
+
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	Element* target = elements.back();
+
+	nanobench::Bench bench;
+	bench.title("Mousemove over 50-deep tree");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	int x = 0;
+	auto move_mouse = [&] {
+		// Stay within the innermost element, so that the hover chain remains the same.
+		x = (x + 1) % 100;
+		context->ProcessMouseMove(200 + x, 100, 0);
+	};
+
+	bench.run("ProcessMouseMove (no listeners)", move_mouse);
+
+	bench.run("DispatchEvent (no listeners)", [&] {
+		target->DispatchEvent(EventId::Mousemove, Dictionary());
+	});
+
+	CountingListener click_listener;
+	for (Element* element : elements)
+		element->AddEventListener(EventId::Click, &click_listener);
+
+	bench.run("ProcessMouseMove (click listeners on every element)", move_mouse);
+
+	for (Element* element : elements)
+		element->RemoveEventListener(EventId::Click, &click_listener);
+
+	CountingListener root_listener;
+	document->AddEventListener(EventId::Mousemove, &root_listener);
+
+	bench.run("ProcessMouseMove (listener on document)", move_mouse);
+
+	ParameterListener parameter_listener;
+	document->AddEventListener(EventId::Mousemove, &parameter_listener);
+
+	bench.run("ProcessMouseMove (listener on document reading parameters)", move_mouse);
+
+	document->RemoveEventListener(EventId::Mousemove, &parameter_listener);
+
+	CountingListener element_listener;
+	for (Element* element : elements)
+	{
+		element->AddEventListener(EventId::Mousemove, &element_listener);
+		element->AddEventListener(EventId::Mousemove, &element_listener, true);
+	}
+
+	bench.run("ProcessMouseMove (listeners on every element)", move_mouse);
+
+	CHECK(root_listener.num_events > 0);
+	CHECK(element_listener.num_events > 0);
+	CHECK(parameter_listener.sum > 0);
+
+	for (Element* element : elements)
+	{
+		element->RemoveEventListener(EventId::Mousemove, &element_listener);
+		element->RemoveEventListener(EventId::Mousemove, &element_listener, true);
+	}
+	document->RemoveEventListener(EventId::Mousemove, &root_listener);
+
+	document->Close();
+	context->Update();
+}
@@ -0,0 +1,88 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/PropertyDictionary.h>
+#include <RmlUi/Core/StyleSheetSpecification.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+TEST_CASE("stylesheetspecification.lookup")
+{
+	// Make sure the library is initialized.
+	TestsShell::GetContext();
+
+	StringList property_names;
+	for (int i = 1; i < (int)PropertyId::NumDefinedIds; i++)
+		property_names.push_back(StyleSheetSpecification::GetPropertyName((PropertyId)i));
+
+	const StringList shorthand_names = {"margin", "padding", "border", "border-top", "overflow", "background", "font", "gap", "flex"};
+	const StringList unknown_names = {"colour", "margin-start", "x", "transform-origin-w", "--custom-property"};
+
+	nanobench::Bench bench;
+	bench.title("StyleSheetSpecification lookup");
+	bench.timeUnit(std::chrono::nanoseconds(1), "ns");
+	bench.relative(true);
+	bench.minEpochIterations(100);
+
+	bench.run("GetPropertyId", [&] {
+		int sum = 0;
+		for (const String& name : property_names)
+			sum += (int)StyleSheetSpecification::GetPropertyId(name);
+		nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run("GetShorthandId", [&] {
+		int sum = 0;
+		for (const String& name : shorthand_names)
+			sum += (int)StyleSheetSpecification::GetShorthandId(name);
+		nanobench::doNotOptimizeAway(sum);
+	});
+
+	bench.run("GetPropertyId (unknown names)", [&] {
+		int sum = 0;
+		for (const String& name : unknown_names)
+			sum += (int)StyleSheetSpecification::GetPropertyId(name);
+		nanobench::doNotOptimizeAway(sum);
+	});
+
+	PropertyDictionary dictionary;
+	bench.run("ParsePropertyDeclaration", [&] {
+		// Shorthands are looked up as properties first.
+		StyleSheetSpecification::ParsePropertyDeclaration(dictionary, "margin-left", "5px");
+		StyleSheetSpecification::ParsePropertyDeclaration(dictionary, "padding", "1px 2px");
+		StyleSheetSpecification::ParsePropertyDeclaration(dictionary, "display", "block");
+		StyleSheetSpecification::ParsePropertyDeclaration(dictionary, "border", "1px #f00");
+	});
+}
@@ -0,0 +1,82 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include <RmlUi/Core/BaseXMLParser.h>
+#include <RmlUi/Core/StreamMemory.h>
+#include <RmlUi/Core/Types.h>
+#include <string.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+class CountingParser : public BaseXMLParser {
+public:
+	void HandleElementStart(const String& /*name*/, const XMLAttributes& attributes) override { num_events += 1 + (int)attributes.size(); }
+	void HandleElementEnd(const String& /*name*/) override { num_events += 1; }
+	void HandleData(const String& /*data*/, XMLDataType /*type*/) override { num_events += 1; }
+
+	int num_events = 0;
+};
+
+TEST_CASE("xmlparser")
+{
+	String rml = "<rml>\n<body>\n";
+	for (int i = 0; i < 5000; i++)
+	{
+		rml += "\t<div class=\"row\" id=\"row" + ToString(i) + "\" style=\"width: 100px; height: 20px;\">\n";
+		rml += "\t\t<span class='label'>Some text content for row &amp; more text with {{ value < 10 ? 'a' : 'b' }}.</span>\n";
+		rml += "\t\t<!-- A comment -->\n\t\t<input type=\"checkbox\" checked/>\n\t</div>\n";
+	}
+	rml += "</body>\n</rml>\n";
+
+	nanobench::Bench bench;
+	bench.title("XML parser");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+	bench.batch(rml.size());
+	bench.unit("byte");
+
+	String buffer(rml.size(), '\0');
+	bench.run("memcpy", [&] {
+		memcpy(&buffer[0], rml.data(), rml.size());
+		nanobench::doNotOptimizeAway(buffer);
+	});
+
+	bench.run("BaseXMLParser::Parse", [&] {
+		StreamMemory stream((const byte*)rml.data(), rml.size());
+		stream.SetSourceURL("benchmark.rml");
+
+		CountingParser parser;
+		parser.Parse(&stream);
+		nanobench::doNotOptimizeAway(parser.num_events);
+	});
+}
@@ -77,6 +77,30 @@ void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_v
 	counters.render_calls += 1;
 }
 
+bool TestsRenderInterface::CreateGeometryBuffer(Rml::GeometryBufferHandle& buffer, int /*vertex_capacity*/, int /*index_capacity*/)
+{
+	counters.create_geometry_buffer += 1;
+	buffer = 1;
+	return true;
+}
+
+void TestsRenderInterface::UpdateGeometryBuffer(Rml::GeometryBufferHandle /*buffer*/, int /*vertex_offset*/, const Rml::Vertex* /*vertices*/,
+	int /*num_vertices*/, int /*index_offset*/, const int* /*indices*/, int /*num_indices*/)
+{
+	counters.update_geometry_buffer += 1;
+}
+
+void TestsRenderInterface::RenderGeometryBuffer(Rml::GeometryBufferHandle /*buffer*/, int /*base_vertex*/, int /*index_offset*/,
+	int /*num_indices*/, Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
+{
+	counters.render_calls += 1;
+}
+
+void TestsRenderInterface::ReleaseGeometryBuffer(Rml::GeometryBufferHandle /*buffer*/)
+{
+	counters.release_geometry_buffer += 1;
+}
+
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
 {
 	counters.enable_scissor += 1;
@@ -112,3 +136,16 @@ void TestsRenderInterface::SetTransform(const Rml::Matrix4f* /*transform*/)
 {
 	counters.set_transform += 1;
 }
+
+bool TestsRenderInterface::BeginRenderToTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i origin, Rml::Vector2i dimensions)
+{
+	counters.begin_render_to_texture += 1;
+	render_to_texture_regions.push_back(TextureRegion{ origin, dimensions });
+	texture_handle = 1;
+	return true;
+}
+
+void TestsRenderInterface::EndRenderToTexture()
+{
+	counters.end_render_to_texture += 1;
+}
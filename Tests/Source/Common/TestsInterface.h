@@ -61,10 +61,22 @@ public:
 		size_t generate_texture;
 		size_t release_texture;
 		size_t set_transform;
+		size_t begin_render_to_texture;
+		size_t end_render_to_texture;
+		size_t create_geometry_buffer;
+		size_t update_geometry_buffer;
+		size_t release_geometry_buffer;
 	};
 
 	void RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture, const Rml::Vector2f& translation) override;
 
+	bool CreateGeometryBuffer(Rml::GeometryBufferHandle& buffer, int vertex_capacity, int index_capacity) override;
+	void UpdateGeometryBuffer(Rml::GeometryBufferHandle buffer, int vertex_offset, const Rml::Vertex* vertices, int num_vertices, int index_offset,
+		const int* indices, int num_indices) override;
+	void RenderGeometryBuffer(Rml::GeometryBufferHandle buffer, int base_vertex, int index_offset, int num_indices, Rml::TextureHandle texture,
+		const Rml::Vector2f& translation) override;
+	void ReleaseGeometryBuffer(Rml::GeometryBufferHandle buffer) override;
+
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(int x, int y, int width, int height) override;
 
@@ -74,15 +86,30 @@ public:
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
 
+	bool BeginRenderToTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i origin, Rml::Vector2i dimensions) override;
+	void EndRenderToTexture() override;
+
+	struct TextureRegion {
+		Rml::Vector2i origin;
+		Rml::Vector2i dimensions;
+	};
+
 	const Counters& GetCounters() const {
 		return counters;
 	}
 
+	// The regions rendered to texture since the counters were last reset.
+	const Rml::Vector<TextureRegion>& GetRenderToTextureRegions() const {
+		return render_to_texture_regions;
+	}
+
 	void ResetCounters() {
 		counters = {};
+		render_to_texture_regions.clear();
 	}
 
 private:
 	Counters counters = {};
+	Rml::Vector<TextureRegion> render_to_texture_regions;
 };
 #endif
@@ -193,17 +193,28 @@ Rml::String TestsShell::GetRenderStats()
 		"  Texture load: %zu\n"
 		"  Texture generate: %zu\n"
 		"  Texture release: %zu\n"
-		"  Transform set: %zu",
+		"  Transform set: %zu\n"
+		"  Render to texture: %zu",
 		counters.render_calls,
 		counters.enable_scissor,
 		counters.set_scissor,
 		counters.load_texture,
 		counters.generate_texture,
 		counters.release_texture,
-		counters.set_transform
+		counters.set_transform,
+		counters.begin_render_to_texture
 	);
 
 #endif
 
 	return result;
 }
+
+TestsRenderInterface* TestsShell::GetTestsRenderInterface()
+{
+#if !defined(RMLUI_TESTS_USE_SHELL)
+	return &shell_render_interface;
+#else
+	return nullptr;
+#endif
+}
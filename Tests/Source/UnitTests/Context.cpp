@@ -0,0 +1,289 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventInstancer.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/Factory.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_hit_test_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+			padding: 0;
+			overflow: visible;
+		}
+		div {
+			position: absolute;
+			width: 100px;
+			height: 100px;
+		}
+		#a { left: 0; top: 0; }
+		#b { left: 50px; top: 50px; z-index: 1; }
+		#none { left: 200px; top: 0; pointer-events: none; }
+		#clip { left: 0; top: 200px; height: 50px; overflow: hidden; }
+		#inner { position: static; width: 300px; height: 20px; }
+		#transformed { left: 400px; top: 200px; transform: translateX(-100px); }
+	</style>
+</head>
+
+<body>
+<div id="a"/>
+<div id="b"/>
+<div id="none"/>
+<div id="clip"><div id="inner"/></div>
+<div id="transformed"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("Context.GetElementAtPoint")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hit_test_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	auto GetIdAtPoint = [&](Vector2f point) -> String {
+		// The spatial index is only used once the tree has remained unchanged between calls, make sure that
+		// we test both the full search and the indexed lookup, and that they agree.
+		Element* first = context->GetElementAtPoint(point);
+		Element* second = context->GetElementAtPoint(point);
+		CHECK(first == second);
+		return second ? second->GetId() : String("<none>");
+	};
+
+	CHECK(GetIdAtPoint({25, 25}) == "a");
+	CHECK(GetIdAtPoint({75, 75}) == "b");
+	CHECK(GetIdAtPoint({125, 125}) == "b");
+	CHECK(GetIdAtPoint({225, 25}) == document->GetId());
+	CHECK(GetIdAtPoint({50, 210}) == "inner");
+	CHECK(GetIdAtPoint({150, 210}) == document->GetId());
+	CHECK(GetIdAtPoint({350, 250}) == "transformed");
+	CHECK(GetIdAtPoint({450, 250}) == document->GetId());
+	CHECK(GetIdAtPoint({900, 250}) == context->GetRootElement()->GetId());
+
+	CHECK(context->GetElementAtPoint({75, 75}, document->GetElementById("b"))->GetId() == "a");
+	CHECK(context->GetElementAtPoint({75, 75}, document) == context->GetRootElement());
+
+	// Changes to the tree should be reflected in the following queries.
+	document->GetElementById("a")->SetProperty("left", "600px");
+	context->Update();
+	context->Render();
+
+	CHECK(GetIdAtPoint({25, 25}) == document->GetId());
+	CHECK(GetIdAtPoint({625, 25}) == "a");
+
+	document->GetElementById("none")->SetProperty("pointer-events", "auto");
+	context->Update();
+	CHECK(GetIdAtPoint({225, 25}) == "none");
+
+	document->GetElementById("inner")->SetProperty("width", "50px");
+	context->Update();
+	CHECK(GetIdAtPoint({75, 210}) == "clip");
+
+	// Elements changing every frame, such as during animations, are moved within the grid immediately.
+	Element* a = document->GetElementById("a");
+	Element* transformed = document->GetElementById("transformed");
+	for (int i = 1; i <= 5; i++)
+	{
+		a->SetProperty("top", CreateString(16, "%dpx", i * 100));
+		transformed->SetProperty("transform", CreateString(32, "translateX(%dpx)", i * 50));
+		context->Update();
+		context->Render();
+
+		CHECK(context->GetElementAtPoint({625, float(i * 100 + 25)}) == a);
+		CHECK(context->GetElementAtPoint({625, float(i * 100 - 25)}) != a);
+		CHECK(context->GetElementAtPoint({float(i * 50 + 425), 250}) == transformed);
+	}
+
+	// Documents are ordered below the root element, make sure changes to their order are picked up.
+	ElementDocument* other_document = context->LoadDocumentFromMemory(document_hit_test_rml);
+	REQUIRE(other_document);
+	other_document->Show();
+	context->Update();
+	context->Render();
+
+	CHECK(GetIdAtPoint({75, 75}) == "b");
+	CHECK(context->GetElementAtPoint({75, 75}) == other_document->GetElementById("b"));
+
+	document->PullToFront();
+	context->Update();
+	context->Render();
+	CHECK(context->GetElementAtPoint({75, 75}) == document->GetElementById("b"));
+
+	other_document->Close();
+	context->Update();
+
+	document->RemoveChild(document->GetElementById("b"));
+	CHECK(GetIdAtPoint({75, 75}) == document->GetId());
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Context.QueueInput")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hit_test_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	struct RecordingListener : EventListener {
+		void ProcessEvent(Event& event) override
+		{
+			String entry = event.GetType();
+			if (event == EventId::Mousemove)
+				entry += CreateString(32, "(%d,%d)", event.GetParameter("mouse_x", 0), event.GetParameter("mouse_y", 0));
+			else if (event == EventId::Mousescroll)
+				entry += CreateString(32, "(%g)", event.GetParameter("wheel_delta", 0.f));
+			else if (event == EventId::Textinput)
+				entry += "(" + event.GetParameter<String>("text", "") + ")";
+			events.push_back(entry);
+		}
+		StringList events;
+	} listener;
+
+	for (EventId id : {EventId::Mousemove, EventId::Mousedown, EventId::Mousescroll, EventId::Keydown, EventId::Textinput})
+		context->GetRootElement()->AddEventListener(id, &listener);
+
+	context->SetQueueInput(true);
+	CHECK(context->GetQueueInput());
+
+	context->ProcessMouseMove(10, 10, 0);
+	context->ProcessMouseMove(20, 10, 0);
+	context->ProcessMouseMove(25, 25, 0);
+	context->ProcessMouseButtonDown(0, 0);
+	context->ProcessKeyDown(Input::KI_A, 0);
+	context->ProcessTextInput("a");
+	context->ProcessMouseWheel(1.f, 0);
+	context->ProcessMouseWheel(2.f, 0);
+	context->ProcessMouseMove(75, 75, 0);
+
+	// Nothing should be processed until the next update.
+	CHECK(listener.events.empty());
+
+	context->Update();
+
+	const StringList expected_events = {
+		"mousemove(25,25)",
+		"mousedown",
+		"keydown",
+		"textinput(a)",
+		"mousescroll(3)",
+		"mousemove(75,75)",
+	};
+	CHECK(listener.events == expected_events);
+
+	// Disabling queued input processes any pending input immediately.
+	listener.events.clear();
+	context->ProcessMouseMove(80, 80, 0);
+	CHECK(listener.events.empty());
+
+	context->SetQueueInput(false);
+	CHECK(listener.events == StringList{"mousemove(80,80)"});
+
+	for (EventId id : {EventId::Mousemove, EventId::Mousedown, EventId::Mousescroll, EventId::Keydown, EventId::Textinput})
+		context->GetRootElement()->RemoveEventListener(id, &listener);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Context.CustomEventInstancer")
+{
+	// Events from custom instancers, such as those of scripting plugins, must have all their parameters set on construction.
+	struct RecordingEvent : Event {
+		RecordingEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible) :
+			Event(target, id, type, parameters, interruptible)
+		{
+			if (const Variant* mouse_x = GetIf(this->parameters, "mouse_x"))
+				constructed_mouse_x = mouse_x->Get<int>();
+		}
+		int constructed_mouse_x = -1;
+	};
+	struct RecordingInstancer : EventInstancer {
+		EventPtr InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible) override
+		{
+			return EventPtr(new RecordingEvent(target, id, type, parameters, interruptible));
+		}
+		void ReleaseEvent(Event* event) override { delete event; }
+		void Release() override {}
+	} instancer;
+
+	struct MousemoveListener : EventListener {
+		void ProcessEvent(Event& event) override { mouse_x.push_back(static_cast<RecordingEvent&>(event).constructed_mouse_x); }
+		Vector<int> mouse_x;
+	} listener;
+
+	// The event instancer must be registered before initialisation.
+	TestsShell::ShutdownShell();
+	Factory::RegisterEventInstancer(&instancer);
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hit_test_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	context->GetRootElement()->AddEventListener(EventId::Mousemove, &listener);
+	context->ProcessMouseMove(25, 25, 0);
+	context->ProcessMouseMove(30, 25, 0);
+	context->GetRootElement()->RemoveEventListener(EventId::Mousemove, &listener);
+
+	CHECK(listener.mouse_x == Vector<int>{25, 30});
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -29,10 +29,16 @@
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/Texture.h>
 #include <doctest.h>
 #include <algorithm>
+#include <atomic>
+#include <string.h>
+#include <thread>
 
 using namespace Rml;
 
@@ -122,3 +128,399 @@ TEST_CASE("core.texture_source_list")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("core.texture_atlas")
+{
+	TestsShell::GetContext();
+
+	class AtlasRenderInterface : public RenderInterface {
+	public:
+		void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/,
+			const Vector2f& /*translation*/) override
+		{}
+		void EnableScissorRegion(bool /*enable*/) override {}
+		void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+		bool LoadTextureData(UniquePtr<const byte[]>& data, Vector2i& dimensions, const String& source) override
+		{
+			dimensions = (source.find("large") != String::npos ? Vector2i(300, 200) : Vector2i(32, 16));
+			byte* pixels = new byte[dimensions.x * dimensions.y * 4];
+			memset(pixels, 255, dimensions.x * dimensions.y * 4);
+			data.reset(pixels);
+			return true;
+		}
+		bool GenerateTexture(TextureHandle& texture_handle, const byte* /*source*/, const Vector2i& /*source_dimensions*/) override
+		{
+			num_textures += 1;
+			texture_handle = ++last_handle;
+			return true;
+		}
+		bool UpdateTexture(TextureHandle /*texture_handle*/, const byte* /*source*/, Vector2i origin, Vector2i dimensions) override
+		{
+			num_updates += 1;
+			last_update_origin = origin;
+			last_update_dimensions = dimensions;
+			return true;
+		}
+		void ReleaseTexture(TextureHandle /*texture*/) override { num_textures -= 1; }
+
+		int num_textures = 0;
+		int num_updates = 0;
+		TextureHandle last_handle = 0;
+		Vector2i last_update_origin, last_update_dimensions;
+	} render_interface;
+
+	Rml::SetTextureAtlas(128, 256);
+
+	{
+		Texture small_a, small_b, large;
+		small_a.Set("/assets/small_a.tga");
+		small_b.Set("/assets/small_b.tga");
+		large.Set("/assets/large.tga");
+
+		// Both small textures should be packed into the same page, while the large one gets its own texture.
+		const TextureHandle handle_a = small_a.GetHandle(&render_interface);
+		const TextureHandle handle_b = small_b.GetHandle(&render_interface);
+		const TextureHandle handle_large = large.GetHandle(&render_interface);
+		CHECK(handle_a != 0);
+		CHECK(handle_a == handle_b);
+		CHECK(handle_large != handle_a);
+		CHECK(render_interface.num_textures == 2);
+		CHECK(render_interface.num_updates == 2);
+		CHECK(small_b.GetDimensions(&render_interface) == Vector2i(32, 16));
+
+		// The textures are uploaded with a border of one pixel.
+		CHECK(render_interface.last_update_origin == Vector2i(34, 0));
+		CHECK(render_interface.last_update_dimensions == Vector2i(34, 18));
+
+		Vector2f top_left, bottom_right;
+		small_b.GetTexCoords(&render_interface, top_left, bottom_right);
+		CHECK(top_left == Vector2f(35.f / 256.f, 1.f / 256.f));
+		CHECK(bottom_right == Vector2f(67.f / 256.f, 17.f / 256.f));
+
+		large.GetTexCoords(&render_interface, top_left, bottom_right);
+		CHECK(top_left == Vector2f(0, 0));
+		CHECK(bottom_right == Vector2f(1, 1));
+
+		TextureAtlasStatistics statistics = Rml::GetTextureAtlasStatistics();
+		CHECK(statistics.num_pages == 1);
+		CHECK(statistics.num_textures == 2);
+		CHECK(statistics.used_area == 2 * 34 * 18);
+		CHECK(statistics.total_area == 256 * 256);
+
+		// Releasing the last texture in a page should release the page.
+		Rml::ReleaseTextures(&render_interface);
+		CHECK(render_interface.num_textures == 0);
+		CHECK(Rml::GetTextureAtlasStatistics().num_pages == 0);
+	}
+
+	Rml::SetTextureAtlas(0);
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_async_textures_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; }
+		div { display: block; width: 20px; height: 20px; decorator: image(/assets/async_decorator.tga); }
+	</style>
+</head>
+<body>
+	<img id="image" src="/assets/async_image.tga"/>
+	<div/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.async_texture_loading")
+{
+	TestsShell::GetContext();
+
+	class AsyncRenderInterface : public RenderInterface {
+	public:
+		void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle texture,
+			const Vector2f& /*translation*/) override
+		{
+			num_textured_renders += (texture != 0);
+		}
+		void EnableScissorRegion(bool /*enable*/) override {}
+		void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+		// Called from the worker threads.
+		bool LoadTextureData(UniquePtr<const byte[]>& data, Vector2i& dimensions, const String& /*source*/) override
+		{
+			while (!allow_decoding)
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+			dimensions = Vector2i(32, 16);
+			data.reset(new byte[dimensions.x * dimensions.y * 4]());
+			return true;
+		}
+		bool GenerateTexture(TextureHandle& texture_handle, const byte* /*source*/, const Vector2i& /*source_dimensions*/) override
+		{
+			num_generated += 1;
+			texture_handle = TextureHandle(num_generated);
+			return true;
+		}
+
+		std::atomic<bool> allow_decoding{true};
+		int num_generated = 0;
+		int num_textured_renders = 0;
+	} render_interface;
+
+	Context* context = Rml::CreateContext("async", Vector2i(200, 200), &render_interface);
+	REQUIRE(context);
+
+	auto WaitForTextures = [&](int max_generated_per_update) {
+		for (int i = 0; i < 10000 && Rml::GetNumTexturesLoading() > 0; i++)
+		{
+			const int num_generated_before = render_interface.num_generated;
+			context->Update();
+			CHECK(render_interface.num_generated - num_generated_before <= max_generated_per_update);
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		REQUIRE(Rml::GetNumTexturesLoading() == 0);
+	};
+
+	Rml::SetAsyncTextureLoading(2);
+
+	{
+		Texture texture;
+		texture.Set("/assets/async.tga");
+		CHECK(texture.GetHandle(&render_interface) == 0);
+		CHECK(texture.IsLoading(&render_interface));
+		CHECK(Rml::GetNumTexturesLoading() == 1);
+
+		WaitForTextures(1);
+		CHECK(!texture.IsLoading(&render_interface));
+		CHECK(texture.GetHandle(&render_interface) != 0);
+		CHECK(texture.GetDimensions(&render_interface) == Vector2i(32, 16));
+	}
+
+	// Elements are laid out and rendered without their textures until they are loaded.
+	render_interface.allow_decoding = false;
+	ElementDocument* document = context->LoadDocumentFromMemory(document_async_textures_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	Element* image = document->GetElementById("image");
+	CHECK(image->GetBox().GetSize().x == 0.f);
+	CHECK(render_interface.num_textured_renders == 0);
+
+	render_interface.allow_decoding = true;
+	WaitForTextures(2);
+	context->Update();
+	context->Render();
+
+	CHECK(image->GetBox().GetSize() == Vector2f(32, 16));
+	CHECK(render_interface.num_textured_renders == 2);
+
+	document->Close();
+	context->Update();
+
+	// With a limited upload budget, at most one texture is generated per update.
+	Rml::SetAsyncTextureLoading(1, 1);
+	Rml::PrefetchTextures({"assets/prefetch_a.tga", "assets/prefetch_b.tga", "assets/prefetch_c.tga"}, &render_interface);
+	CHECK(Rml::GetNumTexturesLoading() == 3);
+	WaitForTextures(1);
+
+	Rml::SetAsyncTextureLoading(0);
+	Rml::RemoveContext("async");
+	Rml::ReleaseTextures(&render_interface);
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_texture_budget_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { display: block; }
+	</style>
+</head>
+<body>
+	<img id="a" src="/assets/budget_a.tga"/>
+	<img id="b" src="/assets/budget_b.tga"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.texture_memory_budget")
+{
+	TestsShell::GetContext();
+
+	class BudgetRenderInterface : public RenderInterface {
+	public:
+		void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/,
+			const Vector2f& /*translation*/) override
+		{}
+		void EnableScissorRegion(bool /*enable*/) override {}
+		void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+		bool LoadTexture(TextureHandle& texture_handle, Vector2i& texture_dimensions, const String& /*source*/) override
+		{
+			num_textures += 1;
+			texture_handle = ++last_handle;
+			texture_dimensions = Vector2i(64, 64);
+			return true;
+		}
+		void ReleaseTexture(TextureHandle /*texture*/) override { num_textures -= 1; }
+
+		int num_textures = 0;
+		TextureHandle last_handle = 0;
+	} render_interface;
+
+	Context* context = Rml::CreateContext("budget", Vector2i(200, 200), &render_interface);
+	REQUIRE(context);
+
+	constexpr size_t texture_size = 64 * 64 * 4;
+	Rml::SetTextureMemoryBudget(texture_size + texture_size / 2);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_texture_budget_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// Textures may be used by any context during a frame, thus render one frame for every context.
+	auto RenderFrame = [&] {
+		context->Update();
+		for (int i = 0; i < Rml::GetNumContexts(); i++)
+			context->Render();
+	};
+
+	// Visible textures are never evicted, even when over budget.
+	RenderFrame();
+	TextureMemoryStatistics statistics = Rml::GetTextureMemoryStatistics();
+	CHECK(render_interface.num_textures == 2);
+	CHECK(statistics.resident_bytes == 2 * texture_size);
+	CHECK(statistics.num_resident_textures == 2);
+	CHECK(statistics.num_evictions == 0);
+
+	document->GetElementById("b")->SetProperty("display", "none");
+	RenderFrame();
+	statistics = Rml::GetTextureMemoryStatistics();
+	CHECK(render_interface.num_textures == 1);
+	CHECK(statistics.resident_bytes == texture_size);
+	CHECK(statistics.num_evictions == 1);
+	CHECK(statistics.num_reloads == 0);
+
+	// The texture should be reloaded when shown again.
+	document->GetElementById("b")->RemoveProperty("display");
+	RenderFrame();
+	statistics = Rml::GetTextureMemoryStatistics();
+	CHECK(render_interface.num_textures == 2);
+	CHECK(statistics.num_reloads == 1);
+	CHECK(document->GetElementById("b")->GetBox().GetSize() == Vector2f(64, 64));
+
+	// Textures no longer referenced by any element are removed from the cache entirely.
+	const size_t num_sources = Rml::GetTextureSourceList().size();
+	document->GetElementById("a")->SetAttribute("src", "/assets/budget_b.tga");
+	RenderFrame();
+	CHECK(render_interface.num_textures == 1);
+	CHECK(Rml::GetTextureSourceList().size() == num_sources - 1);
+
+	document->Close();
+	context->Update();
+
+	Rml::SetTextureMemoryBudget(0);
+	Rml::RemoveContext("budget");
+	Rml::ReleaseTextures(&render_interface);
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_profile_rml = R"(
+<rml>
+<head>
+	<title>Profile</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 400px; height: 300px; }
+		p { height: 20px; }
+	</style>
+</head>
+
+<body data-model="profile">
+	<p data-if="show">{{ value }}</p>
+	<p data-attr-title="value"/>
+	<p>Text</p>
+</body>
+</rml>
+)";
+
+static int CountOccurrences(const String& string, const String& pattern)
+{
+	int count = 0;
+	for (size_t i = string.find(pattern); i != String::npos; i = string.find(pattern, i + 1))
+		count += 1;
+	return count;
+}
+
+TEST_CASE("core.profile_recording")
+{
+	TestsShell::ShutdownShell();
+
+	ClearProfileRecording();
+	const String empty_json = GetProfileRecording(ProfileRecordingFormat::Json);
+	CHECK(CountOccurrences(empty_json, "\"name\"") == 0);
+
+	// Recording initialisation requires it to be enabled before the library is initialised.
+	SetProfileRecording(true);
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	int value = 5;
+	bool show = true;
+	DataModelConstructor constructor = context->CreateDataModel("profile");
+	constructor.Bind("value", &value);
+	constructor.Bind("show", &show);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_profile_rml, "profile.rml");
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	SetProfileRecording(false);
+
+	// Zones are not recorded while disabled.
+	ElementDocument* unrecorded_document = context->LoadDocumentFromMemory(document_profile_rml);
+	REQUIRE(unrecorded_document);
+
+	const String json = GetProfileRecording(ProfileRecordingFormat::Json);
+	const String trace = GetProfileRecording(ProfileRecordingFormat::ChromeTrace);
+
+	// Everything is recorded on the main thread, with the top-level zones indented twice and their children nested below.
+	CHECK(CountOccurrences(json, "{\"thread\": ") == 1);
+	CHECK(CountOccurrences(json, "\n\t\t{\"name\": \"Initialise\", \"calls\": 1,") == 1);
+	CHECK(CountOccurrences(json, "\n\t\t\t{\"name\": \"InitialiseStyleSheetSpecification\", \"calls\": 1,") == 1);
+	CHECK(CountOccurrences(json, "\n\t\t{\"name\": \"LoadFontFace\", \"calls\": ") == 1);
+	CHECK(CountOccurrences(json, "\n\t\t{\"name\": \"LoadDocument\", \"calls\": 1,") == 1);
+	CHECK(CountOccurrences(json, "\n\t\t\t{\"name\": \"InstanceDocument\", \"calls\": 1,") == 1);
+	CHECK(CountOccurrences(json, "\n\t\t\t\t{\"name\": \"ParseXML\", \"calls\": 1,") == 1);
+	CHECK(CountOccurrences(json, "\n\t\t\t\t\t{\"name\": \"InstanceElement\", \"calls\": 3,") == 1);
+
+	for (const char* name : {"\"ProcessHeader\"", "\"LoadStyleSheet\"", "\"ParseStyleSheet\"", "\"CompileStyleSheet\"", "\"CreateDataViews\"",
+			 "\"UpdateDocument\"", "\"Layout\""})
+		CHECK_MESSAGE(CountOccurrences(json, name) >= 1, name);
+
+	// The trace lists every call separately, along with its text.
+	CHECK(trace.find("{\"displayTimeUnit\": \"ms\", \"traceEvents\": [") == 0);
+	CHECK(CountOccurrences(trace, "{\"name\": \"InstanceElement\", \"cat\": \"RmlUi\", \"ph\": \"X\", \"pid\": 1, \"tid\": 0,") == 3);
+	CHECK(CountOccurrences(trace, "{\"name\": \"LoadDocument\",") == 1);
+	CHECK(CountOccurrences(trace, "\"args\": {\"text\": \"profile.rml\"}") >= 1);
+
+	ClearProfileRecording();
+	CHECK(GetProfileRecording(ProfileRecordingFormat::Json) == empty_json);
+
+	document->Close();
+	unrecorded_document->Close();
+	context->RemoveDataModel("profile");
+
+	TestsShell::ShutdownShell();
+}
@@ -41,18 +41,19 @@ static DataModel model(type_register.GetTransformFuncRegister());
 static DataExpressionInterface interface(&model, nullptr);
 
 
-static String TestExpression(const String& expression)
+static String TestExpression(const String& expression, const DataExpressionInterface& expression_interface = interface)
 {
 	String result;
 
-	DataParser parser(expression, interface);
+	DataParser parser(expression, expression_interface);
 
 	if (parser.Parse(false))
 	{
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
+		VariableIdList variable_ids = parser.ReleaseVariableIds();
 
-		DataInterpreter interpreter(program, addresses, interface);
+		DataInterpreter interpreter(program, addresses, variable_ids, expression_interface);
 
 		if (interpreter.Run())
 			result = interpreter.Result().Get<String>();
@@ -75,8 +76,9 @@ static bool TestAssignment(const String& expression)
 	{
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
+		VariableIdList variable_ids = parser.ReleaseVariableIds();
 
-		DataInterpreter interpreter(program, addresses, interface);
+		DataInterpreter interpreter(program, addresses, variable_ids, interface);
 		if (interpreter.Run())
 			result = true;
 		else
@@ -147,6 +149,11 @@ TEST_CASE("Data expressions")
 	CHECK(TestExpression("0.2 + 3.42345 | round") == "4");
 	CHECK(TestExpression("(3.42345 | round) + 0.2") == "3.2");
 	CHECK(TestExpression("(3.42345 | format(0)) + 0.2") == "30.2"); // Here, format(0) returns a string, so the + means string concatenation.
+
+	Event event(nullptr, EventId::Change, "change", Dictionary{{"value", Variant("checked")}}, false);
+	DataExpressionInterface event_interface(&model, nullptr, &event);
+	CHECK(TestExpression("ev.value + ' ' + color_name", event_interface) == "checked image-color");
+	CHECK(TestExpression("ev.missing == ''", event_interface) == "1");
 }
 
 
@@ -115,4 +115,24 @@ TEST_CASE("Data variables")
 		REQUIRE(model.GetVariable(ParseAddress("data.fun.magic[8]")).Get(get_result));
 		CHECK(get_result.Get<String>() == "90");
 	}
+
+	// Test interned variable ids
+	{
+		const DataVariableId data_id = model.GetVariableId("data");
+		REQUIRE(data_id >= 0);
+		CHECK(model.GetVariableId("not_a_variable") == -1);
+
+		const DataAddress address = ParseAddress("data.fun.magic[8]");
+		Variant get_result;
+		REQUIRE(model.GetVariable(data_id, address).Get(get_result));
+		CHECK(get_result.Get<String>() == "90");
+
+		const DataAddress literal_address = { {"literal"}, {"int"}, {5} };
+		REQUIRE(model.GetVariable(-1, literal_address).Get(get_result));
+		CHECK(get_result.Get<int>() == 5);
+
+		CHECK(!model.IsVariableDirty("data"));
+		model.DirtyVariable(data_id);
+		CHECK(model.IsVariableDirty("data"));
+	}
 }
@@ -27,11 +27,15 @@
  */
 
 #include "../Common/Mocks.h"
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/ElementUtilities.h>
 #include <RmlUi/Core/Factory.h>
+#include "../../../Source/Core/TransformState.h"
 #include <doctest.h>
 
 using namespace Rml;
@@ -194,6 +198,782 @@ TEST_CASE("Element")
 		CHECK(clone->GetProperty<String>("background-color") == "0, 0, 255, 255");
 	}
 
+	SUBCASE("CloneSubtree")
+	{
+		Element* element = document->GetFirstChild();
+		element->SetInnerRML(R"(Text <span id="a" class="x y">with <em>nested</em> elements</span><p/>)"
+			R"(<div data-custom="value"><img src="invalid.png"/>More text</div><textarea id="t">Some &lt;value&gt;</textarea>)");
+
+		ElementPtr clone = element->Clone();
+		REQUIRE(clone);
+		CHECK(clone->GetInnerRML() == element->GetInnerRML());
+		CHECK(clone->GetNumChildren() == element->GetNumChildren());
+
+		Element* span = clone->GetElementById("a");
+		REQUIRE(span);
+		CHECK(span->IsClassSet("y"));
+		CHECK(span->GetFirstChild()->GetParentNode() == span);
+
+		// Text areas generate their own contents, cloning one directly must still reproduce its value.
+		Element* textarea = element->GetElementById("t");
+		REQUIRE(textarea);
+		ElementPtr textarea_clone = textarea->Clone();
+		CHECK(textarea_clone->GetInnerRML() == textarea->GetInnerRML());
+	}
+
+	SUBCASE("CloneGeneratedRML")
+	{
+		// Elements generating their own RML are cloned from that RML, rather than from their children.
+		class ElementGenerated : public Element {
+		public:
+			ElementGenerated(const String& tag) : Element(tag) {}
+			bool IsRMLDefinedByChildren() const override { return false; }
+			void GetInnerRML(String& content) const override { content += "<span id=\"generated\"/>"; }
+		};
+		static ElementInstancerGeneric<ElementGenerated> instancer;
+		Factory::RegisterElementInstancer("generated", &instancer);
+
+		Element* element = document->GetFirstChild();
+		element->SetInnerRML(R"(<div><generated><p id="child"/></generated></div>)");
+
+		ElementPtr clone = element->Clone();
+		REQUIRE(clone);
+		CHECK(clone->GetElementById("generated"));
+		CHECK(!clone->GetElementById("child"));
+
+		Element* generated = element->GetFirstChild()->GetFirstChild();
+		REQUIRE(generated->GetTagName() == "generated");
+		ElementPtr generated_clone = generated->Clone();
+		CHECK(generated_clone->GetElementById("generated"));
+		CHECK(!generated_clone->GetElementById("child"));
+	}
+
+	SUBCASE("InputEventParameters")
+	{
+		struct ParameterListener : EventListener {
+			void ProcessEvent(Event& event) override { parameters = event.GetParameters(); }
+			Dictionary parameters;
+		} listener;
+
+		Element* element = document->GetFirstChild();
+		element->AddEventListener(EventId::Mousedown, &listener);
+		element->AddEventListener(EventId::Keydown, &listener);
+
+		context->ProcessMouseMove(10, 20, 0);
+		context->ProcessMouseButtonDown(1, Input::KM_SHIFT);
+		context->ProcessMouseButtonUp(1, 0);
+
+		CHECK(listener.parameters.size() == 10);
+		CHECK(listener.parameters["mouse_x"] == Variant(10));
+		CHECK(listener.parameters["mouse_y"] == Variant(20));
+		CHECK(listener.parameters["button"] == Variant(1));
+		CHECK(listener.parameters["shift_key"] == Variant(1));
+		CHECK(listener.parameters["ctrl_key"] == Variant(0));
+
+		element->Focus();
+		context->ProcessKeyDown(Input::KI_A, Input::KM_CTRL);
+
+		CHECK(listener.parameters.size() == 8);
+		CHECK(listener.parameters["key_identifier"] == Variant((int)Input::KI_A));
+		CHECK(listener.parameters["ctrl_key"] == Variant(1));
+		CHECK(listener.parameters["shift_key"] == Variant(0));
+
+		element->RemoveEventListener(EventId::Mousedown, &listener);
+		element->RemoveEventListener(EventId::Keydown, &listener);
+	}
+
+	SUBCASE("ListenerChainMask")
+	{
+		struct CountingListener : EventListener {
+			void ProcessEvent(Event& /*event*/) override { num_events += 1; }
+			int num_events = 0;
+		} listener;
+
+		Element* parent = document->GetFirstChild();
+		ElementPtr child_ptr = document->CreateElement("div");
+		Element* grandchild = child_ptr->AppendChild(document->CreateElement("div"));
+
+		// Listeners on the parent should be picked up by descendants added later.
+		parent->AddEventListener("custom", &listener);
+		Element* child = parent->AppendChild(std::move(child_ptr));
+
+		grandchild->DispatchEvent("custom", Dictionary());
+		CHECK(listener.num_events == 1);
+
+		// And should no longer be picked up after the descendants are moved elsewhere.
+		child_ptr = parent->RemoveChild(child);
+		grandchild->DispatchEvent("custom", Dictionary());
+		CHECK(listener.num_events == 1);
+
+		child = parent->AppendChild(std::move(child_ptr));
+		grandchild->DispatchEvent("custom", Dictionary());
+		CHECK(listener.num_events == 2);
+
+		parent->RemoveEventListener("custom", &listener);
+		grandchild->DispatchEvent("custom", Dictionary());
+		CHECK(listener.num_events == 2);
+
+		parent->RemoveChild(child);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_clip_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+			padding: 0;
+			overflow: visible;
+		}
+		#clip {
+			position: absolute;
+			left: 10px;
+			top: 20px;
+			width: 100px;
+			height: 50px;
+			overflow: hidden;
+		}
+		#content {
+			width: 300px;
+			height: 20px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="clip"><div id="content"><div id="child"/></div></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.ClippingRegion")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_clip_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* clip = document->GetElementById("clip");
+	Element* child = document->GetElementById("child");
+
+	Vector2i origin, dimensions;
+	CHECK(!ElementUtilities::GetClippingRegion(origin, dimensions, clip));
+
+	REQUIRE(ElementUtilities::GetClippingRegion(origin, dimensions, child));
+	CHECK(origin == Vector2i(10, 20));
+	CHECK(dimensions == Vector2i(100, 50));
+
+	// The cached region should be updated after changes to the clipping element.
+	clip->SetProperty("left", "30px");
+	clip->SetProperty("width", "80px");
+	context->Update();
+
+	REQUIRE(ElementUtilities::GetClippingRegion(origin, dimensions, child));
+	CHECK(origin == Vector2i(30, 20));
+	CHECK(dimensions == Vector2i(80, 50));
+
+	child->SetProperty("clip", "1");
+	context->Update();
+	CHECK(!ElementUtilities::GetClippingRegion(origin, dimensions, child));
+
+	child->SetProperty("clip", "auto");
+	clip->SetProperty("overflow", "visible");
+	context->Update();
+	CHECK(!ElementUtilities::GetClippingRegion(origin, dimensions, child));
+
+	clip->SetProperty("clip", "always");
+	context->Update();
+	REQUIRE(ElementUtilities::GetClippingRegion(origin, dimensions, child));
+	CHECK(dimensions == Vector2i(80, 50));
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_clip_scroll_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+			padding: 0;
+		}
+		#scroll {
+			position: absolute;
+			left: 10px;
+			top: 20px;
+			width: 100px;
+			height: 50px;
+			overflow: hidden;
+		}
+		#noclip {
+			clip: none;
+			overflow: hidden;
+			width: 50px;
+			height: 30px;
+		}
+		#inner {
+			height: 60px;
+		}
+		#spacer {
+			height: 200px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="scroll"><div id="noclip"><div id="inner"/></div><div id="spacer"/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.ClippingRegion.Scroll")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_clip_scroll_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* scroll = document->GetElementById("scroll");
+	Element* inner = document->GetElementById("inner");
+
+	// Query the region below the element ignoring all clipping regions first, before any of its ancestors are cached.
+	Vector2i origin, dimensions;
+	REQUIRE(ElementUtilities::GetClippingRegion(origin, dimensions, inner));
+	CHECK(origin == Vector2i(10, 20));
+	CHECK(dimensions == Vector2i(50, 30));
+
+	// Scrolling an ancestor moves the element, which must also be reflected in the cached region.
+	scroll->SetScrollTop(10.f);
+	context->Update();
+
+	REQUIRE(ElementUtilities::GetClippingRegion(origin, dimensions, inner));
+	CHECK(origin == Vector2i(10, 10));
+	CHECK(dimensions == Vector2i(50, 30));
+
+	scroll->SetScrollTop(0.f);
+	context->Update();
+
+	REQUIRE(ElementUtilities::GetClippingRegion(origin, dimensions, inner));
+	CHECK(origin == Vector2i(10, 20));
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_culling_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 500px;
+			height: 500px;
+			padding: 0;
+		}
+		#scroll {
+			position: absolute;
+			left: 0;
+			top: 100px;
+			width: 100px;
+			height: 40px;
+			overflow: hidden;
+		}
+		p {
+			line-height: 20px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="scroll"><p id="p">Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.</p></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.Culling")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_culling_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* scroll = document->GetElementById("scroll");
+	Element* paragraph = document->GetElementById("p");
+
+	auto CountRenderCalls = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return render_interface->GetCounters().render_calls;
+	};
+
+	const size_t render_calls_visible = CountRenderCalls();
+
+	paragraph->SetProperty("visibility", "hidden");
+	const size_t render_calls_hidden = CountRenderCalls();
+	paragraph->RemoveProperty("visibility");
+
+	REQUIRE(render_calls_visible > render_calls_hidden);
+
+	// The text element has no size and starts above the clipping region once its first lines are scrolled out of view,
+	// its remaining lines should still be rendered.
+	REQUIRE(scroll->GetScrollHeight() > 100.f);
+	scroll->SetScrollTop(50.f);
+	CHECK(CountRenderCalls() == render_calls_visible);
+
+	// Custom elements may render anywhere, their OnRender() is only skipped when they opt in to culling.
+	class ElementRenderCounter : public Element {
+	public:
+		ElementRenderCounter(const String& tag) : Element(tag) {}
+		bool IsCullable() const override { return GetTagName() == "cullable"; }
+		void OnRender() override { num_renders += 1; }
+		int num_renders = 0;
+	};
+	static ElementInstancerGeneric<ElementRenderCounter> instancer;
+	Factory::RegisterElementInstancer("custom", &instancer);
+	Factory::RegisterElementInstancer("cullable", &instancer);
+
+	ElementPtr custom_ptr = Factory::InstanceElement(nullptr, "custom", "custom", XMLAttributes());
+	ElementPtr cullable_ptr = Factory::InstanceElement(nullptr, "cullable", "cullable", XMLAttributes());
+	auto custom = static_cast<ElementRenderCounter*>(document->AppendChild(std::move(custom_ptr)));
+	auto cullable = static_cast<ElementRenderCounter*>(document->AppendChild(std::move(cullable_ptr)));
+	for (Element* element : {(Element*)custom, (Element*)cullable})
+	{
+		element->SetProperty("position", "absolute");
+		element->SetProperty("left", "-100px");
+		element->SetProperty("width", "50px");
+		element->SetProperty("height", "50px");
+	}
+
+	CountRenderCalls();
+	CHECK(custom->num_renders == 1);
+	CHECK(cullable->num_renders == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_render_cache_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 500px;
+			height: 500px;
+			padding: 0;
+		}
+		#layer {
+			render-cache: layer;
+			position: absolute;
+			left: 10px;
+			top: 20px;
+			width: 100px;
+		}
+		#layer div, #outside {
+			height: 20px;
+			background-color: #f00;
+		}
+		#outside {
+			position: absolute;
+			top: 200px;
+			width: 100px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="layer">
+	<div id="a"/>
+	<div id="b"/>
+	<div id="c"/>
+</div>
+<div id="outside"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.RenderCache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_render_cache_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* layer = document->GetElementById("layer");
+
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return render_interface->GetCounters();
+	};
+
+	// The first frame renders the layer contents into the texture and then draws the texture.
+	auto counters = RenderFrame();
+	CHECK(counters.begin_render_to_texture == 1);
+	CHECK(counters.end_render_to_texture == 1);
+	const size_t render_calls_uncached = counters.render_calls;
+
+	// Subsequent frames reuse the texture, replacing the three children by a single quad.
+	counters = RenderFrame();
+	CHECK(counters.begin_render_to_texture == 0);
+	CHECK(counters.render_calls == render_calls_uncached - 3);
+
+	// Changes within the layer should re-render it, while changes outside it should not.
+	document->GetElementById("b")->SetProperty("background-color", "#0f0");
+	counters = RenderFrame();
+	CHECK(counters.begin_render_to_texture == 1);
+
+	document->GetElementById("outside")->SetProperty("background-color", "#0f0");
+	counters = RenderFrame();
+	CHECK(counters.begin_render_to_texture == 0);
+
+	document->GetElementById("c")->SetInnerRML("<div/>");
+	counters = RenderFrame();
+	CHECK(counters.begin_render_to_texture == 1);
+
+	document->GetElementById("c")->SetInnerRML("");
+	RenderFrame();
+
+	layer->SetProperty("left", "50px");
+	counters = RenderFrame();
+	CHECK(counters.begin_render_to_texture == 1);
+	CHECK(counters.release_texture == 1);
+
+	// Transformed elements are rendered directly.
+	layer->SetProperty("transform", "rotate(10deg)");
+	counters = RenderFrame();
+	CHECK(counters.begin_render_to_texture == 0);
+	CHECK(counters.render_calls == render_calls_uncached - 1);
+
+	layer->RemoveProperty("transform");
+	RenderFrame();
+
+	layer->SetProperty("render-cache", "none");
+	counters = RenderFrame();
+	CHECK(counters.begin_render_to_texture == 0);
+	CHECK(counters.render_calls == render_calls_uncached - 1);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_render_cache_bounds_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 500px;
+			height: 500px;
+			padding: 0;
+		}
+		#empty, #overflow {
+			render-cache: layer;
+			position: absolute;
+			top: 20px;
+		}
+		#empty {
+			left: 10px;
+			width: 0;
+			height: 0;
+		}
+		#overflow {
+			left: 200px;
+			width: 100px;
+			height: 50px;
+			background-color: #f00;
+		}
+		#a, #b {
+			position: absolute;
+			width: 50px;
+			height: 20px;
+			background-color: #0f0;
+		}
+		#a {
+			left: 5px;
+			top: 30px;
+		}
+		#b {
+			left: 80px;
+			top: -10px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="empty"><div id="a"/></div>
+<div id="overflow"><div id="b"/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.RenderCache.Bounds")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_render_cache_bounds_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return render_interface->GetRenderToTextureRegions();
+	};
+
+	// The layers should cover their descendants, even when these are outside the layer element or it has no size at all.
+	auto regions = RenderFrame();
+	REQUIRE(regions.size() == 2);
+	CHECK(regions[0].origin == Vector2i(15, 50));
+	CHECK(regions[0].dimensions == Vector2i(50, 20));
+	CHECK(regions[1].origin == Vector2i(200, 10));
+	CHECK(regions[1].dimensions == Vector2i(130, 60));
+
+	// Only the visible part of the layer is rendered, even when the layer element itself is outside the context.
+	document->GetElementById("empty")->SetProperty("left", "-20px");
+	regions = RenderFrame();
+	REQUIRE(regions.size() == 1);
+	CHECK(regions[0].origin == Vector2i(0, 50));
+	CHECK(regions[0].dimensions == Vector2i(35, 20));
+
+	// Nothing is rendered when the layer is entirely outside the context.
+	document->GetElementById("empty")->SetProperty("display", "none");
+	RenderFrame();
+	RenderFrame();
+	const size_t render_calls_hidden = render_interface->GetCounters().render_calls;
+
+	document->GetElementById("empty")->SetProperty("display", "block");
+	document->GetElementById("empty")->SetProperty("left", "-100px");
+	for (const auto& region : RenderFrame())
+		CHECK(region.origin == Vector2i(200, 10));
+	regions = RenderFrame();
+	CHECK(regions.empty());
+	CHECK(render_interface->GetCounters().render_calls == render_calls_hidden);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_render_cache_progress_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 500px;
+			height: 500px;
+			padding: 0;
+		}
+		#layer {
+			render-cache: layer;
+			position: absolute;
+			width: 100px;
+			height: 100px;
+			background-color: #f00;
+		}
+		progress {
+			display: block;
+			width: 100px;
+			height: 20px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="layer"><progress id="progress" value="0.5"/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.RenderCache.Progress")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_render_cache_progress_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return render_interface->GetCounters();
+	};
+
+	// The progress bar sizes its fill element while rendering, which re-renders the layer once more in the next frame.
+	auto RenderUntilCached = [&]() {
+		for (int i = 0; i < 3; i++)
+			RenderFrame();
+		CHECK(RenderFrame().begin_render_to_texture == 0);
+	};
+
+	RenderUntilCached();
+
+	// Changes to the attributes of elements generating their own geometry should re-render the layer.
+	Element* progress = document->GetElementById("progress");
+	progress->SetAttribute("value", 0.75f);
+	CHECK(RenderFrame().begin_render_to_texture == 1);
+	RenderUntilCached();
+
+	progress->SetAttribute("max", 2.f);
+	CHECK(RenderFrame().begin_render_to_texture == 1);
+	RenderUntilCached();
+
+	progress->SetAttribute("direction", "left");
+	CHECK(RenderFrame().begin_render_to_texture == 1);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_transform_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+		}
+		#parent {
+			position: absolute;
+			width: 100px;
+			height: 100px;
+			transform: translateX(10px);
+		}
+		#child {
+			width: 50px;
+			height: 50px;
+			font-size: 10px;
+			transform: translateX(2em);
+		}
+	</style>
+</head>
+
+<body>
+<div id="parent"><div id="child"/></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.TransformState")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_transform_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* parent = document->GetElementById("parent");
+	Element* child = document->GetElementById("child");
+
+	// Returns the horizontal translation of the element's accumulated transform, which is unaffected by the transform origin.
+	auto GetTranslation = [&](Element* element) -> float {
+		context->Update();
+		context->Render();
+		const TransformState* state = element->GetTransformState();
+		if (!state || !state->GetTransform())
+			return 0.f;
+		return (*state->GetTransform() * Vector4f(0, 0, 0, 1)).x;
+	};
+
+	CHECK(GetTranslation(child) == 30.f);
+
+	// Changes to ancestors must be reflected in the cached transforms of descendants.
+	parent->SetProperty("transform", "translateX(20px)");
+	CHECK(GetTranslation(child) == 40.f);
+
+	parent->SetProperty("left", "5px");
+	CHECK(GetTranslation(child) == 40.f);
+
+	// Local transforms must be resolved again when the quantities they are relative to change.
+	child->SetProperty("font-size", "20px");
+	CHECK(GetTranslation(child) == 60.f);
+
+	parent->SetProperty("transform", "translateX(50%)");
+	CHECK(GetTranslation(parent) == 50.f);
+	CHECK(GetTranslation(child) == 90.f);
+
+	parent->SetProperty("width", "200px");
+	CHECK(GetTranslation(parent) == 100.f);
+	CHECK(GetTranslation(child) == 140.f);
+
+	// The inverse transform is used for projecting points onto transformed elements.
+	const Vector2f point = child->GetAbsoluteOffset(Box::BORDER) + Vector2f(140.f + 5.f, 5.f);
+	Vector2f projected_point = point;
+	REQUIRE(child->Project(projected_point));
+	CHECK(projected_point.x == doctest::Approx(point.x - 140.f));
+	CHECK(projected_point.y == doctest::Approx(point.y));
+
+	parent->SetProperty("transform", "none");
+	CHECK(GetTranslation(child) == 40.f);
+
+	child->SetProperty("transform", "none");
+	CHECK(GetTranslation(child) == 0.f);
+	CHECK(child->GetTransformState() == nullptr);
+
 	document->Close();
 	TestsShell::ShutdownShell();
 }
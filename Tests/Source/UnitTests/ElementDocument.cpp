@@ -29,11 +29,18 @@
 #include "../Common/Mocks.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
 #include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/FileInterface.h>
+#include <RmlUi/Core/Plugin.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
 #include <doctest.h>
 #include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <thread>
 
 using namespace Rml;
 
@@ -274,4 +281,412 @@ TEST_CASE("Load")
 	TestsShell::ShutdownShell();
 }
 
+TEST_CASE("SharedStyleSheet")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const String linked_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+</head>
+<body/>
+</rml>)";
+
+	const String inline_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 100px; }
+	</style>
+</head>
+<body/>
+</rml>)";
+
+	ElementDocument* document_a = context->LoadDocumentFromMemory(linked_rml);
+	ElementDocument* document_b = context->LoadDocumentFromMemory(linked_rml);
+	ElementDocument* document_c = context->LoadDocumentFromMemory(inline_rml);
+	REQUIRE(document_a);
+	REQUIRE(document_b);
+	REQUIRE(document_c);
+
+	context->Update();
+
+	// Documents with identical style sources should share their compiled style sheet.
+	REQUIRE(document_a->GetStyleSheet());
+	CHECK(document_a->GetStyleSheet() == document_b->GetStyleSheet());
+	CHECK(document_a->GetStyleSheet() != document_c->GetStyleSheet());
+
+	// The shared style sheet must remain valid after one of its documents is closed.
+	document_a->Close();
+	context->Update();
+
+	ElementDocument* document_d = context->LoadDocumentFromMemory(linked_rml);
+	REQUIRE(document_d);
+	context->Update();
+	CHECK(document_d->GetStyleSheet() == document_b->GetStyleSheet());
+
+	document_b->Close();
+	document_c->Close();
+	document_d->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("CompiledDocument")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const String document_rml = R"(
+<rml>
+<head>
+	<title>Compiled</title>
+	<link type="text/template" href="/assets/window.rml"/>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body.window { width: 400px; height: 300px; }
+	</style>
+</head>
+<body template="window">
+<div id="a" class="x y" style="width: 100px;">Text &lt;with&gt; entities<br/>and more.</div>
+<input type='checkbox' checked/>
+<p><![CDATA[<b>raw</b>]]></p>
+</body>
+</rml>)";
+
+	const String source_url = "compiled_document.rml";
+
+	String data;
+	Factory::CompileDocument(data, document_rml, source_url);
+	REQUIRE(!data.empty());
+
+	ElementDocument* parsed = context->LoadDocumentFromMemory(document_rml, source_url);
+	REQUIRE(parsed);
+
+	SUBCASE("Loaded")
+	{
+		ElementDocument* compiled = context->LoadCompiledDocument(data, source_url, &document_rml);
+		REQUIRE(compiled);
+		context->Update();
+
+		CHECK(compiled->GetInnerRML() == parsed->GetInnerRML());
+		CHECK(compiled->GetTitle() == "Compiled");
+		CHECK(compiled->GetSourceURL() == parsed->GetSourceURL());
+
+		Element* element = compiled->GetElementById("a");
+		REQUIRE(element);
+		CHECK(element->GetBox().GetSize() == parsed->GetElementById("a")->GetBox().GetSize());
+
+		compiled->Close();
+	}
+
+	SUBCASE("Stale")
+	{
+		const String modified_rml = document_rml + " ";
+		CHECK(!context->LoadCompiledDocument(data, source_url, &modified_rml));
+
+		ElementDocument* compiled = context->LoadCompiledDocument(data, source_url);
+		CHECK(compiled);
+		if (compiled)
+			compiled->Close();
+	}
+
+	SUBCASE("Notifications")
+	{
+		// Plugins should be notified of the document before any of its elements are created, as when parsing its source.
+		struct OpenOrderPlugin : public Plugin {
+			int GetEventClasses() override { return EVT_DOCUMENT | EVT_ELEMENT; }
+			void OnDocumentOpen(Context* /*context*/, const String& document_path) override
+			{
+				opened_paths.push_back(document_path);
+				elements_created_before_open.push_back(num_elements_created);
+			}
+			void OnElementCreate(Element* /*element*/) override { num_elements_created += 1; }
+
+			StringList opened_paths;
+			Vector<int> elements_created_before_open;
+			int num_elements_created = 0;
+		} plugin;
+
+		RegisterPlugin(&plugin);
+
+		ElementDocument* streamed = context->LoadDocumentFromMemory(document_rml, source_url);
+		const int num_elements_streamed = plugin.num_elements_created;
+		ElementDocument* compiled = context->LoadCompiledDocument(data, source_url, &document_rml);
+
+		// Stale documents are not opened at all.
+		const String modified_rml = document_rml + " ";
+		CHECK(!context->LoadCompiledDocument(data, source_url, &modified_rml));
+
+		UnregisterPlugin(&plugin);
+
+		REQUIRE(streamed);
+		REQUIRE(compiled);
+		CHECK(num_elements_streamed > 0);
+		CHECK(plugin.opened_paths == StringList{source_url, source_url});
+		CHECK(plugin.elements_created_before_open == Vector<int>{0, num_elements_streamed});
+
+		streamed->Close();
+		compiled->Close();
+	}
+
+	SUBCASE("Invalid")
+	{
+		CHECK(!context->LoadCompiledDocument(data.substr(0, data.size() - 1), source_url));
+		CHECK(!context->LoadCompiledDocument(String(), source_url));
+		CHECK(!context->LoadCompiledDocument(document_rml, source_url));
+	}
+
+	parsed->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("PreloadDocuments")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const StringList document_paths = {
+		"basic/benchmark/data/benchmark.rml",
+		"basic/transform/data/transform.rml",
+		"basic/animation/data/animation.rml",
+	};
+
+	StringList expected_rml;
+	for (const String& document_path : document_paths)
+	{
+		ElementDocument* document = context->LoadDocument(document_path);
+		REQUIRE(document);
+		expected_rml.push_back(document->GetInnerRML());
+		document->Close();
+	}
+	context->Update();
+
+	auto LoadAndCompare = [&]() {
+		for (size_t i = 0; i < document_paths.size(); i++)
+		{
+			ElementDocument* document = context->LoadDocument(document_paths[i]);
+			REQUIRE(document);
+			CHECK(document->GetInnerRML() == expected_rml[i]);
+			CHECK(document->GetSourceURL() == document_paths[i]);
+			document->Close();
+		}
+		context->Update();
+		CHECK(GetNumDocumentsPreloading() == 0);
+	};
+
+	SUBCASE("Threads")
+	{
+		PreloadDocuments(document_paths, 2);
+		LoadAndCompare();
+	}
+
+	SUBCASE("Immediate")
+	{
+		PreloadDocuments(document_paths, 0);
+		CHECK(GetNumDocumentsPreloading() == 0);
+		LoadAndCompare();
+	}
+
+	SUBCASE("Missing")
+	{
+		PreloadDocuments({"missing_document.rml"}, 1);
+
+		// The document is loaded from its path as usual, which fails to open it.
+		TestsShell::SetNumExpectedWarnings(1);
+		CHECK(!context->LoadDocument("missing_document.rml"));
+		TestsShell::SetNumExpectedWarnings(0);
+		CHECK(GetNumDocumentsPreloading() == 0);
+	}
+
+	TestsShell::ShutdownShell();
+}
+
+static void WriteFile(const String& path, const String& contents)
+{
+	FILE* file = fopen(path.c_str(), "wb");
+	REQUIRE(file);
+	fwrite(contents.data(), 1, contents.size(), file);
+	fclose(file);
+}
+
+TEST_CASE("ReloadStyleSheet")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	auto GetPropertyString = [](ElementDocument* document, const String& id, const String& name) -> String {
+		Element* element = document->GetElementById(id);
+		REQUIRE(element);
+		const Property* property = element->GetProperty(name);
+		return property ? property->ToString() : String();
+	};
+
+	SUBCASE("SetStyleSheetContainer")
+	{
+		const String document_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+</head>
+<body>
+<div id="x" class="x"/>
+<div id="y" class="y"/>
+<div class="parent"><div id="child" class="child"/></div>
+<div id="new"/>
+<input id="input" type="text"/>
+</body>
+</rml>)";
+
+		const String rcss_a = R"(
+.x { width: 100px; }
+.y { width: 50px; }
+.y:hover { width: 60px; }
+.parent .child { height: 5px; }
+#new { height: 1px; }
+)";
+		const String rcss_b = R"(
+.x { width: 150px; }
+.y { width: 50px; }
+.y:hover { width: 70px; }
+.parent .child { height: 6px; }
+.added { height: 2px; }
+)";
+		const String rcss_c = rcss_b + R"(
+@decorator added-decorator : gradient { direction: vertical; start-color: #000; stop-color: #fff; }
+.y { decorator: added-decorator; }
+)";
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+		REQUIRE(document);
+		document->SetStyleSheetContainer(Factory::InstanceStyleSheetString(rcss_a));
+		document->Show();
+		context->Update();
+
+		CHECK(GetPropertyString(document, "x", "width") == "100px");
+		CHECK(GetPropertyString(document, "child", "height") == "5px");
+		CHECK(GetPropertyString(document, "new", "height") == "1px");
+
+		// State set on the elements must be retained when the style sheet changes.
+		document->GetElementById("input")->SetAttribute("value", "retained");
+		document->GetElementById("new")->SetClass("added", true);
+		context->Update();
+
+		document->SetStyleSheetContainer(Factory::InstanceStyleSheetString(rcss_b));
+		context->Update();
+
+		CHECK(GetPropertyString(document, "x", "width") == "150px");
+		CHECK(GetPropertyString(document, "y", "width") == "50px");
+		CHECK(GetPropertyString(document, "child", "height") == "6px");
+		CHECK(GetPropertyString(document, "new", "height") == "2px");
+		CHECK(document->GetElementById("input")->GetAttribute<String>("value", "") == "retained");
+
+		// Rules depending on state not currently active must take effect once the state changes.
+		document->GetElementById("y")->SetPseudoClass("hover", true);
+		context->Update();
+		CHECK(GetPropertyString(document, "y", "width") == "70px");
+
+		// New decorators may affect any element, and are handled by restyling the whole document.
+		document->SetStyleSheetContainer(Factory::InstanceStyleSheetString(rcss_c));
+		context->Update();
+		CHECK(GetPropertyString(document, "y", "decorator") == "added-decorator");
+		CHECK(GetPropertyString(document, "x", "width") == "150px");
+
+		document->Close();
+	}
+
+	SUBCASE("Files")
+	{
+		const String rcss_path = "reload_style_sheet.rcss";
+		const String rml_path = "reload_style_sheet.rml";
+
+		WriteFile(rcss_path, "#a { width: 100px; } #b { width: 50px; }");
+		WriteFile(rml_path, R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<link type="text/rcss" href="reload_style_sheet.rcss"/>
+	<style>
+		#b { height: 10px; }
+	</style>
+</head>
+<body>
+<div id="a"/>
+<div id="b"/>
+</body>
+</rml>)");
+
+		ElementDocument* document = context->LoadDocument(rml_path);
+		REQUIRE(document);
+		document->Show();
+		document->GetElementById("a")->SetClass("state", true);
+		context->Update();
+
+		CHECK(GetPropertyString(document, "a", "width") == "100px");
+		CHECK(GetPropertyString(document, "b", "height") == "10px");
+		CHECK(ReloadModifiedStyleSheets() == 0);
+
+		uint64_t time_loaded = 0;
+		const bool has_modification_time = GetFileInterface()->GetModificationTime(rcss_path, time_loaded);
+		CHECK(has_modification_time);
+
+		if (has_modification_time)
+		{
+			// Make sure the modification time changes, which may have a coarse resolution.
+			uint64_t time_modified = time_loaded;
+			for (int i = 0; i < 300 && time_modified == time_loaded; i++)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				WriteFile(rcss_path, "#a { width: 200px; } #b { width: 50px; } .state { height: 20px; }");
+				GetFileInterface()->GetModificationTime(rcss_path, time_modified);
+			}
+			REQUIRE(time_modified != time_loaded);
+
+			CHECK(ReloadModifiedStyleSheets() == 1);
+			CHECK(ReloadModifiedStyleSheets() == 0);
+			context->Update();
+
+			CHECK(GetPropertyString(document, "a", "width") == "200px");
+			CHECK(GetPropertyString(document, "a", "height") == "20px");
+			CHECK(GetPropertyString(document, "b", "width") == "50px");
+			CHECK(GetPropertyString(document, "b", "height") == "10px");
+			CHECK(document->GetElementById("a")->IsClassSet("state"));
+		}
+
+		// Reloading the style sheet of the document also reloads its inline styles.
+		WriteFile(rml_path, R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<link type="text/rcss" href="reload_style_sheet.rcss"/>
+	<style>
+		#b { height: 30px; }
+	</style>
+</head>
+<body/>
+</rml>)");
+		WriteFile(rcss_path, "#a { width: 300px; }");
+
+		document->ReloadStyleSheet();
+		context->Update();
+
+		CHECK(GetPropertyString(document, "a", "width") == "300px");
+		CHECK(GetPropertyString(document, "b", "width") == "auto");
+		CHECK(GetPropertyString(document, "b", "height") == "30px");
+		CHECK(document->GetElementById("a")->IsClassSet("state"));
+
+		document->Close();
+		context->Update();
+
+		remove(rcss_path.c_str());
+		remove(rml_path.c_str());
+	}
+
+	TestsShell::ShutdownShell();
+}
+
 TEST_SUITE_END();
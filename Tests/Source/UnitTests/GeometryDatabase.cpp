@@ -27,8 +27,18 @@
  */
 
 
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Box.h>
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/Texture.h>
 #include <RmlUi/Core/Types.h>
 #include <RmlUi/Core/Geometry.h>
+#include <RmlUi/Core/GeometryUtilities.h>
+#include "../../../Source/Core/GeometryBackgroundBorder.h"
 #include "../../../Source/Core/GeometryDatabase.h"
 #include <doctest.h>
 
@@ -67,3 +77,233 @@ TEST_CASE("Geometry database")
 	geometry_list.clear();
 	CHECK(ListMatchesDatabase(geometry_list));
 }
+
+TEST_CASE("Geometry arena")
+{
+	Context* context = TestsShell::GetContext();
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	// Start from an empty arena.
+	Rml::ReleaseCompiledGeometry();
+
+	Vector<Geometry> geometry_list;
+	geometry_list.reserve(100);
+	for (int i = 0; i < 100; i++)
+	{
+		geometry_list.emplace_back(context);
+		Geometry& geometry = geometry_list.back();
+		geometry.GetVertices().resize(4);
+		geometry.GetIndices().resize(6);
+		GeometryUtilities::GenerateQuad(geometry.GetVertices().data(), geometry.GetIndices().data(), Vector2f(10, 10), Vector2f(20, 20), Colourb(255));
+	}
+
+	auto RenderAll = [&]() {
+		render_interface->ResetCounters();
+		for (Geometry& geometry : geometry_list)
+			geometry.Render(Vector2f(0, 0));
+		return render_interface->GetCounters();
+	};
+
+	// All the geometry should be placed in a single page, uploaded as it is first rendered.
+	auto counters = RenderAll();
+	CHECK(counters.create_geometry_buffer == 1);
+	CHECK(counters.update_geometry_buffer == 100);
+	CHECK(counters.render_calls == 100);
+
+	for (Geometry& geometry : geometry_list)
+		CHECK(geometry);
+
+	counters = RenderAll();
+	CHECK(counters.update_geometry_buffer == 0);
+	CHECK(counters.render_calls == 100);
+
+	// Accessing the vertices moves the geometry out of the arena, then it should be placed back on the next render.
+	Geometry& geometry = geometry_list[50];
+	REQUIRE(geometry.GetVertices().size() == 4);
+	CHECK(geometry.GetVertices()[2].position == Vector2f(30, 30));
+	REQUIRE(geometry.GetIndices().size() == 6);
+	geometry.GetVertices()[2].position = Vector2f(40, 40);
+
+	counters = RenderAll();
+	CHECK(counters.create_geometry_buffer == 0);
+	CHECK(counters.update_geometry_buffer == 1);
+	CHECK(geometry.GetVertices()[2].position == Vector2f(40, 40));
+
+	geometry.Release(true);
+	CHECK(!geometry);
+
+	// Pages are kept while in use, and released on request once empty.
+	render_interface->ResetCounters();
+	Rml::ReleaseCompiledGeometry();
+	CHECK(render_interface->GetCounters().release_geometry_buffer == 1);
+
+	counters = RenderAll();
+	CHECK(counters.create_geometry_buffer == 1);
+	CHECK(counters.render_calls == 99);
+
+	render_interface->ResetCounters();
+	geometry_list.clear();
+	Rml::ReleaseCompiledGeometry();
+	CHECK(render_interface->GetCounters().release_geometry_buffer == 1);
+
+	// The arena is owned by the context, thus geometry without a host context is not placed in it.
+	Geometry hostless_geometry;
+	hostless_geometry.GetVertices().resize(4);
+	hostless_geometry.GetIndices().resize(6);
+	GeometryUtilities::GenerateQuad(hostless_geometry.GetVertices().data(), hostless_geometry.GetIndices().data(), Vector2f(10, 10), Vector2f(20, 20),
+		Colourb(255));
+
+	render_interface->ResetCounters();
+	hostless_geometry.Render(Vector2f(0, 0));
+	CHECK(render_interface->GetCounters().create_geometry_buffer == 0);
+	CHECK(render_interface->GetCounters().render_calls == 1);
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Geometry update vertices")
+{
+	Context* context = TestsShell::GetContext();
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	Box box(Vector2f(100, 50));
+	box.SetEdge(Box::BORDER, Box::TOP, 4);
+	box.SetEdge(Box::BORDER, Box::RIGHT, 10);
+	box.SetEdge(Box::BORDER, Box::BOTTOM, 4);
+	box.SetEdge(Box::BORDER, Box::LEFT, 2);
+
+	const CornerSizes radii = {20, 0, 8, 12};
+	const Colourb border_colors[4] = {Colourb(255, 0, 0), Colourb(0, 255, 0), Colourb(0, 0, 255), Colourb(255, 255, 0)};
+	const Colourb new_border_colors[4] = {Colourb(10, 20, 30), Colourb(40, 50, 60), Colourb(70, 80, 90), Colourb(100, 110, 120, 130)};
+
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+	Vector<GeometryBackgroundBorder::ColorSegment> color_segments;
+	GeometryBackgroundBorder::Draw(vertices, indices, radii, box, Vector2f(0), Colourb(128), border_colors, &color_segments);
+
+	// Updating the colors in place should give the same result as generating the geometry with the new colors.
+	Vector<Vertex> expected_vertices;
+	Vector<int> expected_indices;
+	GeometryBackgroundBorder::Draw(expected_vertices, expected_indices, radii, box, Vector2f(0), Colourb(1, 2, 3), new_border_colors);
+
+	GeometryBackgroundBorder::UpdateColors(vertices, color_segments, Colourb(1, 2, 3), new_border_colors);
+
+	REQUIRE(vertices.size() == expected_vertices.size());
+	CHECK(indices == expected_indices);
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		CHECK(vertices[i].position == expected_vertices[i].position);
+		CHECK(vertices[i].colour == expected_vertices[i].colour);
+	}
+
+	// Geometry placed in the arena should be updated in place, without allocating new space for it.
+	Geometry geometry(context);
+	geometry.GetVertices() = vertices;
+	geometry.GetIndices() = indices;
+	geometry.Render(Vector2f(0, 0));
+
+	vertices[0].position = Vector2f(-1, -1);
+	render_interface->ResetCounters();
+	geometry.UpdateVertices(vertices);
+	geometry.Render(Vector2f(0, 0));
+
+	const auto counters = render_interface->GetCounters();
+	CHECK(counters.create_geometry_buffer == 0);
+	CHECK(counters.update_geometry_buffer == 1);
+	CHECK(counters.render_calls == 1);
+	CHECK(geometry.GetVertices()[0].position == Vector2f(-1, -1));
+	CHECK(geometry.GetIndices() == indices);
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Geometry compact")
+{
+	TestsShell::GetContext();
+
+	class CompactRenderInterface : public RenderInterface {
+	public:
+		void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/,
+			const Vector2f& /*translation*/) override
+		{
+			num_full += 1;
+		}
+		void RenderCompactGeometry(const CompactVertex* vertices, int num_vertices, const uint16_t* indices, int num_indices,
+			TextureHandle /*texture*/, const Vector2f& /*translation*/) override
+		{
+			num_compact += 1;
+			REQUIRE(num_vertices == 4);
+			REQUIRE(num_indices == 6);
+			last_tex_coord = Vector2f(Math::HalfToFloat(vertices[2].tex_coord[0]), Math::HalfToFloat(vertices[2].tex_coord[1]));
+			last_index = indices[1];
+		}
+		void RenderUntexturedGeometry(const UntexturedVertex* vertices, int /*num_vertices*/, const uint16_t* /*indices*/, int /*num_indices*/,
+			const Vector2f& /*translation*/) override
+		{
+			num_untextured += 1;
+			last_position = vertices[2].position;
+		}
+		bool SupportsCompactGeometry() override { return true; }
+		void EnableScissorRegion(bool /*enable*/) override {}
+		void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+		int num_full = 0, num_compact = 0, num_untextured = 0;
+		Vector2f last_tex_coord, last_position;
+		int last_index = -1;
+	} render_interface;
+
+	Context* context = Rml::CreateContext("compact", Vector2i(100, 100), &render_interface);
+	REQUIRE(context);
+
+	{
+		Geometry untextured(context);
+		untextured.GetVertices().resize(4);
+		untextured.GetIndices().resize(6);
+		GeometryUtilities::GenerateQuad(untextured.GetVertices().data(), untextured.GetIndices().data(), Vector2f(10, 10), Vector2f(20, 20), Colourb(255));
+
+		untextured.Render(Vector2f(0, 0));
+		untextured.Render(Vector2f(0, 0));
+		CHECK(render_interface.num_untextured == 2);
+		CHECK(render_interface.last_position == Vector2f(30, 30));
+
+		Texture texture;
+		Geometry textured(context);
+		textured.SetTexture(&texture);
+		textured.GetVertices().resize(4);
+		textured.GetIndices().resize(6);
+		GeometryUtilities::GenerateQuad(textured.GetVertices().data(), textured.GetIndices().data(), Vector2f(10, 10), Vector2f(20, 20), Colourb(255),
+			Vector2f(0, 0), Vector2f(0.25f, 0.75f));
+
+		textured.Render(Vector2f(0, 0));
+		CHECK(render_interface.num_compact == 1);
+		CHECK(render_interface.last_tex_coord == Vector2f(0.25f, 0.75f));
+		CHECK(render_interface.last_index == 3);
+
+		// Repeated textures need texture coordinates outside [0, 1] at full precision, thus they are rendered in full.
+		Geometry repeated(context);
+		repeated.SetTexture(&texture);
+		repeated.GetVertices().resize(4);
+		repeated.GetIndices().resize(6);
+		GeometryUtilities::GenerateQuad(repeated.GetVertices().data(), repeated.GetIndices().data(), Vector2f(10, 10), Vector2f(20, 20), Colourb(255),
+			Vector2f(0, 0), Vector2f(100.25f, 2.f));
+
+		repeated.Render(Vector2f(0, 0));
+		CHECK(render_interface.num_compact == 1);
+		CHECK(render_interface.num_full == 1);
+
+		// Geometry with too many vertices for 16-bit indices is rendered in full.
+		Geometry large(context);
+		large.GetVertices().resize(70000);
+		large.GetIndices().resize(6);
+		large.Render(Vector2f(0, 0));
+		CHECK(render_interface.num_full == 2);
+		CHECK(render_interface.num_untextured == 2);
+	}
+
+	Rml::RemoveContext("compact");
+	TestsShell::ShutdownShell();
+}
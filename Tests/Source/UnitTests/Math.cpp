@@ -29,6 +29,7 @@
 #include <RmlUi/Core/Math.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
+#include <limits>
 
 using namespace Rml;
 
@@ -103,3 +104,73 @@ TEST_CASE("Math")
 		REQUIRE(r2 == c2.red);
 	}
 }
+
+TEST_CASE("Math.HalfFloat")
+{
+	CHECK(Math::FloatToHalf(0.f) == 0x0000);
+	CHECK(Math::FloatToHalf(-0.f) == 0x8000);
+	CHECK(Math::FloatToHalf(1.f) == 0x3C00);
+	CHECK(Math::FloatToHalf(-2.f) == 0xC000);
+	CHECK(Math::FloatToHalf(0.5f) == 0x3800);
+	CHECK(Math::FloatToHalf(65504.f) == 0x7BFF);
+	CHECK(Math::FloatToHalf(1e6f) == 0x7C00);
+	CHECK(Math::FloatToHalf(-1e6f) == 0xFC00);
+
+	// Smallest subnormal, and values rounding to zero.
+	CHECK(Math::FloatToHalf(5.9604645e-8f) == 0x0001);
+	CHECK(Math::FloatToHalf(1e-9f) == 0x0000);
+
+	// Ties round to even.
+	CHECK(Math::FloatToHalf(1.f + 1.f / 2048.f) == 0x3C00);
+	CHECK(Math::FloatToHalf(1.f + 3.f / 2048.f) == 0x3C02);
+
+	CHECK(Math::HalfToFloat(0x3C00) == 1.f);
+	CHECK(Math::HalfToFloat(0xC000) == -2.f);
+	CHECK(Math::HalfToFloat(0x0001) == 5.9604645e-8f);
+	CHECK(Math::HalfToFloat(0x7C00) > 1e6f);
+
+	const uint16_t nan = Math::FloatToHalf(std::numeric_limits<float>::quiet_NaN());
+	CHECK(Math::HalfToFloat(nan) != Math::HalfToFloat(nan));
+
+	// Texture coordinates in the unit range should be accurate to well within a texel of a large texture.
+	for (int i = 0; i <= 1000; i++)
+	{
+		const float value = float(i) / 1000.f;
+		CHECK(Math::AbsoluteValue(Math::HalfToFloat(Math::FloatToHalf(value)) - value) <= 1.f / 4096.f);
+	}
+}
+
+TEST_CASE("Math.Matrix4")
+{
+	const Matrix4f a = Matrix4f::Translate(10.f, -3.f, 2.f) * Matrix4f::RotateZ(0.5f) * Matrix4f::Scale(2.f, 0.5f, 1.f);
+	const Matrix4f b = Matrix4f::RotateX(-1.2f) * Matrix4f::Perspective(300.f) * Matrix4f::SkewX(0.3f);
+
+	// Compare the multiplication against the definition.
+	const Matrix4f product = a * b;
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			float expected = 0.f;
+			for (int k = 0; k < 4; k++)
+				expected += a.GetRow(i)[k] * b.GetColumn(j)[k];
+			CHECK(product.GetRow(i)[j] == doctest::Approx(expected));
+		}
+	}
+
+	for (const Matrix4f& matrix : {a, b, product})
+	{
+		Matrix4f inverse = matrix;
+		REQUIRE(inverse.Invert());
+
+		const Matrix4f identity = matrix * inverse;
+		for (int i = 0; i < 4; i++)
+			for (int j = 0; j < 4; j++)
+				CHECK(identity.GetRow(i)[j] == doctest::Approx(i == j ? 1.f : 0.f).epsilon(1e-4));
+	}
+
+	Matrix4f singular = Matrix4f::Scale(1.f, 0.f, 1.f);
+	const Matrix4f singular_copy = singular;
+	CHECK(!singular.Invert());
+	CHECK(singular == singular_copy);
+}
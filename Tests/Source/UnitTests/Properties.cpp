@@ -31,6 +31,9 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/PropertyDictionary.h>
+#include <RmlUi/Core/StyleSheetSpecification.h>
+#include "../../../Source/Core/PropertyDeclarationCache.h"
 #include <doctest.h>
 
 using namespace Rml;
@@ -90,3 +93,94 @@ TEST_CASE("Properties")
 
 	Rml::Shutdown();
 }
+
+TEST_CASE("Properties.DeclarationCache")
+{
+	TestsSystemInterface system_interface;
+	TestsRenderInterface render_interface;
+
+	SetRenderInterface(&render_interface);
+	SetSystemInterface(&system_interface);
+
+	Rml::Initialise();
+
+	Context* context = Rml::CreateContext("main", Vector2i(1024, 768));
+	ElementDocument* document = context->CreateDocument();
+
+	SUBCASE("Repeated")
+	{
+		// The second round of declarations are served from the cache, they should give identical results.
+		for (int i = 0; i < 2; i++)
+		{
+			ElementPtr element = document->CreateElement("div");
+
+			CHECK(element->SetProperty("left", "12.5px"));
+			CHECK(element->GetProperty("left")->ToString() == "12.5px");
+
+			CHECK(element->SetProperty("margin", "1px 2px"));
+			CHECK(element->GetProperty("margin-top")->ToString() == "1px");
+			CHECK(element->GetProperty("margin-right")->ToString() == "2px");
+			CHECK(element->GetProperty("margin-bottom")->ToString() == "1px");
+			CHECK(element->GetProperty("margin-left")->ToString() == "2px");
+
+			element->SetAttribute("style", "top: 3px; color: #f00;");
+			CHECK(element->GetProperty("top")->ToString() == "3px");
+			CHECK(element->GetProperty<Colourb>("color") == Colourb(255, 0, 0));
+
+			system_interface.SetNumExpectedWarnings(1);
+			CHECK(!element->SetProperty("left", "12.5 pxx"));
+			CHECK(element->GetProperty("left")->ToString() == "12.5px");
+		}
+	}
+
+	SUBCASE("TypedSetters")
+	{
+		ElementPtr element = document->CreateElement("div");
+
+		CHECK(element->SetProperty(PropertyId::Left, 12.5f, Property::PX));
+		CHECK(element->GetProperty("left")->ToString() == "12.5px");
+
+		CHECK(element->SetProperty(PropertyId::Opacity, 0.5f, Property::NUMBER));
+		CHECK(element->GetProperty<float>("opacity") == 0.5f);
+
+		CHECK(element->SetProperty(PropertyId::BackgroundColor, Colourb(1, 2, 3, 4)));
+		CHECK(element->GetProperty<Colourb>("background-color") == Colourb(1, 2, 3, 4));
+
+		system_interface.SetNumExpectedWarnings(1);
+		CHECK(!element->SetProperty(PropertyId::Left, 1.f, Property::STRING));
+	}
+
+	SUBCASE("LeastRecentlyUsed")
+	{
+		PropertyDeclarationCache cache(2);
+
+		auto Insert = [&](const String& value, float parsed_value) {
+			PropertyDictionary properties;
+			properties.SetProperty(PropertyId::Left, Property(parsed_value, Property::PX));
+			cache.Insert("left", value, properties);
+		};
+		auto Lookup = [&](const String& value) -> float {
+			PropertyDictionary properties;
+			if (!cache.Lookup("left", value, properties))
+				return -1.f;
+			return properties.GetProperty(PropertyId::Left)->Get<float>();
+		};
+
+		Insert("a", 1.f);
+		Insert("b", 2.f);
+		CHECK(Lookup("a") == 1.f);
+
+		// 'b' is now the least recently used entry, and should be evicted.
+		Insert("c", 3.f);
+		CHECK(cache.GetSize() == 2);
+		CHECK(Lookup("a") == 1.f);
+		CHECK(Lookup("b") == -1.f);
+		CHECK(Lookup("c") == 3.f);
+
+		cache.Clear();
+		CHECK(cache.GetSize() == 0);
+		CHECK(Lookup("a") == -1.f);
+	}
+
+	Rml::Shutdown();
+}
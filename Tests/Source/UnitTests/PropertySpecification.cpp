@@ -31,6 +31,7 @@
 #include <RmlUi/Core/PropertyDefinition.h>
 #include <RmlUi/Core/PropertyDictionary.h>
 #include <RmlUi/Core/PropertySpecification.h>
+#include <RmlUi/Core/StyleSheetSpecification.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -97,3 +98,42 @@ TEST_CASE("PropertySpecification")
 
 	Rml::Shutdown();
 }
+
+TEST_CASE("PropertySpecification.PredefinedNames")
+{
+	TestsSystemInterface system_interface;
+	TestsRenderInterface render_interface;
+	SetRenderInterface(&render_interface);
+	SetSystemInterface(&system_interface);
+	Rml::Initialise();
+
+	// Predefined names are looked up through the compile-time tables, make sure they agree with the registered names.
+	for (int i = 1; i < (int)PropertyId::NumDefinedIds; i++)
+	{
+		const String& name = StyleSheetSpecification::GetPropertyName((PropertyId)i);
+		CHECK_MESSAGE(StyleSheetSpecification::GetPropertyId(name) == (PropertyId)i, name);
+	}
+	for (int i = 1; i < (int)ShorthandId::NumDefinedIds; i++)
+	{
+		const String& name = StyleSheetSpecification::GetShorthandName((ShorthandId)i);
+		CHECK_MESSAGE(StyleSheetSpecification::GetShorthandId(name) == (ShorthandId)i, name);
+	}
+
+	// Names which are similar to predefined ones.
+	for (const String name : {"", "invalid", "margin", "margin-to", "margin-topp", "Margin-top", "border-top-left-radiux", "border-top-lefx-radius",
+			 "transform-origin-w", "perspective-origin-x-"})
+	{
+		CHECK_MESSAGE(StyleSheetSpecification::GetPropertyId(name) == PropertyId::Invalid, name);
+	}
+	CHECK(StyleSheetSpecification::GetShorthandId("margin-top") == ShorthandId::Invalid);
+	CHECK(StyleSheetSpecification::GetShorthandId("flex-flo") == ShorthandId::Invalid);
+
+	// Custom properties are still found through the name map.
+	const PropertyId custom_id = StyleSheetSpecification::RegisterProperty("custom-property", "0", false, false).AddParser("number").GetId();
+	CHECK(custom_id >= PropertyId::FirstCustomId);
+	CHECK(StyleSheetSpecification::GetPropertyId("custom-property") == custom_id);
+	CHECK(StyleSheetSpecification::GetPropertyId("margin-top") == PropertyId::MarginTop);
+	CHECK(StyleSheetSpecification::GetPropertyId("custom-propertx") == PropertyId::Invalid);
+
+	Rml::Shutdown();
+}
@@ -0,0 +1,207 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/FileInterface.h>
+#include <RmlUi/Core/StreamMemory.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
+#include <RmlUi/Core/StyleSheetSpecification.h>
+#include <doctest.h>
+#include <algorithm>
+
+using namespace Rml;
+
+static const String document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+	<div id="window" class="transformed animated">
+		<h1>Title</h1>
+		<p class="glow">Lorem <em>ipsum</em></p>
+		<select>
+			<option value="1">One</option>
+			<option value="2">Two</option>
+		</select>
+		<table>
+			<tr><td>A</td></tr>
+			<tr><td>B</td></tr>
+			<tr><td>C</td></tr>
+		</table>
+		<input type="checkbox"/>
+		<button>Button</button>
+	</div>
+</body>
+</rml>
+)";
+
+static const String extra_rcss = R"(
+@keyframes pulse {
+	0%   { opacity: 0.5; transform: scale(1.0); }
+	100% { opacity: 1.0; transform: scale(1.5) rotate(10deg); }
+}
+@decorator frame : tiled-box {
+	decorator: window-tl, window-t, window-tr, window-l, window-c, window-r, window-bl, window-b, window-br;
+}
+div.transformed {
+	transform: translate(10px, 20%) rotateZ(5deg);
+	transform-origin: left top;
+	transition: opacity 0.3s cubic-in-out 0.1s, transform 1s linear-out;
+	decorator: frame, gradient(vertical #fff #000);
+}
+h1 {
+	transition: all 1s back-in;
+}
+div.animated {
+	animation: 2s elastic-in-out infinite alternate pulse;
+}
+p.glow {
+	font-effect: glow(2px 1px 1px #f00), outline(1px black);
+}
+tr:nth-child(2n+1) > td, table tr:last-child td {
+	color: #ab12cd;
+}
+@media (min-width: 640px) and (orientation: landscape) {
+	h1 { font-size: 42dp; }
+}
+@media (max-aspect-ratio: 4/3) {
+	h1 { font-size: 12px; }
+}
+)";
+
+static StringList GetAllProperties(Element* element)
+{
+	StringList result;
+
+	for (PropertyId id : StyleSheetSpecification::GetRegisteredProperties())
+	{
+		const Property* property = element->GetProperty(id);
+		String entry = element->GetAddress() + " " + StyleSheetSpecification::GetPropertyName(id) + ": ";
+		if (property)
+		{
+			entry += property->ToString();
+			if (property->source)
+				entry += CreateString(256, " (%s:%d %s)", property->source->path.c_str(), property->source->line_number,
+					property->source->rule_name.c_str());
+		}
+		result.push_back(std::move(entry));
+	}
+
+	for (int i = 0; i < element->GetNumChildren(); i++)
+	{
+		StringList child_result = GetAllProperties(element->GetChild(i));
+		result.insert(result.end(), child_result.begin(), child_result.end());
+	}
+
+	return result;
+}
+
+static StringList GetStyledDocumentProperties(Context* context, SharedPtr<StyleSheetContainer> style_sheet)
+{
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->SetStyleSheetContainer(std::move(style_sheet));
+	document->Show();
+	context->Update();
+	context->Render();
+
+	StringList result = GetAllProperties(document);
+
+	document->Close();
+	context->Update();
+	return result;
+}
+
+TEST_CASE("StyleSheetBinary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Combine a large sample style sheet with some additional features, and parse them as a single file.
+	const String source_path = "/assets/invader.rcss";
+	String source;
+	REQUIRE(GetFileInterface()->LoadFile(source_path, source));
+	source += extra_rcss;
+
+	StreamMemory stream((const byte*)source.data(), source.size());
+	stream.SetSourceURL(URL(source_path));
+	SharedPtr<StyleSheetContainer> parsed = Factory::InstanceStyleSheetStream(&stream);
+	REQUIRE(parsed.get());
+
+	String data;
+	REQUIRE(parsed->SaveCompiledStyleSheetContainer(data, source));
+	CHECK(!data.empty());
+
+	SUBCASE("Loaded")
+	{
+		auto loaded = MakeShared<StyleSheetContainer>();
+		REQUIRE(loaded->LoadCompiledStyleSheetContainer(data, source_path, &source));
+
+		const StringList parsed_properties = GetStyledDocumentProperties(context, parsed);
+		const StringList loaded_properties = GetStyledDocumentProperties(context, loaded);
+		REQUIRE(parsed_properties.size() == loaded_properties.size());
+
+		for (size_t i = 0; i < parsed_properties.size(); i++)
+			CHECK(parsed_properties[i] == loaded_properties[i]);
+
+		// Make sure the style sheet was applied at all.
+		auto HasProperty = [&](const String& value) {
+			return std::any_of(loaded_properties.begin(), loaded_properties.end(), [&](const String& entry) { return entry.find(value) != String::npos; });
+		};
+		CHECK(HasProperty("transform-origin-x: left"));
+		CHECK(HasProperty("transform: scale"));
+		CHECK(HasProperty("animation: 2s"));
+		CHECK(HasProperty("font-effect: glow"));
+	}
+
+	SUBCASE("Stale")
+	{
+		auto loaded = MakeShared<StyleSheetContainer>();
+		CHECK(!loaded->LoadCompiledStyleSheetContainer(data, source_path, &extra_rcss));
+		CHECK(loaded->LoadCompiledStyleSheetContainer(data, source_path));
+	}
+
+	SUBCASE("Invalid")
+	{
+		auto loaded = MakeShared<StyleSheetContainer>();
+		CHECK(!loaded->LoadCompiledStyleSheetContainer(data.substr(0, data.size() / 2), source_path));
+		CHECK(!loaded->LoadCompiledStyleSheetContainer(String(), source_path));
+	}
+
+	TestsShell::ShutdownShell();
+}
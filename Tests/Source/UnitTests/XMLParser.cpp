@@ -0,0 +1,171 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include <RmlUi/Core/BaseXMLParser.h>
+#include <RmlUi/Core/StreamMemory.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <algorithm>
+
+using namespace Rml;
+
+class RecordingParser : public BaseXMLParser {
+public:
+	RecordingParser()
+	{
+		RegisterCDATATag("script");
+		RegisterInnerXMLAttribute("data-for");
+	}
+
+	void HandleElementStart(const String& name, const XMLAttributes& attributes) override
+	{
+		StringList attribute_list;
+		for (const auto& pair : attributes)
+			attribute_list.push_back(pair.first + "=" + pair.second.Get<String>());
+		std::sort(attribute_list.begin(), attribute_list.end());
+
+		String entry = "<" + name;
+		for (const String& attribute : attribute_list)
+			entry += " " + attribute;
+		entry += "> @" + ToString(GetLineNumberOpenTag());
+		events.push_back(entry);
+	}
+	void HandleElementEnd(const String& name) override { events.push_back("</" + name + ">"); }
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		const char* type_name = (type == XMLDataType::Text ? "text" : (type == XMLDataType::CData ? "cdata" : "inner"));
+		events.push_back(String(type_name) + "[" + data + "]");
+	}
+
+	StringList events;
+};
+
+static StringList Parse(const String& xml)
+{
+	StreamMemory stream((const byte*)xml.data(), xml.size());
+	stream.SetSourceURL("test.rml");
+
+	RecordingParser parser;
+	parser.Parse(&stream);
+	return parser.events;
+}
+
+TEST_CASE("XMLParser")
+{
+	SUBCASE("Elements")
+	{
+		const StringList events = Parse(R"(<?xml version="1.0"?>
+<rml>
+<body  id="a"   class='b c'>
+	<p
+		title="x &lt;y&gt; &amp; &quot;z&quot;" hidden>Hello <!-- comment --> world</p>
+	<br/><img src=image.png />
+	<![CDATA[<not>a tag</not>]]>
+</body>
+</rml>)");
+
+		const StringList expected = {
+			"text[\n]",
+			"<rml> @2",
+			"text[\n]",
+			"<body class=b c id=a> @3",
+			"text[\n\t]",
+			"<p hidden= title=x <y> & \"z\"> @5",
+			"text[Hello  world]",
+			"</p>",
+			"text[\n\t]",
+			"<br> @6",
+			"</br>",
+			"<img src=image.png> @6",
+			"</img>",
+			"text[\n\t<not>a tag</not>\n]",
+			"</body>",
+			"text[\n]",
+			"</rml>",
+		};
+		CHECK(events == expected);
+	}
+
+	SUBCASE("DataBrackets")
+	{
+		const StringList events = Parse(R"(<div>{{ a < b ? 'x</div>' : "y" }} and {{c}}</div>)");
+		const StringList expected = {
+			"<div> @1",
+			"text[{{ a < b ? 'x</div>' : \"y\" }} and {{c}}]",
+			"</div>",
+		};
+		CHECK(events == expected);
+	}
+
+	SUBCASE("CDATATag")
+	{
+		const StringList events = Parse("<script>if (a < b && c > d) {}</p></SCRIPT><div/>");
+		const StringList expected = {
+			"<script> @1",
+			"cdata[if (a < b && c > d) {}</p>]",
+			"</script>",
+			"<div> @1",
+			"</div>",
+		};
+		CHECK(events == expected);
+	}
+
+	SUBCASE("InnerXML")
+	{
+		const StringList events = Parse(R"(<ul><li data-for="item : items"><b>{{item}}</b></li></ul>)");
+		const StringList expected = {
+			"<ul> @1",
+			"<li data-for=item : items> @1",
+			"inner[<b>{{item}}</b>]",
+			"</li>",
+			"</ul>",
+		};
+		CHECK(events == expected);
+	}
+
+	SUBCASE("LineNumbers")
+	{
+		const StringList events = Parse("<a>\n\n<b\nx='1'\n/>\r\n\n<c>text\nmore</c>\n<d/></a>");
+		const StringList expected = {
+			"<a> @1",
+			"text[\n\n]",
+			"<b x=1> @5",
+			"</b>",
+			"text[\r\n\n]",
+			"<c> @7",
+			"text[text\nmore]",
+			"</c>",
+			"text[\n]",
+			"<d> @9",
+			"</d>",
+			"</a>",
+		};
+		CHECK(events == expected);
+	}
+}
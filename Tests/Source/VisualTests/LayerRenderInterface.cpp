@@ -0,0 +1,203 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "LayerRenderInterface.h"
+#include <RmlUi/Core/Math.h>
+#include <float.h>
+
+LayerRenderInterface::LayerRenderInterface(Rml::RenderInterface* render_interface) : render_interface(render_interface) {}
+
+LayerRenderInterface::~LayerRenderInterface() {}
+
+void LayerRenderInterface::RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture,
+	const Rml::Vector2f& translation)
+{
+	Render(vertices, num_vertices, indices, num_indices, texture, translation, state);
+}
+
+void LayerRenderInterface::EnableScissorRegion(bool enable)
+{
+	state.scissor.enabled = enable;
+}
+
+void LayerRenderInterface::SetScissorRegion(int x, int y, int width, int height)
+{
+	state.scissor.origin = Rml::Vector2i(x, y);
+	state.scissor.dimensions = Rml::Vector2i(width, height);
+}
+
+bool LayerRenderInterface::LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source)
+{
+	return render_interface->LoadTexture(texture_handle, texture_dimensions, source);
+}
+
+bool LayerRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions)
+{
+	return render_interface->GenerateTexture(texture_handle, source, source_dimensions);
+}
+
+bool LayerRenderInterface::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, Rml::Vector2i origin, Rml::Vector2i dimensions)
+{
+	return render_interface->UpdateTexture(texture_handle, source, origin, dimensions);
+}
+
+bool LayerRenderInterface::LoadTextureData(Rml::UniquePtr<const Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source)
+{
+	return render_interface->LoadTextureData(data, dimensions, source);
+}
+
+void LayerRenderInterface::ReleaseTexture(Rml::TextureHandle texture_handle)
+{
+	if (!layers.erase(texture_handle))
+		render_interface->ReleaseTexture(texture_handle);
+}
+
+bool LayerRenderInterface::BeginRenderToTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i origin, Rml::Vector2i dimensions)
+{
+	// The address of the layer serves as its texture handle, which does not collide with the handles of the wrapped render interface.
+	Rml::UniquePtr<Layer> layer(new Layer{ origin, dimensions, {} });
+	texture_handle = (Rml::TextureHandle)layer.get();
+
+	recording_layers.push_back(layer.get());
+	layers[texture_handle] = std::move(layer);
+
+	return true;
+}
+
+void LayerRenderInterface::EndRenderToTexture()
+{
+	if (!recording_layers.empty())
+		recording_layers.pop_back();
+}
+
+void LayerRenderInterface::SetTransform(const Rml::Matrix4f* transform)
+{
+	state.transform_enabled = (transform != nullptr);
+	if (transform)
+		state.transform = *transform;
+}
+
+void LayerRenderInterface::Render(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture,
+	Rml::Vector2f translation, const State& render_state)
+{
+	auto it_layer = layers.find(texture);
+	if (it_layer != layers.end() && recording_layers.empty())
+	{
+		RenderLayer(*it_layer->second, vertices, num_vertices, translation, render_state);
+	}
+	else if (it_layer != layers.end())
+	{
+		// Nested layers are replayed when the outer layer is drawn, as long as they have not been released by then.
+		recording_layers.back()->commands.push_back(Command{ Rml::Vector<Rml::Vertex>(vertices, vertices + num_vertices),
+			Rml::Vector<int>(indices, indices + num_indices), texture, translation, true, render_state });
+	}
+	else if (!recording_layers.empty())
+	{
+		recording_layers.back()->commands.push_back(Command{ Rml::Vector<Rml::Vertex>(vertices, vertices + num_vertices),
+			Rml::Vector<int>(indices, indices + num_indices), texture, translation, false, render_state });
+	}
+	else
+	{
+		ApplyState(render_state);
+		render_interface->RenderGeometry(vertices, num_vertices, indices, num_indices, texture, translation);
+	}
+}
+
+void LayerRenderInterface::RenderLayer(Layer& layer, const Rml::Vertex* vertices, int num_vertices, Rml::Vector2f translation, const State& render_state)
+{
+	// The texture covers the quad, which may be placed elsewhere than where the layer was rendered.
+	Rml::Vector2f quad_origin(FLT_MAX);
+	for (int i = 0; i < num_vertices; i++)
+		quad_origin = Rml::Vector2f(Rml::Math::Min(quad_origin.x, vertices[i].position.x), Rml::Math::Min(quad_origin.y, vertices[i].position.y));
+
+	const Rml::Vector2f offset = quad_origin + translation - Rml::Vector2f(layer.origin);
+	const Rml::Vector2i offset_pixels(Rml::Math::RoundToInteger(offset.x), Rml::Math::RoundToInteger(offset.y));
+
+	Scissor layer_area;
+	layer_area.enabled = true;
+	layer_area.origin = layer.origin + offset_pixels;
+	layer_area.dimensions = layer.dimensions;
+
+	// Nothing outside the texture is drawn, and the texture itself is clipped by the scissor region active when it is drawn.
+	layer_area = Intersect(layer_area, render_state.scissor);
+
+	for (Command& command : layer.commands)
+	{
+		if (command.layer_texture && layers.find(command.texture) == layers.end())
+			continue;
+
+		State command_state = command.state;
+		if (command_state.scissor.enabled)
+			command_state.scissor.origin += offset_pixels;
+		command_state.scissor = Intersect(command_state.scissor, layer_area);
+
+		Render(command.vertices.data(), (int)command.vertices.size(), command.indices.data(), (int)command.indices.size(), command.texture,
+			command.translation + offset, command_state);
+	}
+}
+
+void LayerRenderInterface::ApplyState(const State& render_state)
+{
+	// The scissor region may depend on the transform, thus apply it again whenever the transform changes.
+	bool transform_changed = !applied_state_valid || render_state.transform_enabled != applied_state.transform_enabled ||
+		(render_state.transform_enabled && render_state.transform != applied_state.transform);
+
+	if (transform_changed)
+		render_interface->SetTransform(render_state.transform_enabled ? &render_state.transform : nullptr);
+
+	const Scissor& scissor = render_state.scissor;
+	const Scissor& applied_scissor = applied_state.scissor;
+
+	if (transform_changed || scissor.enabled != applied_scissor.enabled)
+		render_interface->EnableScissorRegion(scissor.enabled);
+
+	if (scissor.enabled &&
+		(transform_changed || !applied_scissor.enabled || scissor.origin != applied_scissor.origin || scissor.dimensions != applied_scissor.dimensions))
+		render_interface->SetScissorRegion(scissor.origin.x, scissor.origin.y, scissor.dimensions.x, scissor.dimensions.y);
+
+	applied_state = render_state;
+	applied_state_valid = true;
+}
+
+LayerRenderInterface::Scissor LayerRenderInterface::Intersect(const Scissor& a, const Scissor& b)
+{
+	if (!a.enabled)
+		return b;
+	if (!b.enabled)
+		return a;
+
+	const Rml::Vector2i top_left(Rml::Math::Max(a.origin.x, b.origin.x), Rml::Math::Max(a.origin.y, b.origin.y));
+	const Rml::Vector2i bottom_right(Rml::Math::Min(a.origin.x + a.dimensions.x, b.origin.x + b.dimensions.x),
+		Rml::Math::Min(a.origin.y + a.dimensions.y, b.origin.y + b.dimensions.y));
+
+	Scissor result;
+	result.enabled = true;
+	result.origin = top_left;
+	result.dimensions = Rml::Vector2i(Rml::Math::Max(0, bottom_right.x - top_left.x), Rml::Math::Max(0, bottom_right.y - top_left.y));
+	return result;
+}
@@ -0,0 +1,110 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_TESTS_VISUALTESTS_LAYERRENDERINTERFACE_H
+#define RMLUI_TESTS_VISUALTESTS_LAYERRENDERINTERFACE_H
+
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/Types.h>
+#include <RmlUi/Core/Vertex.h>
+
+/**
+	Adds render-to-texture support to another render interface, so that the visual tests render cached element layers
+	through the same path as backends supporting it.
+
+	Instead of rendering into a texture, the geometry rendered to each texture is recorded. When the texture is drawn, the
+	geometry is replayed clipped to the area of the texture. Thus, content missing from a layer, or a layer which is not
+	re-rendered after changes, shows up just as with a real texture.
+ */
+
+class LayerRenderInterface : public Rml::RenderInterface {
+public:
+	LayerRenderInterface(Rml::RenderInterface* render_interface);
+	~LayerRenderInterface();
+
+	void RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture,
+		const Rml::Vector2f& translation) override;
+
+	void EnableScissorRegion(bool enable) override;
+	void SetScissorRegion(int x, int y, int width, int height) override;
+
+	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
+	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, Rml::Vector2i origin, Rml::Vector2i dimensions) override;
+	bool LoadTextureData(Rml::UniquePtr<const Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source) override;
+	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
+
+	bool BeginRenderToTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i origin, Rml::Vector2i dimensions) override;
+	void EndRenderToTexture() override;
+
+	void SetTransform(const Rml::Matrix4f* transform) override;
+
+private:
+	struct Scissor {
+		bool enabled = false;
+		Rml::Vector2i origin, dimensions;
+	};
+	struct State {
+		Scissor scissor;
+		bool transform_enabled = false;
+		Rml::Matrix4f transform;
+	};
+	struct Command {
+		Rml::Vector<Rml::Vertex> vertices;
+		Rml::Vector<int> indices;
+		Rml::TextureHandle texture;
+		Rml::Vector2f translation;
+		bool layer_texture;
+		State state;
+	};
+	struct Layer {
+		Rml::Vector2i origin, dimensions;
+		Rml::Vector<Command> commands;
+	};
+
+	// Renders the geometry into the layer being recorded, or otherwise to the wrapped render interface.
+	void Render(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture, Rml::Vector2f translation,
+		const State& render_state);
+	// Replays the geometry of the layer, as drawn by the given texture quad.
+	void RenderLayer(Layer& layer, const Rml::Vertex* vertices, int num_vertices, Rml::Vector2f translation, const State& render_state);
+	void ApplyState(const State& render_state);
+
+	static Scissor Intersect(const Scissor& a, const Scissor& b);
+
+	Rml::RenderInterface* render_interface;
+
+	// The state set by the library, and the state last applied to the wrapped render interface.
+	State state;
+	State applied_state;
+	bool applied_state_valid = false;
+
+	Rml::UnorderedMap<Rml::TextureHandle, Rml::UniquePtr<Layer>> layers;
+	Rml::Vector<Layer*> recording_layers;
+};
+
+#endif
@@ -30,6 +30,7 @@
 #include "TestViewer.h"
 #include "TestNavigator.h"
 #include "CaptureScreen.h"
+#include "LayerRenderInterface.h"
 #include "TestSuite.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Core.h>
@@ -96,8 +97,9 @@ int main(int argc, char** argv)
 		return -1;
 	}
 
-	// RmlUi initialisation.
-	Rml::SetRenderInterface(&opengl_renderer);
+	// RmlUi initialisation. Render-to-texture is emulated so that the tests render element layers through the cached path.
+	LayerRenderInterface layer_renderer(&opengl_renderer);
+	Rml::SetRenderInterface(&layer_renderer);
 	shell_renderer->SetViewport(window_width, window_height);
 
 	ShellSystemInterface system_interface;
@@ -0,0 +1,113 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include <RmlUi/Core.h>
+#include <stdio.h>
+
+/*
+	Compiles RML documents into their pre-tokenized binary form, which RmlUi instances without parsing any RML.
+
+	Usage: rmlcompiler <file.rml> [<file.rml> ...]
+
+	Each document is written next to its source as '<file.rml>.bin', where it is picked up by Context::LoadDocument() after
+	enabling Rml::SetCompiledFileLoading(). The binary is only used while it matches the source it was compiled from and
+	the RmlUi version it was compiled with, otherwise the source is parsed as usual. Templates and style sheets referenced
+	by the document are loaded as usual.
+*/
+
+class CompilerSystemInterface : public Rml::SystemInterface {
+public:
+	double GetElapsedTime() override { return 0.0; }
+
+	bool LogMessage(Rml::Log::Type type, const Rml::String& message) override
+	{
+		if (type <= Rml::Log::LT_WARNING)
+			fprintf(stderr, "%s\n", message.c_str());
+		return true;
+	}
+};
+
+static bool CompileDocument(const Rml::String& source_path)
+{
+	Rml::String source;
+	if (!Rml::GetFileInterface()->LoadFile(source_path, source))
+	{
+		fprintf(stderr, "Could not read document '%s'.\n", source_path.c_str());
+		return false;
+	}
+
+	Rml::String data;
+	Rml::Factory::CompileDocument(data, source, source_path);
+
+	const Rml::String output_path = source_path + ".bin";
+	FILE* file = fopen(output_path.c_str(), "wb");
+	if (!file)
+	{
+		fprintf(stderr, "Could not open '%s' for writing.\n", output_path.c_str());
+		return false;
+	}
+
+	const bool result = (fwrite(data.data(), 1, data.size(), file) == data.size());
+	fclose(file);
+
+	if (!result)
+	{
+		fprintf(stderr, "Could not write '%s'.\n", output_path.c_str());
+		return false;
+	}
+
+	printf("%s -> %s (%zu bytes)\n", source_path.c_str(), output_path.c_str(), data.size());
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "Usage: %s <file.rml> [<file.rml> ...]\n", argv[0]);
+		return 1;
+	}
+
+	CompilerSystemInterface system_interface;
+	Rml::SetSystemInterface(&system_interface);
+
+	if (!Rml::Initialise())
+		return 1;
+
+	int result = 0;
+	for (int i = 1; i < argc; i++)
+	{
+		if (!CompileDocument(argv[i]))
+			result = 1;
+	}
+
+	Rml::Shutdown();
+
+	return result;
+}